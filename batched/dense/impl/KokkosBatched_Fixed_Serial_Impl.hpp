@@ -0,0 +1,237 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBATCHED_FIXED_SERIAL_IMPL_HPP
+#define KOKKOSBATCHED_FIXED_SERIAL_IMPL_HPP
+
+#include <type_traits>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Fixed_Serial_Internal.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_SolveLU_Decl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Serial_Impl.hpp"
+
+namespace KokkosBatched {
+
+namespace Impl {
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION static int checkFixedInput([[maybe_unused]] const char *name, [[maybe_unused]] const ViewType &V,
+                                                  [[maybe_unused]] const int m, [[maybe_unused]] const int n) {
+  static_assert(Kokkos::is_view_v<ViewType>, "KokkosBatched::Fixed: ViewType is not a Kokkos::View.");
+  static_assert(ViewType::rank == 2, "KokkosBatched::Fixed: ViewType must have rank 2.");
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  if (V.extent_int(0) != m || V.extent_int(1) != n) {
+    Kokkos::printf("KokkosBatched::Fixed: %s must be %d x %d, but it is %d x %d\n", name, m, n, V.extent_int(0),
+                   V.extent_int(1));
+    return 1;
+  }
+#endif
+  return 0;
+}
+
+template <typename ArgTrans>
+constexpr bool fixed_is_transpose() {
+  static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value || std::is_same<ArgTrans, Trans::Transpose>::value,
+                "KokkosBatched::Fixed: the transpose argument must be Trans::NoTranspose or Trans::Transpose.");
+  return std::is_same<ArgTrans, Trans::Transpose>::value;
+}
+
+// Whether Fixed has kernels for all of the transpose arguments; FixedDispatch
+// sends the others (Trans::ConjTranspose) to the Unblocked kernels
+template <typename... ArgTrans>
+constexpr bool fixed_has_transpose() {
+  return ((std::is_same<ArgTrans, Trans::NoTranspose>::value || std::is_same<ArgTrans, Trans::Transpose>::value) &&
+          ...);
+}
+}  // namespace Impl
+
+///
+/// Fixed
+/// =====
+
+template <int M, int N, int K>
+template <typename ArgTransA, typename ArgTransB, typename ScalarType, typename AViewType, typename BViewType,
+          typename CViewType>
+KOKKOS_INLINE_FUNCTION int Fixed<M, N, K>::gemm(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                                                const ScalarType beta, const CViewType &C) {
+  constexpr bool transA = Impl::fixed_is_transpose<ArgTransA>();
+  constexpr bool transB = Impl::fixed_is_transpose<ArgTransB>();
+  const int info        = Impl::checkFixedInput("A", A, transA ? K : M, transA ? M : K) +
+                   Impl::checkFixedInput("B", B, transB ? N : K, transB ? K : N) + Impl::checkFixedInput("C", C, M, N);
+  if (info) return info;
+
+  return SerialFixedInternal<M, N, K>::gemm(alpha, A.data(), transA ? A.stride_1() : A.stride_0(),
+                                            transA ? A.stride_0() : A.stride_1(), B.data(),
+                                            transB ? B.stride_1() : B.stride_0(), transB ? B.stride_0() : B.stride_1(),
+                                            beta, C.data(), C.stride_0(), C.stride_1());
+}
+
+template <int M, int N, int K>
+template <typename AViewType>
+KOKKOS_INLINE_FUNCTION int Fixed<M, N, K>::lu(
+    const AViewType &A, const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+  const int info = Impl::checkFixedInput("A", A, M, N);
+  if (info) return info;
+
+  return SerialFixedInternal<M, N, K>::lu(A.data(), A.stride_0(), A.stride_1(), tiny);
+}
+
+template <int M, int N, int K>
+template <typename ArgUplo, typename ArgTrans, typename ArgDiag, typename ScalarType, typename AViewType,
+          typename BViewType>
+KOKKOS_INLINE_FUNCTION int Fixed<M, N, K>::trsm(const ScalarType alpha, const AViewType &A, const BViewType &B) {
+  constexpr bool trans = Impl::fixed_is_transpose<ArgTrans>();
+  const int info       = Impl::checkFixedInput("A", A, M, M) + Impl::checkFixedInput("B", B, M, N);
+  if (info) return info;
+
+  // op(A) of a lower triangular A is upper triangular if transposed
+  constexpr bool lower = std::is_same<ArgUplo, Uplo::Lower>::value != trans;
+  const int as0        = trans ? A.stride_1() : A.stride_0(), as1 = trans ? A.stride_0() : A.stride_1();
+  if (lower)
+    return SerialFixedInternal<M, N, K>::trsm_left_lower(ArgDiag::use_unit_diag, alpha, A.data(), as0, as1, B.data(),
+                                                         B.stride_0(), B.stride_1());
+  else
+    return SerialFixedInternal<M, N, K>::trsm_left_upper(ArgDiag::use_unit_diag, alpha, A.data(), as0, as1, B.data(),
+                                                         B.stride_0(), B.stride_1());
+}
+
+template <int M, int N, int K>
+template <typename ArgTrans, typename AViewType, typename BViewType>
+KOKKOS_INLINE_FUNCTION int Fixed<M, N, K>::solve_lu(const AViewType &A, const BViewType &B) {
+  int r_val[2] = {};
+  const typename AViewType::non_const_value_type one(1.0);
+  if (!Impl::fixed_is_transpose<ArgTrans>()) {
+    // L Y = B, then U X = Y
+    r_val[0] = trsm<Uplo::Lower, ArgTrans, Diag::Unit>(one, A, B);
+    r_val[1] = trsm<Uplo::Upper, ArgTrans, Diag::NonUnit>(one, A, B);
+  } else {
+    // U' Y = B, then L' X = Y
+    r_val[0] = trsm<Uplo::Upper, ArgTrans, Diag::NonUnit>(one, A, B);
+    r_val[1] = trsm<Uplo::Lower, ArgTrans, Diag::Unit>(one, A, B);
+  }
+  return r_val[0] + r_val[1];
+}
+
+///
+/// FixedDispatch
+/// =============
+
+template <typename FunctorType>
+KOKKOS_INLINE_FUNCTION bool FixedDispatch::dispatch(const int n, const FunctorType &f) {
+  static_assert(min_size == 2 && max_size == 16, "KokkosBatched::FixedDispatch: update the cases below");
+  switch (n) {
+    case 2: f(std::integral_constant<int, 2>()); break;
+    case 3: f(std::integral_constant<int, 3>()); break;
+    case 4: f(std::integral_constant<int, 4>()); break;
+    case 5: f(std::integral_constant<int, 5>()); break;
+    case 6: f(std::integral_constant<int, 6>()); break;
+    case 7: f(std::integral_constant<int, 7>()); break;
+    case 8: f(std::integral_constant<int, 8>()); break;
+    case 9: f(std::integral_constant<int, 9>()); break;
+    case 10: f(std::integral_constant<int, 10>()); break;
+    case 11: f(std::integral_constant<int, 11>()); break;
+    case 12: f(std::integral_constant<int, 12>()); break;
+    case 13: f(std::integral_constant<int, 13>()); break;
+    case 14: f(std::integral_constant<int, 14>()); break;
+    case 15: f(std::integral_constant<int, 15>()); break;
+    case 16: f(std::integral_constant<int, 16>()); break;
+    default: return false;
+  }
+  return true;
+}
+
+template <typename ArgTransA, typename ArgTransB, typename ScalarType, typename AViewType, typename BViewType,
+          typename CViewType>
+KOKKOS_INLINE_FUNCTION int FixedDispatch::gemm(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                                               const ScalarType beta, const CViewType &C) {
+  if constexpr (Impl::fixed_has_transpose<ArgTransA, ArgTransB>()) {
+    const int m = C.extent_int(0), n = C.extent_int(1);
+    const int k = Impl::fixed_is_transpose<ArgTransA>() ? A.extent_int(0) : A.extent_int(1);
+    int r_val   = 0;
+    if (k == m && (n == m || n == 1)) {
+      const bool done = dispatch(m, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        if (n == 1)
+          r_val = Fixed<S, 1, S>::template gemm<ArgTransA, ArgTransB>(alpha, A, B, beta, C);
+        else
+          r_val = Fixed<S, S, S>::template gemm<ArgTransA, ArgTransB>(alpha, A, B, beta, C);
+      });
+      if (done) return r_val;
+    }
+  }
+  return SerialGemm<ArgTransA, ArgTransB, Algo::Gemm::Unblocked>::invoke(alpha, A, B, beta, C);
+}
+
+template <typename AViewType>
+KOKKOS_INLINE_FUNCTION int FixedDispatch::lu(
+    const AViewType &A, const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+  const int m = A.extent_int(0), n = A.extent_int(1);
+  int r_val   = 0;
+  if (m == n) {
+    const bool done = dispatch(m, [&](auto size) {
+      constexpr int S = decltype(size)::value;
+      r_val           = Fixed<S>::lu(A, tiny);
+    });
+    if (done) return r_val;
+  }
+  return SerialLU<Algo::LU::Unblocked>::invoke(A, tiny);
+}
+
+template <typename ArgUplo, typename ArgTrans, typename ArgDiag, typename ScalarType, typename AViewType,
+          typename BViewType>
+KOKKOS_INLINE_FUNCTION int FixedDispatch::trsm(const ScalarType alpha, const AViewType &A, const BViewType &B) {
+  if constexpr (Impl::fixed_has_transpose<ArgTrans>()) {
+    const int m = B.extent_int(0), n = B.extent_int(1);
+    int r_val   = 0;
+    if (n == m || n == 1) {
+      const bool done = dispatch(m, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        if (n == 1)
+          r_val = Fixed<S, 1>::template trsm<ArgUplo, ArgTrans, ArgDiag>(alpha, A, B);
+        else
+          r_val = Fixed<S, S>::template trsm<ArgUplo, ArgTrans, ArgDiag>(alpha, A, B);
+      });
+      if (done) return r_val;
+    }
+  }
+  return SerialTrsm<Side::Left, ArgUplo, ArgTrans, ArgDiag, Algo::Trsm::Unblocked>::invoke(alpha, A, B);
+}
+
+template <typename ArgTrans, typename AViewType, typename BViewType>
+KOKKOS_INLINE_FUNCTION int FixedDispatch::solve_lu(const AViewType &A, const BViewType &B) {
+  if constexpr (Impl::fixed_has_transpose<ArgTrans>()) {
+    const int m = B.extent_int(0), n = B.extent_int(1);
+    int r_val   = 0;
+    if (n == m || n == 1) {
+      const bool done = dispatch(m, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        if (n == 1)
+          r_val = Fixed<S, 1>::template solve_lu<ArgTrans>(A, B);
+        else
+          r_val = Fixed<S, S>::template solve_lu<ArgTrans>(A, B);
+      });
+      if (done) return r_val;
+    }
+  }
+  return SerialSolveLU<ArgTrans, Algo::SolveLU::Unblocked>::invoke(A, B);
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,213 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBATCHED_FIXED_SERIAL_INTERNAL_HPP
+#define KOKKOSBATCHED_FIXED_SERIAL_INTERNAL_HPP
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl
+/// ====================
+///
+/// Same operations and operation order as the Unblocked internal kernels of
+/// Gemm, LU and Trsm, with compile time dimensions. The updated matrix is
+/// kept in a local array between its load and its store.
+
+template <int M, int N, int K>
+struct SerialFixedInternal {
+  // C = beta C + alpha A B
+  // C (M x N), A(M x K), B(K x N)
+  template <typename ScalarType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int gemm(const ScalarType alpha, const ValueType *KOKKOS_RESTRICT A, const int as0,
+                                         const int as1, const ValueType *KOKKOS_RESTRICT B, const int bs0,
+                                         const int bs1, const ScalarType beta,
+                                         /**/ ValueType *KOKKOS_RESTRICT C, const int cs0, const int cs1) {
+    const ScalarType zero(0.0);
+
+    ValueType ab[M][N];
+    for (int i = 0; i < M; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+      for (int j = 0; j < N; ++j) ab[i][j] = ValueType(0);
+
+    if (alpha != zero) {
+      for (int p = 0; p < K; ++p) {
+        for (int i = 0; i < M; ++i) {
+          const ValueType a_ip = A[i * as0 + p * as1];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j = 0; j < N; ++j) ab[i][j] += a_ip * B[p * bs0 + j * bs1];
+        }
+      }
+    }
+
+    for (int i = 0; i < M; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+      for (int j = 0; j < N; ++j) {
+        ValueType &c = C[i * cs0 + j * cs1];
+        c            = beta == zero ? ValueType(alpha * ab[i][j]) : ValueType(beta * c + alpha * ab[i][j]);
+      }
+    return 0;
+  }
+
+  // A = L U (no pivoting), A (M x N)
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int lu(ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+                                       const typename MagnitudeScalarType<ValueType>::type tiny) {
+    constexpr int P = M < N ? M : N;
+
+    using mst                 = typename MagnitudeScalarType<ValueType>::type;
+    const auto abs_tiny       = tiny > 0 ? tiny : mst(-tiny);
+    const auto minus_abs_tiny = -abs_tiny;
+
+    ValueType a[M][N];
+    load(A, as0, as1, a);
+
+    for (int p = 0; p < P; ++p) {
+      if (tiny != 0) {
+        const auto alpha11_real = Kokkos::ArithTraits<ValueType>::real(a[p][p]);
+        a[p][p] += minus_abs_tiny * ValueType(alpha11_real < 0);
+        a[p][p] += abs_tiny * ValueType(alpha11_real >= 0);
+      }
+
+      const ValueType alpha11 = a[p][p];
+      for (int i = p + 1; i < M; ++i) {
+        a[i][p] /= alpha11;
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = p + 1; j < N; ++j) a[i][j] -= a[i][p] * a[p][j];
+      }
+    }
+
+    store(a, A, as0, as1);
+    return 0;
+  }
+
+  // B = alpha inv(A) B, A (M x M) lower triangular, B (M x N)
+  template <typename ScalarType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int trsm_left_lower(const bool use_unit_diag, const ScalarType alpha,
+                                                    const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+                                                    /**/ ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1) {
+    ValueType b[M][N];
+    if (!load_scaled(alpha, B, bs0, bs1, b)) return 0;
+
+    for (int p = 0; p < M; ++p) {
+      if (!use_unit_diag) {
+        const ValueType alpha11 = A[p * as0 + p * as1];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) b[p][j] = b[p][j] / alpha11;
+      }
+      for (int i = p + 1; i < M; ++i) {
+        const ValueType a_ip = A[i * as0 + p * as1];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) b[i][j] -= a_ip * b[p][j];
+      }
+    }
+
+    store(b, B, bs0, bs1);
+    return 0;
+  }
+
+  // B = alpha inv(A) B, A (M x M) upper triangular, B (M x N)
+  template <typename ScalarType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int trsm_left_upper(const bool use_unit_diag, const ScalarType alpha,
+                                                    const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+                                                    /**/ ValueType *KOKKOS_RESTRICT B, const int bs0, const int bs1) {
+    ValueType b[M][N];
+    if (!load_scaled(alpha, B, bs0, bs1, b)) return 0;
+
+    for (int p = M - 1; p >= 0; --p) {
+      if (!use_unit_diag) {
+        const ValueType alpha11 = A[p * as0 + p * as1];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) b[p][j] = b[p][j] / alpha11;
+      }
+      for (int i = 0; i < p; ++i) {
+        const ValueType a_ip = A[i * as0 + p * as1];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) b[i][j] -= a_ip * b[p][j];
+      }
+    }
+
+    store(b, B, bs0, bs1);
+    return 0;
+  }
+
+ private:
+  template <typename ValueType, int R, int C>
+  KOKKOS_FORCEINLINE_FUNCTION static void load(const ValueType *KOKKOS_RESTRICT A, const int as0, const int as1,
+                                               ValueType (&a)[R][C]) {
+    for (int i = 0; i < R; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+      for (int j = 0; j < C; ++j) a[i][j] = A[i * as0 + j * as1];
+  }
+
+  template <typename ValueType, int R, int C>
+  KOKKOS_FORCEINLINE_FUNCTION static void store(const ValueType (&a)[R][C], ValueType *KOKKOS_RESTRICT A,
+                                                const int as0, const int as1) {
+    for (int i = 0; i < R; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+      for (int j = 0; j < C; ++j) A[i * as0 + j * as1] = a[i][j];
+  }
+
+  // Loads alpha B into b; if alpha is zero, sets B to zero instead and
+  // returns false
+  template <typename ScalarType, typename ValueType>
+  KOKKOS_FORCEINLINE_FUNCTION static bool load_scaled(const ScalarType alpha, ValueType *KOKKOS_RESTRICT B,
+                                                      const int bs0, const int bs1, ValueType (&b)[M][N]) {
+    const ScalarType one(1.0), zero(0.0);
+    if (alpha == zero) {
+      for (int i = 0; i < M; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) B[i * bs0 + j * bs1] = ValueType(0);
+      return false;
+    }
+    load(B, bs0, bs1, b);
+    if (alpha != one) {
+      for (int i = 0; i < M; ++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j = 0; j < N; ++j) b[i][j] *= alpha;
+    }
+    return true;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
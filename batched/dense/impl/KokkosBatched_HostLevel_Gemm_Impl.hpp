@@ -19,6 +19,7 @@
 #include <KokkosBatched_Util.hpp>  // Trans, BatchLayout
 #include <KokkosKernels_ExecSpaceUtils.hpp>
 #include <KokkosKernels_Error.hpp>
+#include <Kokkos_ArithTraits.hpp>
 
 #include "KokkosBatched_HostLevel_Gemm_Handle.hpp"  // BatchedGemmHandle
 #include "KokkosBatched_HostLevel_Gemm_Serial_Impl.hpp"
@@ -62,12 +63,63 @@ constexpr KOKKOS_INLINE_FUNCTION size_t kk_gemm_dbl_buf_alpha_in_fma_thresh() {
 #endif  // __CUDAACC_RDC__
 }
 
+// BatchedDblBufGemm with the tile sizes tuned for GPUs; the bounds checks are
+// skipped when c_m, c_n and k are all multiples of the tiles.
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim, typename BatchedGemmHandleType,
+          typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+int BatchedTunedDblBufGemm(BatchedGemmHandleType *const handle, const ScalarType alpha, const AViewType &A,
+                           const BViewType &B, const ScalarType beta, const CViewType &C, const size_t c_m,
+                           const size_t c_n) {
+  using exec_space      = typename CViewType::execution_space;
+  constexpr bool transA = std::is_same<ArgTransA, Trans::Transpose>::value;
+  size_t c_k;
+  if constexpr (std::is_same<ArgBatchSzDim, BatchLayout::Left>::value)
+    c_k = transA ? A.extent(1) : A.extent(2);
+  else
+    c_k = transA ? A.extent(0) : A.extent(1);
+
+  handle->teamSz = handle->vecLen      = 8;
+  constexpr int tile_m                 = Impl::kk_gemm_dbl_buf_tile_m<exec_space>();
+  constexpr int tile_n                 = Impl::kk_gemm_dbl_buf_tile_n<exec_space>();
+  constexpr int tile_k                 = Impl::kk_gemm_dbl_buf_tile_k<exec_space>();
+  constexpr size_t alpha_in_fma_thresh = Impl::kk_gemm_dbl_buf_alpha_in_fma_thresh();
+
+  int ret                    = 0;
+  const bool full_tiles_only = c_m % tile_m == 0 && c_n % tile_n == 0 && c_k % tile_k == 0;
+  if (full_tiles_only) {               // No bounds checking
+    if (c_m >= alpha_in_fma_thresh) {  // apply alpha in fma
+      ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                                    BViewType, CViewType, BoundsCheck::No, AlphaTag::Yes, tile_m, tile_n, tile_k>(
+                handle, alpha, A, B, beta, C)
+                .invoke();
+    } else {  // apply alpha in mul
+      ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                                    BViewType, CViewType, BoundsCheck::No, AlphaTag::No, tile_m, tile_n, tile_k>(
+                handle, alpha, A, B, beta, C)
+                .invoke();
+    }
+  } else {                             // bounds checking
+    if (c_m >= alpha_in_fma_thresh) {  // apply alpha in fma
+      ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                                    BViewType, CViewType, BoundsCheck::Yes, AlphaTag::Yes, tile_m, tile_n, tile_k>(
+                handle, alpha, A, B, beta, C)
+                .invoke();
+    } else {  // apply alpha in mul
+      ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                                    BViewType, CViewType, BoundsCheck::Yes, AlphaTag::No, tile_m, tile_n, tile_k>(
+                handle, alpha, A, B, beta, C)
+                .invoke();
+    }
+  }
+  return ret;
+}
+
 template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim, typename BatchedGemmHandleType,
           typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
 int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha, const AViewType &A, const BViewType &B,
                     const ScalarType beta, const CViewType &C) {
   int ret = 0;
-  size_t c_m, c_n;
+  size_t c_m, c_n, c_b;
   using ViewValueType = typename CViewType::value_type;
   // Check for valid input views
   static_assert(Kokkos::is_view<AViewType>::value, "AViewType must be a Kokkos::View.");
@@ -83,6 +135,7 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
     switch (handle->get_kernel_algo_type()) {
       case BaseKokkosBatchedAlgos::KK_SERIAL:
       case BaseHeuristicAlgos::SQUARE:
+      case BaseHeuristicAlgos::AUTO:
       case BaseTplAlgos::ARMPL:
         assert(A.rank_dynamic() == 3 && "AViewType must have rank 3.");
         assert(B.rank_dynamic() == 3 && "BViewType must have rank 3.");
@@ -114,11 +167,11 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
       "LayoutRight views require BatchLayout::Left");
 
   if constexpr (std::is_same<ArgBatchSzDim, BatchLayout::Left>::value) {
-    // c_b = C.extent(0);
+    c_b = C.extent(0);
     c_m = C.extent(1);
     c_n = C.extent(2);
   } else {
-    // c_b = C.extent(2);
+    c_b = C.extent(2);
     c_m = C.extent(0);
     c_n = C.extent(1);
   }
@@ -173,37 +226,8 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
       if constexpr (on_gpu) {
         if (((std::is_same<layout_type, Kokkos::LayoutLeft>::value) ? (c_m >= 16)
                                                                     : (c_m >= 24 && c_m <= 32) || c_m >= 40)) {
-          handle->teamSz = handle->vecLen      = 8;
-          constexpr int tile_m                 = Impl::kk_gemm_dbl_buf_tile_m<exec_space>();
-          constexpr int tile_n                 = Impl::kk_gemm_dbl_buf_tile_n<exec_space>();
-          constexpr int tile_k                 = Impl::kk_gemm_dbl_buf_tile_k<exec_space>();
-          constexpr size_t alpha_in_fma_thresh = Impl::kk_gemm_dbl_buf_alpha_in_fma_thresh();
-
-          if (c_m % 32 == 0) {                 // No bounds checking
-            if (c_m >= alpha_in_fma_thresh) {  // apply alpha in fma
-              ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType,
-                                            AViewType, BViewType, CViewType, BoundsCheck::No, AlphaTag::Yes, tile_m,
-                                            tile_n, tile_k>(handle, alpha, A, B, beta, C)
-                        .invoke();
-            } else {  // apply alpha in mul
-              ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType,
-                                            AViewType, BViewType, CViewType, BoundsCheck::No, AlphaTag::No, tile_m,
-                                            tile_n, tile_k>(handle, alpha, A, B, beta, C)
-                        .invoke();
-            }
-          } else {                             // bounds checking
-            if (c_m >= alpha_in_fma_thresh) {  // apply alpha in fma
-              ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType,
-                                            AViewType, BViewType, CViewType, BoundsCheck::Yes, AlphaTag::Yes, tile_m,
-                                            tile_n, tile_k>(handle, alpha, A, B, beta, C)
-                        .invoke();
-            } else {  // apply alpha in mul
-              ret = Impl::BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType,
-                                            AViewType, BViewType, CViewType, BoundsCheck::Yes, AlphaTag::No, tile_m,
-                                            tile_n, tile_k>(handle, alpha, A, B, beta, C)
-                        .invoke();
-            }
-          }
+          ret = Impl::BatchedTunedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, alpha, A, B, beta, C, c_m,
+                                                                                  c_n);
         } else {
           out_of_range = true;
         }
@@ -215,6 +239,39 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
       }
       break;
 
+    case BaseHeuristicAlgos::AUTO: {
+      // Select the algorithm from the decision table of the handle. SIMD
+      // views use the serial kernel of the SQUARE heuristic.
+      int algo = BaseKokkosBatchedAlgos::KK_SERIAL;
+      if constexpr (!is_vector) {
+        const std::string layout = std::is_same<ArgBatchSzDim, BatchLayout::Left>::value ? "Left" : "Right";
+        algo = handle->tuningTable.select(exec_space::name(), Kokkos::ArithTraits<view_scalar_type>::name(), layout,
+                                          static_cast<int>(std::max(c_m, c_n)), static_cast<int>(c_b), on_gpu,
+                                          handle->enableDebug);
+      }
+      if (handle->enableDebug) {
+        std::cout << "AUTO: kernelAlgoType = " << std::to_string(algo) << std::endl;
+      }
+
+      if (algo == GemmKokkosBatchedAlgos::KK_DBLBUF && on_gpu) {
+        if constexpr (on_gpu) {
+          ret = Impl::BatchedTunedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, alpha, A, B, beta, C, c_m,
+                                                                                  c_n);
+        }
+      } else if (algo == GemmKokkosBatchedAlgos::KK_SERIAL_RANK0) {
+        ret = Impl::BatchedSerialGemm<ArgTransA, ArgTransB, Algo::Gemm::Unblocked, ArgBatchSzDim,
+                                      ResultsPerThread::Rank0, ScalarType, AViewType, BViewType, CViewType>(alpha, A, B,
+                                                                                                            beta, C)
+                  .invoke();
+      } else {
+        // bsgModeType is the mode selected by the SQUARE heuristic above
+        ret = Impl::BatchedSerialGemm<ArgTransA, ArgTransB, bsgModeType, ArgBatchSzDim, ResultsPerThread::Rank2,
+                                      ScalarType, AViewType, BViewType, CViewType>(alpha, A, B, beta, C)
+                  .invoke();
+      }
+      break;
+    }
+
       //    case BaseHeuristicAlgos::TALL:
       //
       //    case BaseHeuristicAlgos::WIDE:
@@ -0,0 +1,175 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_IMPL_HPP
+#define KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_IMPL_HPP
+#include <array>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_Util.hpp>  // Trans
+#include <KokkosKernels_ExecSpaceUtils.hpp>
+#include <KokkosKernels_Error.hpp>
+
+#include "KokkosBatched_HostLevel_Gemm_Handle.hpp"  // BatchedGemmHandle
+#include "KokkosBatched_Gemm_Serial_Internal.hpp"
+#include "KokkosBatched_Gemm_TeamVector_Internal.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+// On GPUs, bins whose C has at least this many entries are computed by one
+// team per matrix; smaller matrices are computed by one thread each.
+template <typename ExecutionSpace>
+constexpr KOKKOS_INLINE_FUNCTION int kk_gemm_vbatched_team_min_mn() {
+  return 16 * 16;
+}
+
+/// \brief Computes the entries perm(begin), ..., perm(begin + count - 1) of
+/// a variable size batch, which all have the same m, n and k. Each thread
+/// (RangePolicy) or each team (TeamPolicy) computes one entry.
+template <class ArgTransA, class ArgTransB, class ArgMode, class ScalarType, class EntryViewType, class IndexViewType>
+struct BatchedVBatchedGemmFunctor {
+  using entry_type  = typename EntryViewType::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<typename EntryViewType::execution_space>::member_type;
+
+  ScalarType alpha, beta;
+  EntryViewType entries;
+  IndexViewType perm;
+  int begin;
+
+  BatchedVBatchedGemmFunctor(const ScalarType alpha_, const EntryViewType &entries_, const ScalarType beta_,
+                             const IndexViewType &perm_, const int begin_)
+      : alpha(alpha_), beta(beta_), entries(entries_), perm(perm_), begin(begin_) {}
+
+  // Strides of op(A) and op(B) in column-major storage
+  KOKKOS_INLINE_FUNCTION
+  static void strides(const entry_type &e, int &as0, int &as1, int &bs0, int &bs1) {
+    const bool transA = std::is_same<ArgTransA, Trans::Transpose>::value;
+    const bool transB = std::is_same<ArgTransB, Trans::Transpose>::value;
+    as0               = transA ? e.lda : 1;
+    as1               = transA ? 1 : e.lda;
+    bs0               = transB ? e.ldb : 1;
+    bs1               = transB ? 1 : e.ldb;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    const entry_type e = entries(perm(begin + i));
+    int as0, as1, bs0, bs1;
+    strides(e, as0, as1, bs0, bs1);
+    SerialGemmInternal<ArgMode>::invoke(e.m, e.n, e.k, alpha, e.A, as0, as1, e.B, bs0, bs1, beta, e.C, 1, e.ldc);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &member) const {
+    const entry_type e = entries(perm(begin + member.league_rank()));
+    int as0, as1, bs0, bs1;
+    strides(e, as0, as1, bs0, bs1);
+    TeamVectorGemmInternal<Algo::Gemm::Unblocked>::invoke(member, e.m, e.n, e.k, alpha, e.A, as0, as1, e.B, bs0, bs1,
+                                                          beta, e.C, 1, e.ldc);
+  }
+};
+
+template <typename ArgTransA, typename ArgTransB, typename BatchedGemmHandleType, typename ScalarType,
+          typename EntryViewType>
+int BatchedGemmVBatchedImpl(BatchedGemmHandleType *const handle, const ScalarType alpha, const EntryViewType &entries,
+                            const ScalarType beta) {
+  static_assert(Kokkos::is_view<EntryViewType>::value, "EntryViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(EntryViewType::rank) == 1, "EntryViewType must have rank 1.");
+  static_assert(std::is_same<ArgTransA, Trans::NoTranspose>::value || std::is_same<ArgTransA, Trans::Transpose>::value,
+                "ArgTransA must be either Trans::Transpose or Trans::NoTranspose.");
+  static_assert(std::is_same<ArgTransB, Trans::NoTranspose>::value || std::is_same<ArgTransB, Trans::Transpose>::value,
+                "ArgTransB must be either Trans::Transpose or Trans::NoTranspose.");
+
+  using exec_space        = typename EntryViewType::execution_space;
+  using index_view_type   = Kokkos::View<int *, typename EntryViewType::device_type>;
+  constexpr bool on_gpu   = KokkosKernels::Impl::is_gpu_exec_space_v<exec_space>;
+  constexpr bool on_a64fx = KokkosKernels::Impl::kk_is_a64fx_mem_space<typename exec_space::memory_space>();
+  // Same mode selection as the SQUARE heuristic of BatchedGemm for scalars
+  using serial_mode_type = std::conditional_t<on_gpu || on_a64fx, Algo::Gemm::Unblocked, Algo::Gemm::Blocked>;
+
+  // AUTO uses the SQUARE heuristic; the decision table covers uniform batches
+  const bool heuristic = handle->get_kernel_algo_type() == BaseHeuristicAlgos::SQUARE ||
+                         handle->get_kernel_algo_type() == BaseHeuristicAlgos::AUTO;
+  const int algo_type  = heuristic ? BaseHeuristicAlgos::SQUARE : handle->get_kernel_algo_type();
+  if (algo_type != BaseHeuristicAlgos::SQUARE && algo_type != BaseKokkosBatchedAlgos::KK_SERIAL &&
+      algo_type != GemmKokkosBatchedAlgos::KK_TEAMVECTOR) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedGemmVBatched does not support kernelAlgoType = " << std::to_string(algo_type) << "."
+       << std::endl;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Bin the entries by shape on the host
+  auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  std::map<std::array<int, 3>, std::vector<int>> bins;
+  for (size_t i = 0; i < h_entries.extent(0); ++i) {
+    const auto &e = h_entries(i);
+    if (e.m > 0 && e.n > 0) bins[{e.m, e.n, e.k}].push_back(static_cast<int>(i));
+  }
+  if (bins.empty()) return 0;
+
+  index_view_type perm(Kokkos::view_alloc(Kokkos::WithoutInitializing, "BatchedGemmVBatched::perm"),
+                       h_entries.extent(0));
+  auto h_perm = Kokkos::create_mirror_view(perm);
+  int count   = 0;
+  for (const auto &bin : bins) {
+    for (const int i : bin.second) h_perm(count++) = i;
+  }
+  Kokkos::deep_copy(perm, h_perm);
+
+  if (handle->enableDebug) {
+    std::cout << "BatchedGemmVBatched: " << bins.size() << " bins" << std::endl;
+  }
+
+  int begin = 0;
+  for (const auto &bin : bins) {
+    const int m          = bin.first[0];
+    const int n          = bin.first[1];
+    const int bin_size   = static_cast<int>(bin.second.size());
+    const bool use_teams = algo_type == GemmKokkosBatchedAlgos::KK_TEAMVECTOR ||
+                           (algo_type == BaseHeuristicAlgos::SQUARE && on_gpu &&
+                            m * n >= kk_gemm_vbatched_team_min_mn<exec_space>());
+    if (use_teams) {
+      using functor_type = BatchedVBatchedGemmFunctor<ArgTransA, ArgTransB, Algo::Gemm::Unblocked, ScalarType,
+                                                      EntryViewType, index_view_type>;
+      using policy_type  = Kokkos::TeamPolicy<exec_space>;
+      functor_type functor(alpha, entries, beta, perm, begin);
+      if (handle->teamSz && handle->vecLen)
+        Kokkos::parallel_for("BatchedGemmVBatched::TeamVector", policy_type(bin_size, handle->teamSz, handle->vecLen),
+                             functor);
+      else
+        Kokkos::parallel_for("BatchedGemmVBatched::TeamVector", policy_type(bin_size, Kokkos::AUTO, Kokkos::AUTO),
+                             functor);
+    } else if (algo_type == BaseKokkosBatchedAlgos::KK_SERIAL) {
+      using functor_type = BatchedVBatchedGemmFunctor<ArgTransA, ArgTransB, Algo::Gemm::Unblocked, ScalarType,
+                                                      EntryViewType, index_view_type>;
+      Kokkos::parallel_for("BatchedGemmVBatched::Serial", Kokkos::RangePolicy<exec_space>(0, bin_size),
+                           functor_type(alpha, entries, beta, perm, begin));
+    } else {
+      using functor_type = BatchedVBatchedGemmFunctor<ArgTransA, ArgTransB, serial_mode_type, ScalarType,
+                                                      EntryViewType, index_view_type>;
+      Kokkos::parallel_for("BatchedGemmVBatched::Serial", Kokkos::RangePolicy<exec_space>(0, bin_size),
+                           functor_type(alpha, entries, beta, perm, begin));
+    }
+    begin += bin_size;
+  }
+  return 0;
+}
+}  // namespace Impl
+}  // namespace KokkosBatched
+#endif  // KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_IMPL_HPP
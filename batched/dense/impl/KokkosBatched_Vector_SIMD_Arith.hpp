@@ -35,6 +35,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator+(const Vector<SI
   return _mm512_add_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator+(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_add_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator+(
@@ -51,6 +57,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator+(const Vector<SI
   return _mm256_add_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator+(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  return _mm256_add_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator+(
@@ -62,6 +74,37 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    operator+(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+              const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svadd_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    operator+(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+              const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svadd_f32_x(svptrue_b32(), a, b);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator+(const Vector<SIMD<double>, 4> &a,
+                                                                 const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vaddq_f64(aa.val[0], bb.val[0]), vaddq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator+(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vaddq_f32(aa.val[0], bb.val[0]), vaddq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator+(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -211,6 +254,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator-(const Vector<SI
   return _mm512_sub_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator-(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_sub_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator-(
@@ -227,6 +276,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(const Vector<SI
   return _mm256_sub_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator-(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  return _mm256_sub_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator-(
@@ -238,6 +293,37 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    operator-(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+              const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svsub_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    operator-(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+              const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svsub_f32_x(svptrue_b32(), a, b);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(const Vector<SIMD<double>, 4> &a,
+                                                                 const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vsubq_f64(aa.val[0], bb.val[0]), vsubq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator-(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vsubq_f32(aa.val[0], bb.val[0]), vsubq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator-(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -398,6 +484,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator*(const Vector<SI
   return _mm512_mul_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator*(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_mul_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator*(
@@ -427,6 +519,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator*(const Vector<SI
   return _mm256_mul_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator*(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  return _mm256_mul_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static Vector<SIMD<Kokkos::complex<double> >, 2> operator*(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
@@ -444,6 +542,37 @@ static Vector<SIMD<Kokkos::complex<double> >, 2> operator*(const Vector<SIMD<Kok
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    operator*(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+              const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svmul_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    operator*(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+              const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svmul_f32_x(svptrue_b32(), a, b);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator*(const Vector<SIMD<double>, 4> &a,
+                                                                 const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vmulq_f64(aa.val[0], bb.val[0]), vmulq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator*(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vmulq_f32(aa.val[0], bb.val[0]), vmulq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator*(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -628,6 +757,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator/(const Vector<SI
   return _mm512_div_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator/(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_div_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator/(
@@ -665,6 +800,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator/(const Vector<SI
   return _mm256_div_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator/(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  return _mm256_div_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator/(
@@ -686,6 +827,37 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    operator/(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+              const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svdiv_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    operator/(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+              const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svdiv_f32_x(svptrue_b32(), a, b);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator/(const Vector<SIMD<double>, 4> &a,
+                                                                 const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vdivq_f64(aa.val[0], bb.val[0]), vdivq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator/(const Vector<SIMD<float>, 8> &a,
+                                                                const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vdivq_f32(aa.val[0], bb.val[0]), vdivq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator/(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -43,6 +43,125 @@ KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l) sqrt(con
   return r_val;
 }
 
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 8)
+    sqrt(const Vector<SIMD<double>, 8> &a) {
+  return _mm512_sqrt_pd(a);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 16)
+    sqrt(const Vector<SIMD<float>, 16> &a) {
+  return _mm512_sqrt_ps(a);
+}
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    sqrt(const Vector<SIMD<double>, 4> &a) {
+  return _mm256_sqrt_pd(a);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8) sqrt(const Vector<SIMD<float>, 8> &a) {
+  return _mm256_sqrt_ps(a);
+}
+#endif
+#endif
+
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    sqrt(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a) {
+  return svsqrt_f64_x(svptrue_b64(), a);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    sqrt(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a) {
+  return svsqrt_f32_x(svptrue_b32(), a);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    sqrt(const Vector<SIMD<double>, 4> &a) {
+  const float64x2x2_t aa = a;
+  return float64x2x2_t{{vsqrtq_f64(aa.val[0]), vsqrtq_f64(aa.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8) sqrt(const Vector<SIMD<float>, 8> &a) {
+  const float32x4x2_t aa = a;
+  return float32x4x2_t{{vsqrtq_f32(aa.val[0]), vsqrtq_f32(aa.val[1])}};
+}
+#endif
+
+// a * b + c, with a single rounding where the instruction set has fused
+// multiply-add
+template <typename T, int l>
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l)
+    fma(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b, const Vector<SIMD<T>, l> &c) {
+  Vector<SIMD<T>, l> r_val;
+#if defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
+#pragma ivdep
+#endif
+#if defined(KOKKOS_ENABLE_PRAGMA_VECTOR)
+#pragma vector always
+#endif
+  for (int i = 0; i < l; ++i) r_val[i] = a[i] * b[i] + c[i];
+
+  return r_val;
+}
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 8)
+    fma(const Vector<SIMD<double>, 8> &a, const Vector<SIMD<double>, 8> &b, const Vector<SIMD<double>, 8> &c) {
+  return _mm512_fmadd_pd(a, b, c);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 16)
+    fma(const Vector<SIMD<float>, 16> &a, const Vector<SIMD<float>, 16> &b, const Vector<SIMD<float>, 16> &c) {
+  return _mm512_fmadd_ps(a, b, c);
+}
+#endif
+#if defined(__FMA__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    fma(const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b, const Vector<SIMD<double>, 4> &c) {
+  return _mm256_fmadd_pd(a, b, c);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8)
+    fma(const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b, const Vector<SIMD<float>, 8> &c) {
+  return _mm256_fmadd_ps(a, b, c);
+}
+#endif
+#endif
+
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    fma(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+        const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b,
+        const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &c) {
+  return svmla_f64_x(svptrue_b64(), c, a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    fma(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+        const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b,
+        const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &c) {
+  return svmla_f32_x(svptrue_b32(), c, a, b);
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    fma(const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b, const Vector<SIMD<double>, 4> &c) {
+  const float64x2x2_t aa = a, bb = b, cc = c;
+  return float64x2x2_t{{vfmaq_f64(cc.val[0], aa.val[0], bb.val[0]), vfmaq_f64(cc.val[1], aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8)
+    fma(const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b, const Vector<SIMD<float>, 8> &c) {
+  const float32x4x2_t aa = a, bb = b, cc = c;
+  return float32x4x2_t{{vfmaq_f32(cc.val[0], aa.val[0], bb.val[0]), vfmaq_f32(cc.val[1], aa.val[1], bb.val[1])}};
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l) cbrt(const Vector<SIMD<T>, l> &a) {
   typedef Kokkos::ArithTraits<T> ats;
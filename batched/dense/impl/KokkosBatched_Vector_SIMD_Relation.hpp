@@ -41,6 +41,33 @@ KOKKOSBATCHED_RELATION_OPERATOR(>=)
 KOKKOSBATCHED_RELATION_OPERATOR(==)
 KOKKOSBATCHED_RELATION_OPERATOR(!=)
 
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__) && defined(__AVX512F__)
+// AVX-512 compares all lanes into a mask register in one instruction
+#undef KOKKOSBATCHED_RELATION_OPERATOR
+#define KOKKOSBATCHED_RELATION_OPERATOR(op, T, l, cmp, pred)                                    \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, l> operator op(const Vector<SIMD<T>, l> &a,   \
+                                                                 const Vector<SIMD<T>, l> &b) { \
+    const auto mask = cmp(a, b, pred);                                                          \
+    Vector<SIMD<bool>, l> r_val;                                                                \
+    for (int i = 0; i < l; ++i) r_val[i] = (mask >> i) & 1;                                     \
+    return r_val;                                                                               \
+  }
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, double, 8, _mm512_cmp_pd_mask, _CMP_LT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>, double, 8, _mm512_cmp_pd_mask, _CMP_GT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, double, 8, _mm512_cmp_pd_mask, _CMP_LE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, double, 8, _mm512_cmp_pd_mask, _CMP_GE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(==, double, 8, _mm512_cmp_pd_mask, _CMP_EQ_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, double, 8, _mm512_cmp_pd_mask, _CMP_NEQ_UQ)
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, float, 16, _mm512_cmp_ps_mask, _CMP_LT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>, float, 16, _mm512_cmp_ps_mask, _CMP_GT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, float, 16, _mm512_cmp_ps_mask, _CMP_LE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, float, 16, _mm512_cmp_ps_mask, _CMP_GE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(==, float, 16, _mm512_cmp_ps_mask, _CMP_EQ_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, float, 16, _mm512_cmp_ps_mask, _CMP_NEQ_UQ)
+#endif
+
 // vector, scalar
 #undef KOKKOSBATCHED_RELATION_OPERATOR
 #define KOKKOSBATCHED_RELATION_OPERATOR(op)                                                                   \
@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBATCHED_FIXED_DECL_HPP
+#define KOKKOSBATCHED_FIXED_DECL_HPP
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+// clang-format off
+/// \brief Serial Gemm, LU, Trsm and SolveLU on small matrices whose dimensions
+/// are compile time constants.
+///
+/// All loops have constant trip counts, so the compiler can fully unroll them
+/// and keep the matrix being updated in registers: the kernels load it into a
+/// local array, update it and store it back. There are no remainder loops.
+/// The results are the same as those of the Algo::*::Unblocked kernels.
+///
+/// \tparam M, N, K   The dimensions, used by each kernel as:
+///                     gemm      C is M x N, op(A) is M x K and op(B) is K x N
+///                     lu        A is M x N
+///                     trsm      A is M x M and B is M x N (left side)
+///                     solve_lu  A is M x M and B is M x N
+///
+/// The extents of the views must match; they are only checked when
+/// KOKKOSKERNELS_DEBUG_LEVEL > 0. Each instance is meant for one block size
+/// known at compile time; FixedDispatch maps runtime sizes onto instances.
+///
+/// Usage Example:
+///   Fixed<5>::lu(A);
+///   Fixed<5, 1>::solve_lu<Trans::NoTranspose>(A, b);
+// clang-format on
+template <int M, int N = M, int K = N>
+struct Fixed {
+  static_assert(M > 0 && N > 0 && K > 0, "KokkosBatched::Fixed: the dimensions must be positive.");
+
+  /// C = beta * C + alpha * op(A) * op(B), with op Trans::NoTranspose or Trans::Transpose
+  template <typename ArgTransA, typename ArgTransB, typename ScalarType, typename AViewType, typename BViewType,
+            typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int gemm(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                                         const ScalarType beta, const CViewType &C);
+
+  /// LU factorization without pivoting of A, in place
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int lu(
+      const AViewType &A, const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+
+  /// B = alpha * inv(op(A)) * B, with A triangular
+  template <typename ArgUplo, typename ArgTrans, typename ArgDiag, typename ScalarType, typename AViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int trsm(const ScalarType alpha, const AViewType &A, const BViewType &B);
+
+  /// B = inv(op(A)) * B, with A holding the factors computed by lu
+  template <typename ArgTrans, typename AViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int solve_lu(const AViewType &A, const BViewType &B);
+};
+
+// clang-format off
+/// \brief Runtime sized entry points to Fixed.
+///
+/// Square matrices of size min_size to max_size (and a single right hand
+/// side or column of B and C) are computed by the matching Fixed instance;
+/// other shapes, and Trans::ConjTranspose, fall back to the Algo::*::Unblocked
+/// serial kernels. Only 2 * (max_size - min_size + 1) instances are compiled
+/// per kernel.
+///
+/// Usage Example:
+///   FixedDispatch::lu(A);                                  // A is n x n
+///   FixedDispatch::solve_lu<Trans::NoTranspose>(A, B);     // B is n x n or n x 1
+///   FixedDispatch::dispatch(n, [&](auto size) {
+///     constexpr int Size = decltype(size)::value;
+///     ...
+///   });
+// clang-format on
+struct FixedDispatch {
+  static constexpr int min_size = 2;
+  static constexpr int max_size = 16;
+
+  /// Calls f(std::integral_constant<int, n>()) if min_size <= n <= max_size.
+  /// \return true if f was called
+  template <typename FunctorType>
+  KOKKOS_INLINE_FUNCTION static bool dispatch(const int n, const FunctorType &f);
+
+  template <typename ArgTransA, typename ArgTransB, typename ScalarType, typename AViewType, typename BViewType,
+            typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int gemm(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                                         const ScalarType beta, const CViewType &C);
+
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int lu(
+      const AViewType &A, const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+
+  template <typename ArgUplo, typename ArgTrans, typename ArgDiag, typename ScalarType, typename AViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int trsm(const ScalarType alpha, const AViewType &A, const BViewType &B);
+
+  template <typename ArgTrans, typename AViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int solve_lu(const AViewType &A, const BViewType &B);
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Fixed_Serial_Impl.hpp"
+
+#endif
@@ -17,6 +17,12 @@
 #ifndef KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP
 #define KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP
 
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
 #include "KokkosBatched_Kernel_Handle.hpp"
 
 namespace KokkosBatched {
@@ -45,6 +51,154 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
       "GemmKokkosBatchedAlgos::KK_TEAMVECTOR", "GemmKokkosBatchedAlgos::KK_SERIALSIMD", \
       "GemmKokkosBatchedAlgos::KK_TEAMSIMD", "GemmKokkosBatchedAlgos::KK_SERIAL_RANK0", \
       "GemmKokkosBatchedAlgos::KK_SERIAL_SHMEM", "GemmKokkosBatchedAlgos::KK_DBLBUF"
+/// \brief Decision table used by BatchedGemm with BaseHeuristicAlgos::AUTO.
+///
+/// Each rule maps an execution space, a scalar type, a BatchLayout, a range
+/// of matrix sizes and a range of batch sizes to one of the algorithms
+/// KK_SERIAL, KK_SERIAL_RANK0 or KK_DBLBUF. The rules are tried in order and
+/// the first match wins; if none matches, the built-in rules for host or GPU
+/// execution spaces are tried. KK_DBLBUF rules are skipped on host execution
+/// spaces, where BatchedGemm only has the untuned 1x1x1 tiles for it.
+///
+/// The rules can be saved to and loaded from a text file with one rule per
+/// line:
+///
+///   space scalar layout max_dim max_batch algo
+///
+/// where space is ExecutionSpace::name(), scalar is
+/// Kokkos::ArithTraits<Scalar>::name(), layout is Left or Right, max_dim
+/// bounds max(m, n) of C and max_batch bounds the batch size. Any field but
+/// algo can be '*' to match everything. Lines starting with '#' are ignored.
+/// The KokkosBatched_BatchedGemm_tune perf test measures the algorithms on the
+/// local machine and writes such a file.
+class BatchedGemmTuningTable {
+ public:
+  struct Rule {
+    std::string space, scalar, layout;
+    int max_dim, max_batch;  // -1 for no bound
+    int algo;
+  };
+
+  std::vector<Rule> rules;
+
+  /// \brief The algorithm of the first matching rule, or -1
+  int select(const std::string &space, const std::string &scalar, const std::string &layout, const int dim,
+             const int batch, const bool on_gpu, const bool debug = false) const {
+    for (const Rule &r : rules) {
+      if (!matches(r, space, scalar, layout, dim, batch)) continue;
+      if (r.algo == GemmKokkosBatchedAlgos::KK_DBLBUF && !on_gpu) {
+        if (debug) {
+          std::cout << "BatchedGemmTuningTable: skipping the KK_DBLBUF rule \"" << r.space << " " << r.scalar << " "
+                    << r.layout << " " << bound_str(r.max_dim) << " " << bound_str(r.max_batch)
+                    << "\" on host execution space " << space << std::endl;
+        }
+        continue;
+      }
+      return r.algo;
+    }
+    for (const Rule &r : builtin_rules(on_gpu))
+      if (matches(r, space, scalar, layout, dim, batch)) return r.algo;
+    return -1;
+  }
+
+  /// \brief Built-in rules. On GPUs, they follow the SQUARE heuristic of
+  /// BatchedGemm. On host, each thread computes whole matrices, unless there
+  /// are too few large matrices to keep the threads busy.
+  static const std::vector<Rule> &builtin_rules(const bool on_gpu) {
+    using namespace GemmKokkosBatchedAlgos;
+    static const std::vector<Rule> gpu_rules = {
+        {"*", "*", "Right", 15, -1, KK_SERIAL_RANK0}, {"*", "*", "Right", -1, -1, KK_DBLBUF},
+        {"*", "*", "Left", 23, -1, KK_SERIAL_RANK0},  {"*", "*", "Left", 32, -1, KK_DBLBUF},
+        {"*", "*", "Left", 39, -1, KK_SERIAL_RANK0},  {"*", "*", "Left", -1, -1, KK_DBLBUF}};
+    static const std::vector<Rule> host_rules = {{"*", "*", "*", 63, -1, BaseKokkosBatchedAlgos::KK_SERIAL},
+                                                 {"*", "*", "*", -1, 8, KK_SERIAL_RANK0},
+                                                 {"*", "*", "*", -1, -1, BaseKokkosBatchedAlgos::KK_SERIAL}};
+    return on_gpu ? gpu_rules : host_rules;
+  }
+
+  /// \brief Read rules from a file and put them before the current rules
+  void load(const std::string &filename) {
+    std::ifstream file(filename);
+    if (!file) {
+      KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: cannot open " + filename);
+    }
+    std::vector<Rule> loaded;
+    std::string line;
+    while (std::getline(file, line)) {
+      std::istringstream is(line);
+      std::string space, scalar, layout, max_dim, max_batch, algo;
+      if (!(is >> space) || space[0] == '#') continue;
+      if (!(is >> scalar >> layout >> max_dim >> max_batch >> algo)) {
+        KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: invalid rule \"" + line +
+                                                     "\" in " + filename);
+      }
+      loaded.push_back(
+          {space, scalar, layout, bound(max_dim, line, filename), bound(max_batch, line, filename), algo_type(algo)});
+    }
+    rules.insert(rules.begin(), loaded.begin(), loaded.end());
+  }
+
+  /// \brief Write the rules (not the built-in ones) to a file
+  void save(const std::string &filename) const {
+    std::ofstream file(filename);
+    if (!file) {
+      KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: cannot write " + filename);
+    }
+    file << "# space scalar layout max_dim max_batch algo" << std::endl;
+    for (const Rule &r : rules) {
+      file << r.space << " " << r.scalar << " " << r.layout << " " << bound_str(r.max_dim) << " "
+           << bound_str(r.max_batch) << " " << algo_str(r.algo) << std::endl;
+    }
+  }
+
+ private:
+  static bool matches(const Rule &r, const std::string &space, const std::string &scalar, const std::string &layout,
+                      const int dim, const int batch) {
+    return (r.space == "*" || r.space == space) && (r.scalar == "*" || r.scalar == scalar) &&
+           (r.layout == "*" || r.layout == layout) && (r.max_dim < 0 || dim <= r.max_dim) &&
+           (r.max_batch < 0 || batch <= r.max_batch);
+  }
+
+  static const char *const *algo_strs() {
+    static const char *strs[GemmKokkosBatchedAlgos::N] = {BASE_ALGO_STRS, GEMM_ALGO_STRS};
+    return strs;
+  }
+
+  static int algo_type(const std::string &name) {
+    for (int algo : {(int)BaseKokkosBatchedAlgos::KK_SERIAL, (int)GemmKokkosBatchedAlgos::KK_SERIAL_RANK0,
+                     (int)GemmKokkosBatchedAlgos::KK_DBLBUF}) {
+      if (name == algo_strs()[algo]) return algo;
+    }
+    KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: unsupported algorithm " +
+                                                 name);
+    return -1;
+  }
+
+  static const char *algo_str(const int algo) {
+    if (algo != BaseKokkosBatchedAlgos::KK_SERIAL && algo != GemmKokkosBatchedAlgos::KK_SERIAL_RANK0 &&
+        algo != GemmKokkosBatchedAlgos::KK_DBLBUF) {
+      KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: unsupported algorithm " +
+                                                   std::to_string(algo));
+    }
+    return algo_strs()[algo];
+  }
+
+  static int bound(const std::string &s, const std::string &line, const std::string &filename) {
+    if (s == "*") return -1;
+    try {
+      size_t pos;
+      const int b = std::stoi(s, &pos);
+      if (pos == s.size()) return b;
+    } catch (const std::logic_error &) {
+      // std::invalid_argument or std::out_of_range, reported below
+    }
+    KokkosKernels::Impl::throw_runtime_exception("KokkosBatched::BatchedGemmTuningTable: invalid rule \"" + line +
+                                                 "\" in " + filename);
+    return -1;
+  }
+  static std::string bound_str(const int b) { return b < 0 ? "*" : std::to_string(b); }
+};
+
 // clang-format off
 /// \brief Handle for selecting runtime behavior of the BatchedGemm interface.
 ///
@@ -55,6 +209,10 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
 ///                          SQUARE select invocations based on square matrix heuristics where M=N
 ///                          TALL   select invocations based on tall   matrix heuristics where M>N
 ///                          WIDE   select invocations based on wide   matrix heuristics where M<N
+///                          AUTO   select KK_SERIAL, KK_SERIAL_RANK0 or KK_DBLBUF (with tuned tiles)
+///                                 from the execution space, scalar type, BatchLayout, matrix size
+///                                 and batch size, with the rules of tuningTable.
+///                                 See BatchedGemmTuningTable for details.
 ///    
 ///                        Specifies which cmake-enabled TPL algorithm to invoke:
 ///                          ARMPL    Invoke the ArmPL TPL interface  (Currently UNSUPPORTED)
@@ -89,11 +247,21 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
 ///                    uses TeamPolicy and Kokkos::ThreadVectorRange or Kokkos::TeamVectorRange
 ///                    (default, Kokkos::AUTO).
 ///                    Note: Only applied if useAlgo_type == KK_*
+///
+/// With kernelAlgoType AUTO, the rules in the file named by the environment
+/// variable KOKKOSKERNELS_BATCHED_GEMM_TUNING_FILE, if set, are loaded into
+/// tuningTable when the handle is created.
 // clang-format on
 class BatchedGemmHandle : public BatchedKernelHandle {
  public:
+  BatchedGemmTuningTable tuningTable;
+
   BatchedGemmHandle(int kernelAlgoType = BaseHeuristicAlgos::SQUARE, int teamSize = 0, int vecLength = 0)
       : BatchedKernelHandle(kernelAlgoType, teamSize, vecLength) {
+    if (kernelAlgoType == BaseHeuristicAlgos::AUTO) {
+      const char *tuning_file = std::getenv("KOKKOSKERNELS_BATCHED_GEMM_TUNING_FILE");
+      if (tuning_file && tuning_file[0]) tuningTable.load(tuning_file);
+    }
 #if defined(KOKKOSKERNELS_ENABLE_TPL_CUBLAS)
     if (!_tplParamsSet && kernelAlgoType == GemmTplAlgos::CUBLAS) {
       static cublasHandle_t cublas_handle;
@@ -0,0 +1,83 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_DECL_HPP
+#define KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_DECL_HPP
+
+#include "KokkosBatched_HostLevel_Gemm_VBatched_Impl.hpp"
+
+namespace KokkosBatched {
+/// \brief One entry of a variable size batch for BatchedGemmVBatched:
+///   C = alpha * op(A) * op(B) + beta * C, where C is m x n and op(A) is
+///   m x k.
+///
+/// A, B and C point to column-major matrices with leading dimensions lda,
+/// ldb and ldc (the stride between two columns). Entries may point into
+/// separate allocations, or into one allocation at arbitrary offsets.
+template <typename ValueType>
+struct GemmVBatchedEntry {
+  int m = 0, n = 0, k = 0;
+  const ValueType *A = nullptr;
+  int lda            = 0;
+  const ValueType *B = nullptr;
+  int ldb            = 0;
+  ValueType *C       = nullptr;
+  int ldc            = 0;
+};
+
+// clang-format off
+/// \brief General matrix multiply on a batch of matrices of different sizes
+/// ("vbatched"), given as an array of pointers.
+///
+///        C_i = alpha * op(A_i) * op(B_i) + beta * C_i
+///
+/// The entries are binned by (m, n, k) on the host, and each bin is computed
+/// by one kernel launch, so that no matrix is padded or copied. Entries with
+/// m or n equal to 0 are skipped. The binning copies the shapes to the host
+/// and the bins back to the device, which synchronizes with the execution
+/// space; only the kernel launches of the bins are non-blocking.
+///
+/// \tparam ArgTransA      Specifies what op does to A:
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam ArgTransB      Specifies what op does to B:
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam EntryViewType  Rank-1 Kokkos::View of GemmVBatchedEntry<ValueType>
+///
+/// \param handle [in]     A handle which specifies how to invoke the batched
+///                        gemm. Supported kernelAlgoTypes:
+///                          SQUARE, AUTO  Select the kernel of each bin from its size:
+///                                        TeamVectorGemm per entry on GPUs for larger
+///                                        matrices, SerialGemm per entry otherwise
+///                          KK_SERIAL     SerialGemm per entry via RangePolicy
+///                          KK_TEAMVECTOR TeamVectorGemm per entry via TeamPolicy
+/// \param alpha [in]      Input coefficient used for multiplication with A
+/// \param entries [in]    The entries of the batch. The shapes are copied to
+///                        the host to bin the entries.
+/// \param beta [in]       Input coefficient used for multiplication with C
+/// \return 0 upon success, non-zero otherwise
+///
+/// Usage Example:
+///   BatchedGemmVBatched<ArgTransA, ArgTransB>(handle, alpha, entries, beta);
+// clang-format on
+template <typename ArgTransA, typename ArgTransB, typename BatchedGemmHandleType, typename ScalarType,
+          typename EntryViewType>
+inline int BatchedGemmVBatched(BatchedGemmHandleType *const handle, const ScalarType alpha,
+                               const EntryViewType &entries, const ScalarType beta) {
+  return Impl::BatchedGemmVBatchedImpl<ArgTransA, ArgTransB>(handle, alpha, entries, beta);
+}
+}  // namespace KokkosBatched
+#endif  // KOKKOSBATCHED_HOSTLEVEL_GEMM_VBATCHED_DECL_HPP
@@ -42,7 +42,7 @@ namespace KokkosBatched {
 
 /// \brief Heuristic algorithm types. See BatchedKernelHandle for details.
 namespace BaseHeuristicAlgos {
-enum BASE_HEURISTIC_ALGOS : int { SQUARE = 0, TALL, WIDE, N };
+enum BASE_HEURISTIC_ALGOS : int { SQUARE = 0, TALL, WIDE, AUTO, N };
 }
 
 /// \brief Tpl algorithm types. See BatchedKernelHandle for details.
@@ -56,9 +56,9 @@ enum BASE_KOKKOS_BATCHED_ALGOS : int { KK_SERIAL = BaseTplAlgos::N, N };
 }
 
 #define N_BASE_ALGOS BaseKokkosBatchedAlgos::N
-#define BASE_ALGO_STRS                                                                                         \
-  "BaseHeuristicAlgos::SQUARE", "BaseHeuristicAlgos::TALL", "BaseHeuristicAlgos::WIDE", "BaseTplAlgos::ARMPL", \
-      "BaseTplAlgosMKL", "BaseKokkosBatchedAlgos::KK_SERIAL"
+#define BASE_ALGO_STRS                                                                                            \
+  "BaseHeuristicAlgos::SQUARE", "BaseHeuristicAlgos::TALL", "BaseHeuristicAlgos::WIDE", "BaseHeuristicAlgos::AUTO", \
+      "BaseTplAlgos::ARMPL", "BaseTplAlgosMKL", "BaseKokkosBatchedAlgos::KK_SERIAL"
 
 /// \brief TplParams abstracts underlying handle or execution queue type.
 struct TplParams {
@@ -95,6 +95,8 @@ struct TplParams {
 ///                          SQUARE select invocations based on square matrix heuristics where M=N
 ///                          TALL   select invocations based on tall   matrix heuristics where M>N
 ///                          WIDE   select invocations based on wide   matrix heuristics where M<N
+///                          AUTO   select invocations from a decision table of the routine, see
+///                                 each routine's handle for details
 ///                        Note: If the heuristics indicate SIMD views are required for optimal
 ///                              performance, notify the user that SIMD views are required for
 ///                              optimal performance.
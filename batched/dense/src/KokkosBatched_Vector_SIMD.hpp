@@ -24,9 +24,18 @@
 
 #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
 #undef __KOKKOSBATCHED_ENABLE_AVX__
+#undef __KOKKOSBATCHED_ENABLE_SVE__
+#undef __KOKKOSBATCHED_ENABLE_NEON__
 #else
 // compiler bug with AVX in some architectures
 #define __KOKKOSBATCHED_ENABLE_AVX__
+// SVE types can be stored in a class only when the vector length is fixed at
+// compile time (-msve-vector-bits); otherwise NEON is used on AArch64
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && (__ARM_FEATURE_SVE_BITS >= 256)
+#define __KOKKOSBATCHED_ENABLE_SVE__
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define __KOKKOSBATCHED_ENABLE_NEON__
+#endif
 #endif
 
 namespace KokkosBatched {
@@ -87,6 +96,20 @@ class Vector<SIMD<T>, l> {
   KOKKOS_INLINE_FUNCTION
   void storeUnaligned(value_type *p) const { storeAligned(p); }
 
+  // the first n (0 <= n <= vector_length) values of p, and zeros in the
+  // remaining lanes, for the tail of an array that does not fill a vector
+  KOKKOS_INLINE_FUNCTION
+  type &loadMasked(const value_type *p, const int n) {
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) _data[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeMasked(value_type *p, const int n) const {
+    for (int i = 0; i < n; ++i) p[i] = _data[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return _data[i]; }
 };
@@ -180,6 +203,17 @@ class Vector<SIMD<float>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadMasked(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeMasked(value_type *p, const int n) const {
+    for (int i = 0; i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -269,6 +303,17 @@ class Vector<SIMD<double>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadMasked(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeMasked(value_type *p, const int n) const {
+    for (int i = 0; i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -380,6 +425,17 @@ class Vector<SIMD<float>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadMasked(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeMasked(value_type *p, const int n) const {
+    for (int i = 0; i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -491,6 +547,17 @@ class Vector<SIMD<double>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadMasked(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeMasked(value_type *p, const int n) const {
+    for (int i = 0; i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -569,6 +636,91 @@ class Vector<SIMD<double>, 4> {
 
   inline void storeUnaligned(value_type *p) const { _mm256_storeu_pd(p, _data); }
 
+  inline type &loadMasked(const value_type *p, const int n) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    for (int i = 0; i < vector_length; ++i) d[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    auto d = reinterpret_cast<const value_type *>(&_data);
+    for (int i = 0; i < n; ++i) p[i] = d[i];
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, 8> {
+ public:
+  using type       = Vector<SIMD<float>, 8>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 8 };
+  typedef __m256 data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "AVX256"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = _mm256_setzero_ps(); }
+  inline Vector(const value_type &val) { _data = _mm256_set1_ps(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const __m256 &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const __m256 &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator __m256() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = _mm256_load_ps(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = _mm256_loadu_ps(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { _mm256_store_ps(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { _mm256_storeu_ps(p, _data); }
+
+  inline type &loadMasked(const value_type *p, const int n) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    for (int i = 0; i < vector_length; ++i) d[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    auto d = reinterpret_cast<const value_type *>(&_data);
+    for (int i = 0; i < n; ++i) p[i] = d[i];
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 
@@ -644,6 +796,17 @@ class Vector<SIMD<Kokkos::complex<double> >, 2> {
 
   inline void storeUnaligned(value_type *p) const { _mm256_storeu_pd((mag_type *)p, _data); }
 
+  inline type &loadMasked(const value_type *p, const int n) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    for (int i = 0; i < vector_length; ++i) d[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    auto d = reinterpret_cast<const value_type *>(&_data);
+    for (int i = 0; i < n; ++i) p[i] = d[i];
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 }  // namespace KokkosBatched
@@ -716,6 +879,87 @@ class Vector<SIMD<double>, 8> {
 
   inline void storeUnaligned(value_type *p) const { _mm512_storeu_pd(p, _data); }
 
+  inline type &loadMasked(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_pd(__mmask8((1u << n) - 1), p);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    _mm512_mask_storeu_pd(p, __mmask8((1u << n) - 1), _data);
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, 16> {
+ public:
+  using type       = Vector<SIMD<float>, 16>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 16 };
+  typedef __m512 data_type __attribute__((aligned(64)));
+
+  inline static const char *label() { return "AVX512"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = _mm512_setzero_ps(); }
+  inline Vector(const value_type &val) { _data = _mm512_set1_ps(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const __m512 &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const __m512 &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator __m512() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = _mm512_load_ps(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = _mm512_loadu_ps(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { _mm512_store_ps(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { _mm512_storeu_ps(p, _data); }
+
+  inline type &loadMasked(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_ps(__mmask16((1u << n) - 1), p);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    _mm512_mask_storeu_ps(p, __mmask16((1u << n) - 1), _data);
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 
@@ -785,6 +1029,15 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 
   inline void storeUnaligned(value_type *p) const { _mm512_storeu_pd((mag_type *)p, _data); }
 
+  inline type &loadMasked(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_pd(__mmask8((1u << 2 * n) - 1), (const mag_type *)p);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    _mm512_mask_storeu_pd((mag_type *)p, __mmask8((1u << 2 * n) - 1), _data);
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 }  // namespace KokkosBatched
@@ -792,6 +1045,307 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 #endif /* #if defined(__AVX512F__) */
 #endif /* #if defined(__KOKKOSBATCHED_ENABLE_AVX__) */
 
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+#include <arm_sve.h>
+
+namespace KokkosBatched {
+
+template <>
+class Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> {
+ public:
+  using type       = Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 64 };
+  typedef svfloat64_t data_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f64(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const svfloat64_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const svfloat64_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator svfloat64_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f64(svptrue_b64(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const { svst1_f64(svptrue_b64(), p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadMasked(const value_type *p, const int n) {
+    _data = svld1_f64(svwhilelt_b64(0, n), p);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const { svst1_f64(svwhilelt_b64(0, n), p, _data); }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> {
+ public:
+  using type       = Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 32 };
+  typedef svfloat32_t data_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f32(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const svfloat32_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const svfloat32_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator svfloat32_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f32(svptrue_b32(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const { svst1_f32(svptrue_b32(), p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadMasked(const value_type *p, const int n) {
+    _data = svld1_f32(svwhilelt_b32(0, n), p);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const { svst1_f32(svwhilelt_b32(0, n), p, _data); }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+}  // namespace KokkosBatched
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_SVE__) */
+
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#include <arm_neon.h>
+
+namespace KokkosBatched {
+
+// Two 128-bit registers per vector, to match the default vector lengths
+template <>
+class Vector<SIMD<double>, 4> {
+ public:
+  using type       = Vector<SIMD<double>, 4>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = 4 };
+  typedef float64x2x2_t data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data.val[0] = _data.val[1] = vdupq_n_f64(0); }
+  inline Vector(const value_type &val) { _data.val[0] = _data.val[1] = vdupq_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float64x2x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float64x2x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float64x2x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data.val[0] = vld1q_f64(p);
+    _data.val[1] = vld1q_f64(p + 2);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    vst1q_f64(p, _data.val[0]);
+    vst1q_f64(p + 2, _data.val[1]);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  // NEON has no masked loads and stores
+  inline type &loadMasked(const value_type *p, const int n) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    for (int i = 0; i < vector_length; ++i) d[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    auto d = reinterpret_cast<const value_type *>(&_data);
+    for (int i = 0; i < n; ++i) p[i] = d[i];
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, 8> {
+ public:
+  using type       = Vector<SIMD<float>, 8>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 8 };
+  typedef float32x4x2_t data_type __attribute__((aligned(32)));
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data.val[0] = _data.val[1] = vdupq_n_f32(0); }
+  inline Vector(const value_type &val) { _data.val[0] = _data.val[1] = vdupq_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float32x4x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float32x4x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float32x4x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data.val[0] = vld1q_f32(p);
+    _data.val[1] = vld1q_f32(p + 4);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    vst1q_f32(p, _data.val[0]);
+    vst1q_f32(p + 4, _data.val[1]);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  // NEON has no masked loads and stores
+  inline type &loadMasked(const value_type *p, const int n) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    for (int i = 0; i < vector_length; ++i) d[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeMasked(value_type *p, const int n) const {
+    auto d = reinterpret_cast<const value_type *>(&_data);
+    for (int i = 0; i < n; ++i) p[i] = d[i];
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+}  // namespace KokkosBatched
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_NEON__) */
+
 #include "KokkosBatched_Vector_SIMD_Arith.hpp"
 #include "KokkosBatched_Vector_SIMD_Logical.hpp"
 #include "KokkosBatched_Vector_SIMD_Relation.hpp"
@@ -230,7 +230,7 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
             algo_type == GemmKokkosBatchedAlgos::KK_SERIAL_RANK0 || algo_type == GemmKokkosBatchedAlgos::KK_DBLBUF) {
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
-        } else if (algo_type == BaseHeuristicAlgos::SQUARE) {
+        } else if (algo_type == BaseHeuristicAlgos::SQUARE || algo_type == BaseHeuristicAlgos::AUTO) {
           // Invoke 4 times to ensure we cover all paths for alpha and beta
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 0.0, 0.0);
@@ -240,6 +240,15 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 0.0, 1.0);
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+          if (algo_type == BaseHeuristicAlgos::AUTO) {
+            // Force each algorithm of the decision table
+            for (const int algo : {(int)BaseKokkosBatchedAlgos::KK_SERIAL, (int)GemmKokkosBatchedAlgos::KK_SERIAL_RANK0,
+                                   (int)GemmKokkosBatchedAlgos::KK_DBLBUF}) {
+              batchedGemmHandle.tuningTable.rules = {{"*", "*", "*", -1, -1, algo}};
+              impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
+                  &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+            }
+          }
         } else {
           try {
             // Allocate these views to invoke BatchedGemm with an unsupported
@@ -274,6 +283,39 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
 }
 }  // namespace Test
 
+// Rules are matched in order, survive a save and load, and fall back to the
+// built-in rules. KK_DBLBUF rules are skipped on host.
+inline void test_batched_gemm_tuning_table() {
+  using Rule = BatchedGemmTuningTable::Rule;
+  BatchedGemmTuningTable table;
+  table.rules = {Rule{"Serial", "double", "Left", 8, -1, GemmKokkosBatchedAlgos::KK_DBLBUF},
+                 Rule{"Serial", "*", "*", -1, 100, GemmKokkosBatchedAlgos::KK_SERIAL_RANK0}};
+  const std::string filename = "batched_gemm_tuning_table_test.txt";
+  table.save(filename);
+
+  BatchedGemmTuningTable loaded;
+  loaded.load(filename);
+  std::remove(filename.c_str());
+  ASSERT_EQ(loaded.rules.size(), size_t(2));
+  EXPECT_EQ(loaded.select("Serial", "double", "Left", 8, 1000, true), (int)GemmKokkosBatchedAlgos::KK_DBLBUF);
+  EXPECT_EQ(loaded.select("Serial", "double", "Left", 8, 1000, false), (int)BaseKokkosBatchedAlgos::KK_SERIAL);
+  EXPECT_EQ(loaded.select("Serial", "double", "Left", 8, 100, false), (int)GemmKokkosBatchedAlgos::KK_SERIAL_RANK0);
+  EXPECT_EQ(loaded.select("Serial", "double", "Left", 9, 100, false), (int)GemmKokkosBatchedAlgos::KK_SERIAL_RANK0);
+  EXPECT_EQ(loaded.select("Serial", "float", "Left", 8, 100, false), (int)GemmKokkosBatchedAlgos::KK_SERIAL_RANK0);
+  EXPECT_EQ(loaded.select("Serial", "float", "Left", 8, 1000, false), (int)BaseKokkosBatchedAlgos::KK_SERIAL);
+  EXPECT_EQ(loaded.select("OpenMP", "double", "Left", 8, 1000, false), (int)BaseKokkosBatchedAlgos::KK_SERIAL);
+  EXPECT_THROW(loaded.load("batched_gemm_tuning_table_missing.txt"), std::runtime_error);
+
+  // Rules with unsupported algorithms or bounds are rejected
+  table.rules = {Rule{"Serial", "*", "*", -1, -1, GemmKokkosBatchedAlgos::KK_TEAM}};
+  EXPECT_THROW(table.save(filename), std::runtime_error);
+  for (const char *rule : {"Serial * * 8x * KK_SERIAL", "Serial * * * 99999999999 KK_SERIAL"}) {
+    std::ofstream(filename) << rule << std::endl;
+    EXPECT_THROW(loaded.load(filename), std::runtime_error);
+  }
+  std::remove(filename.c_str());
+}
+
 template <typename ViewType, typename DeviceType, typename ValueType, typename ScalarType, typename ParamTagType>
 void test_batched_gemm_with_layout(int N) {
   // Square cases
@@ -317,6 +359,16 @@ void test_batched_gemm_with_layout(int N) {
                                                                                    dimN);
     }
   }
+
+  // Non-square case where only m is a multiple of the tiles of the
+  // BatchedDblBufGemm selected by AUTO on GPUs
+  {
+    constexpr bool transA = std::is_same<typename ParamTagType::transA, KokkosBatched::Trans::Transpose>::value;
+    constexpr bool transB = std::is_same<typename ParamTagType::transB, KokkosBatched::Trans::Transpose>::value;
+    const int dimM = 32, dimN = 20, dimK = 32;
+    Test::impl_test_batched_gemm<DeviceType, ViewType, ScalarType, ParamTagType>(
+        N, transA ? dimK : dimM, transA ? dimM : dimK, transB ? dimN : dimK, transB ? dimK : dimN, dimM, dimN);
+  }
 }
 
 template <typename DeviceType, typename ValueType, typename ScalarType, typename ParamTagType>
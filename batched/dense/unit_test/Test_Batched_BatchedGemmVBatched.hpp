@@ -0,0 +1,144 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosBatched_HostLevel_Gemm_VBatched.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace GemmVBatched {
+
+/// \brief Multiplies a batch of matrices of a few distinct (and some empty)
+/// sizes, stored at arbitrary offsets of one allocation with padded leading
+/// dimensions, and compares with a reference computed on the host.
+template <typename DeviceType, typename ScalarType, typename ArgTransA, typename ArgTransB>
+void impl_test_batched_gemm_vbatched(const int algo_type, const ScalarType alpha, const ScalarType beta) {
+  using execution_space = typename DeviceType::execution_space;
+  using entry_type      = GemmVBatchedEntry<ScalarType>;
+  using ats             = Kokkos::ArithTraits<ScalarType>;
+  using mag_type        = typename ats::mag_type;
+
+  const bool transA = std::is_same<ArgTransA, Trans::Transpose>::value;
+  const bool transB = std::is_same<ArgTransB, Trans::Transpose>::value;
+
+  // m, n, k of the distinct shapes, repeated and interleaved in the batch
+  const int shapes[][3] = {{5, 5, 5}, {3, 7, 4}, {10, 10, 10}, {17, 9, 6}, {0, 4, 3}, {8, 3, 0}, {24, 20, 18}};
+  const int numShapes   = sizeof(shapes) / sizeof(shapes[0]);
+  const int N           = 4 * numShapes;
+
+  // Offsets of each matrix in the allocations; each column is padded by 2
+  std::vector<size_t> offA(N), offB(N), offC(N);
+  size_t sizeA = 0, sizeB = 0, sizeC = 0;
+  for (int i = 0; i < N; ++i) {
+    const int m = shapes[i % numShapes][0], n = shapes[i % numShapes][1], k = shapes[i % numShapes][2];
+    offA[i]     = sizeA;
+    offB[i]     = sizeB;
+    offC[i]     = sizeC;
+    sizeA += size_t(transA ? k + 2 : m + 2) * (transA ? m : k) + 1;
+    sizeB += size_t(transB ? n + 2 : k + 2) * (transB ? k : n) + 1;
+    sizeC += size_t(m + 2) * n + 1;
+  }
+
+  Kokkos::View<ScalarType *, DeviceType> A("A", sizeA), B("B", sizeB), C("C", sizeC);
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(A, random, ScalarType(1.0));
+  Kokkos::fill_random(B, random, ScalarType(1.0));
+  Kokkos::fill_random(C, random, ScalarType(1.0));
+  auto h_A    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto h_B    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto h_Cref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  Kokkos::View<entry_type *, DeviceType> entries("entries", N);
+  auto h_entries = Kokkos::create_mirror_view(entries);
+  for (int i = 0; i < N; ++i) {
+    entry_type &e = h_entries(i);
+    e.m           = shapes[i % numShapes][0];
+    e.n           = shapes[i % numShapes][1];
+    e.k           = shapes[i % numShapes][2];
+    e.lda         = (transA ? e.k : e.m) + 2;
+    e.ldb         = (transB ? e.n : e.k) + 2;
+    e.ldc         = e.m + 2;
+    e.A           = A.data() + offA[i];
+    e.B           = B.data() + offB[i];
+    e.C           = C.data() + offC[i];
+
+    // Reference
+    for (int c = 0; c < e.n; ++c) {
+      for (int r = 0; r < e.m; ++r) {
+        ScalarType sum(0);
+        for (int p = 0; p < e.k; ++p) {
+          const ScalarType a = h_A(offA[i] + (transA ? p + size_t(e.lda) * r : r + size_t(e.lda) * p));
+          const ScalarType b = h_B(offB[i] + (transB ? c + size_t(e.ldb) * p : p + size_t(e.ldb) * c));
+          sum += a * b;
+        }
+        ScalarType &cref = h_Cref(offC[i] + r + size_t(e.ldc) * c);
+        cref             = (beta == ScalarType(0) ? ScalarType(0) : beta * cref) + alpha * sum;
+      }
+    }
+  }
+  Kokkos::deep_copy(entries, h_entries);
+
+  BatchedGemmHandle handle(algo_type);
+  const int ret = BatchedGemmVBatched<ArgTransA, ArgTransB>(&handle, alpha, entries, beta);
+  ASSERT_EQ(ret, 0);
+  Kokkos::fence();
+
+  // The padding between the matrices must be left untouched
+  auto h_C           = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+  const mag_type eps = 1e3 * ats::epsilon();
+  for (size_t i = 0; i < sizeC; ++i) {
+    EXPECT_NEAR_KK_REL(h_C(i), h_Cref(i), eps, "algo_type: " + handle.get_kernel_algo_type_str());
+  }
+}
+
+}  // namespace GemmVBatched
+}  // namespace Test
+
+template <typename DeviceType, typename ScalarType>
+int test_batched_gemm_vbatched() {
+  using Test::GemmVBatched::impl_test_batched_gemm_vbatched;
+  for (const int algo_type : {(int)BaseHeuristicAlgos::SQUARE, (int)BaseKokkosBatchedAlgos::KK_SERIAL,
+                              (int)GemmKokkosBatchedAlgos::KK_TEAMVECTOR}) {
+    impl_test_batched_gemm_vbatched<DeviceType, ScalarType, Trans::NoTranspose, Trans::NoTranspose>(algo_type, 1.5,
+                                                                                                    3.0);
+    impl_test_batched_gemm_vbatched<DeviceType, ScalarType, Trans::Transpose, Trans::NoTranspose>(algo_type, 1.5, 0.0);
+    impl_test_batched_gemm_vbatched<DeviceType, ScalarType, Trans::NoTranspose, Trans::Transpose>(algo_type, 0.0, 3.0);
+    impl_test_batched_gemm_vbatched<DeviceType, ScalarType, Trans::Transpose, Trans::Transpose>(algo_type, 1.5, 1.0);
+  }
+
+  // Algorithms that need uniform batches are rejected
+  {
+    BatchedGemmHandle handle(GemmKokkosBatchedAlgos::KK_DBLBUF);
+    Kokkos::View<GemmVBatchedEntry<ScalarType> *, DeviceType> entries("entries", 1);
+    EXPECT_THROW(BatchedGemmVBatched<Trans::NoTranspose, Trans::NoTranspose>(&handle, ScalarType(1), entries,
+                                                                             ScalarType(0)),
+                 std::runtime_error);
+  }
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_batched_gemm_vbatched_float) { test_batched_gemm_vbatched<TestDevice, float>(); }
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_batched_gemm_vbatched_double) { test_batched_gemm_vbatched<TestDevice, double>(); }
+#endif
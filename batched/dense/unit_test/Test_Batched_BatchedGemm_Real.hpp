@@ -199,3 +199,5 @@ TEST_F(TestCategory, batched_scalar_batched_gemm_t_t_double_double_right) {
   test_batched_gemm<TestDevice, double, double, param_tag_type>();
 }
 #endif
+
+TEST_F(TestCategory, batched_scalar_batched_gemm_tuning_table) { test_batched_gemm_tuning_table(); }
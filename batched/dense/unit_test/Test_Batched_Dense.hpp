@@ -22,6 +22,8 @@
 #include "Test_Batched_SerialAxpy_Complex.hpp"
 #include "Test_Batched_SerialEigendecomposition.hpp"
 #include "Test_Batched_SerialEigendecomposition_Real.hpp"
+#include "Test_Batched_SerialFixed.hpp"
+#include "Test_Batched_SerialFixed_Real.hpp"
 #include "Test_Batched_SerialGesv.hpp"
 #include "Test_Batched_SerialGesv_Real.hpp"
 #include "Test_Batched_SerialInverseLU.hpp"
@@ -0,0 +1,205 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Fixed_Decl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace SerialFixed {
+
+/// \brief Runs gemm, lu and solve_lu of FixedDispatch and of the Unblocked
+/// kernels on copies of the same inputs.
+template <typename DeviceType, typename ViewType, typename ArgTrans>
+struct Functor_TestBatchedSerialFixed {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _a, _b, _c, _a_ref, _b_ref, _c_ref;
+
+  Functor_TestBatchedSerialFixed(const ViewType &a, const ViewType &b, const ViewType &c, const ViewType &a_ref,
+                                 const ViewType &b_ref, const ViewType &c_ref)
+      : _a(a), _b(b), _c(c), _a_ref(a_ref), _b_ref(b_ref), _c_ref(c_ref) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int k) const {
+    using value_type = typename ViewType::non_const_value_type;
+    const value_type alpha(1.5), beta(0.5);
+
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb     = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+    auto cc     = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+    auto aa_ref = Kokkos::subview(_a_ref, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb_ref = Kokkos::subview(_b_ref, k, Kokkos::ALL(), Kokkos::ALL());
+    auto cc_ref = Kokkos::subview(_c_ref, k, Kokkos::ALL(), Kokkos::ALL());
+
+    FixedDispatch::gemm<ArgTrans, Trans::NoTranspose>(alpha, aa, bb, beta, cc);
+    SerialGemm<ArgTrans, Trans::NoTranspose, Algo::Gemm::Unblocked>::invoke(alpha, aa_ref, bb_ref, beta, cc_ref);
+
+    FixedDispatch::lu(aa);
+    SerialLU<Algo::LU::Unblocked>::invoke(aa_ref);
+
+    FixedDispatch::solve_lu<ArgTrans>(aa, bb);
+    SerialSolveLU<ArgTrans, Algo::SolveLU::Unblocked>::invoke(aa_ref, bb_ref);
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::SerialFixed");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::RangePolicy<execution_space> policy(0, _a.extent(0));
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+/// \brief Runs trsm of FixedDispatch and of the Unblocked kernel on copies of
+/// the same right hand sides.
+template <typename DeviceType, typename ViewType, typename ArgUplo, typename ArgTrans, typename ArgDiag>
+struct Functor_TestBatchedSerialFixedTrsm {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _a, _b, _b_ref;
+
+  Functor_TestBatchedSerialFixedTrsm(const ViewType &a, const ViewType &b, const ViewType &b_ref)
+      : _a(a), _b(b), _b_ref(b_ref) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int k) const {
+    using value_type = typename ViewType::non_const_value_type;
+    const value_type alpha(1.5);
+
+    auto aa     = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb     = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+    auto bb_ref = Kokkos::subview(_b_ref, k, Kokkos::ALL(), Kokkos::ALL());
+
+    FixedDispatch::trsm<ArgUplo, ArgTrans, ArgDiag>(alpha, aa, bb);
+    SerialTrsm<Side::Left, ArgUplo, ArgTrans, ArgDiag, Algo::Trsm::Unblocked>::invoke(alpha, aa, bb_ref);
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::SerialFixedTrsm");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::RangePolicy<execution_space> policy(0, _a.extent(0));
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename ViewType>
+void check_same(const ViewType &x, const ViewType &y) {
+  using value_type = typename ViewType::value_type;
+  using ats        = Kokkos::ArithTraits<value_type>;
+  using mag_type   = typename ats::mag_type;
+
+  auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto y_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+  mag_type sum(1), diff(0);
+  for (size_t k = 0; k < x.extent(0); ++k)
+    for (size_t i = 0; i < x.extent(1); ++i)
+      for (size_t j = 0; j < x.extent(2); ++j) {
+        sum += ats::abs(y_host(k, i, j));
+        diff += ats::abs(x_host(k, i, j) - y_host(k, i, j));
+      }
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  EXPECT_NEAR_KK(diff / sum, 0, eps);
+}
+
+template <typename DeviceType, typename ViewType, typename ArgTrans>
+void impl_test_batched_fixed(const int N, const int BlkSize, const int NumRhs) {
+  using value_type = typename ViewType::value_type;
+
+  ViewType a("a", N, BlkSize, BlkSize), b("b", N, BlkSize, NumRhs), c("c", N, BlkSize, NumRhs);
+  ViewType a_ref("a_ref", N, BlkSize, BlkSize), b_ref("b_ref", N, BlkSize, NumRhs), c_ref("c_ref", N, BlkSize, NumRhs);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+  Kokkos::fill_random(a, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+  Kokkos::fill_random(c, random, value_type(1.0));
+
+  // Diagonally dominant, so that LU without pivoting is stable
+  auto a_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i) a_host(k, i, i) += value_type(BlkSize);
+  Kokkos::deep_copy(a, a_host);
+
+  Kokkos::deep_copy(a_ref, a);
+  Kokkos::deep_copy(b_ref, b);
+  Kokkos::deep_copy(c_ref, c);
+
+  Functor_TestBatchedSerialFixed<DeviceType, ViewType, ArgTrans>(a, b, c, a_ref, b_ref, c_ref).run();
+  Kokkos::fence();
+
+  check_same(c, c_ref);
+  check_same(a, a_ref);
+  check_same(b, b_ref);
+}
+
+template <typename DeviceType, typename ViewType, typename ArgUplo, typename ArgTrans, typename ArgDiag>
+void impl_test_batched_fixed_trsm(const int N, const int BlkSize, const int NumRhs) {
+  using value_type = typename ViewType::value_type;
+
+  ViewType a("a", N, BlkSize, BlkSize), b("b", N, BlkSize, NumRhs), b_ref("b_ref", N, BlkSize, NumRhs);
+
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+  Kokkos::fill_random(a, random, value_type(1.0));
+  Kokkos::fill_random(b, random, value_type(1.0));
+
+  // Diagonally dominant, so that the triangular solves are well conditioned
+  auto a_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < BlkSize; ++i) a_host(k, i, i) += value_type(BlkSize);
+  Kokkos::deep_copy(a, a_host);
+  Kokkos::deep_copy(b_ref, b);
+
+  Functor_TestBatchedSerialFixedTrsm<DeviceType, ViewType, ArgUplo, ArgTrans, ArgDiag>(a, b, b_ref).run();
+  Kokkos::fence();
+
+  check_same(b, b_ref);
+}
+
+}  // namespace SerialFixed
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType>
+int test_batched_fixed() {
+  using view_type = Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>;
+  // 1 and 17 are outside of the sizes of FixedDispatch; 3 right hand sides
+  // are only computed by the fallback
+  for (const int blk : {1, 2, 5, 7, 16, 17}) {
+    for (const int nrhs : {1, blk, 3}) {
+      Test::SerialFixed::impl_test_batched_fixed<DeviceType, view_type, Trans::NoTranspose>(64, blk, nrhs);
+      Test::SerialFixed::impl_test_batched_fixed<DeviceType, view_type, Trans::Transpose>(64, blk, nrhs);
+      Test::SerialFixed::impl_test_batched_fixed_trsm<DeviceType, view_type, Uplo::Upper, Trans::NoTranspose,
+                                                      Diag::NonUnit>(64, blk, nrhs);
+      Test::SerialFixed::impl_test_batched_fixed_trsm<DeviceType, view_type, Uplo::Upper, Trans::Transpose,
+                                                      Diag::NonUnit>(64, blk, nrhs);
+      Test::SerialFixed::impl_test_batched_fixed_trsm<DeviceType, view_type, Uplo::Lower, Trans::NoTranspose,
+                                                      Diag::NonUnit>(64, blk, nrhs);
+      Test::SerialFixed::impl_test_batched_fixed_trsm<DeviceType, view_type, Uplo::Lower, Trans::Transpose,
+                                                      Diag::NonUnit>(64, blk, nrhs);
+    }
+  }
+  return 0;
+}
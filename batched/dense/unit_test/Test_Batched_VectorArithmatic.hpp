@@ -179,6 +179,26 @@ void impl_test_batched_vector_arithmatic() {
       c = -a;
       for (int k = 0; k < vector_length; ++k) EXPECT_NEAR(ats::abs(c[k]), ats::abs(-a[k]), eps * ats::abs(c[k]));
     }
+    {
+      /// test : fma(vec, vec, vec)
+      c = fma(a, b, a);
+      for (int k = 0; k < vector_length; ++k)
+        EXPECT_NEAR(ats::abs(c[k]), ats::abs(a[k] * b[k] + a[k]), eps * ats::abs(c[k]));
+    }
+    {
+      /// test : masked load and store of the first n values
+      value_type in[vector_length], out[vector_length];
+      for (int k = 0; k < vector_length; ++k) in[k] = a[k];
+      for (int n = 0; n <= vector_length; ++n) {
+        for (int k = 0; k < vector_length; ++k) out[k] = alpha;
+        c.loadMasked(in, n);
+        c.storeMasked(out, n);
+        for (int k = 0; k < vector_length; ++k) {
+          EXPECT_EQ(c[k], k < n ? a[k] : zero);
+          EXPECT_EQ(out[k], k < n ? a[k] : alpha);
+        }
+      }
+    }
 #if defined(__DO_NOT_TEST__)
     {
       /// test : add radial
@@ -0,0 +1,224 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
+#define KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// PackedGEMM implements C = beta*C + alpha*op(A)*op(B) on CPUs with the
+// loop structure of GotoBLAS/BLIS. The inner dimension is split in blocks of
+// KC. For each KC x NC panel of op(B) and each MC x KC block of op(A), the
+// panel and the block are copied into contiguous buffers of NR wide column
+// slivers and MR tall row slivers, padded with zeros. A register-blocked
+// micro-kernel then computes each MR x NR tile of C from one sliver of A and
+// one sliver of B, which stay in L1 while the block of A stays in L2.
+//
+// The micro-tile is sized after the SIMD width so that the MR x NR
+// accumulators take 12 vector registers. The slivers of the B panel are
+// packed in parallel, then each team packs one block of op(A) into its
+// scratch memory and computes its tiles; when there are fewer blocks of A
+// than threads, the B panel is also split between teams (the jc and ic loops
+// run in parallel).
+template <class ExecSpace, class AV, class BV, class CV>
+struct PackedGEMM {
+  using scalar_A    = typename AV::non_const_value_type;
+  using scalar_B    = typename BV::non_const_value_type;
+  using scalar_C    = typename CV::non_const_value_type;
+  using ATA         = Kokkos::ArithTraits<scalar_A>;
+  using ATB         = Kokkos::ArithTraits<scalar_B>;
+  using ATC         = Kokkos::ArithTraits<scalar_C>;
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using APanel =
+      Kokkos::View<scalar_A*, typename ExecSpace::scratch_memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using BPanel = Kokkos::View<scalar_B*, Kokkos::Device<ExecSpace, typename ExecSpace::memory_space>>;
+
+  struct TagPackB {};
+  struct TagCompute {};
+
+#if defined(__AVX512F__)
+  static constexpr int simd_bytes = 64;
+#elif defined(__AVX__) || defined(__AVX2__)
+  static constexpr int simd_bytes = 32;
+#else
+  static constexpr int simd_bytes = 16;
+#endif
+  static constexpr int simd_lanes = sizeof(scalar_C) < simd_bytes ? int(simd_bytes / sizeof(scalar_C)) : 1;
+
+  // Micro-tile of C
+  static constexpr int MR = 6;
+  static constexpr int NR = 2 * simd_lanes;
+  // Blocks of the inner dimension (L1), of op(A) (L2) and of op(B) (L3)
+  static constexpr int KC = int(2048 / sizeof(scalar_B));
+  static constexpr int MC = 24 * MR;
+  static constexpr int NC = 256 * NR;
+
+  const AV A;
+  const BV B;
+  CV C;
+
+  const scalar_A alpha;
+  const scalar_C beta;
+
+  const bool transA, conjA, transB, conjB;
+  const int M, N, K;
+
+  BPanel Bp;
+  // Current panel of op(B): columns [jc, jc+nc) and inner indices [pc, pc+kc)
+  int jc, nc, pc, kc;
+  int numJChunks, slivers_per_chunk;
+
+  PackedGEMM(const char transA_, const char transB_, const scalar_A& alpha_, const AV& A_, const BV& B_,
+             const scalar_C& beta_, const CV& C_)
+      : A(A_),
+        B(B_),
+        C(C_),
+        alpha(alpha_),
+        beta(beta_),
+        transA(transA_ != 'N' && transA_ != 'n'),
+        conjA(transA_ == 'C' || transA_ == 'c'),
+        transB(transB_ != 'N' && transB_ != 'n'),
+        conjB(transB_ == 'C' || transB_ == 'c'),
+        M(C_.extent_int(0)),
+        N(C_.extent_int(1)),
+        K(transA ? A_.extent_int(0) : A_.extent_int(1)) {}
+
+  void run(const ExecSpace& space) {
+    if (M == 0 || N == 0 || K == 0) return;
+    const int kcMax = Kokkos::min(KC, K);
+    const int ncMax = Kokkos::min(NC, (N + NR - 1) / NR * NR);
+    Bp = BPanel(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "KokkosBlas::gemm: packed B"),
+                size_t(kcMax) * ncMax);
+    const int numIcBlocks      = (M + MC - 1) / MC;
+    const size_t scratch_bytes = APanel::shmem_size(size_t(MC) * kcMax);
+
+    for (jc = 0; jc < N; jc += NC) {
+      nc                   = Kokkos::min(NC, N - jc);
+      const int numSlivers = (nc + NR - 1) / NR;
+      // Split the panel of B between teams if the blocks of A alone cannot
+      // keep all threads busy
+      numJChunks        = Kokkos::min(numSlivers, (space.concurrency() + numIcBlocks - 1) / numIcBlocks);
+      numJChunks        = Kokkos::max(numJChunks, 1);
+      slivers_per_chunk = (numSlivers + numJChunks - 1) / numJChunks;
+      numJChunks        = (numSlivers + slivers_per_chunk - 1) / slivers_per_chunk;
+      for (pc = 0; pc < K; pc += KC) {
+        kc = Kokkos::min(KC, K - pc);
+        Kokkos::parallel_for("KokkosBlas::gemm[packed]: pack B",
+                             Kokkos::RangePolicy<TagPackB, ExecSpace>(space, 0, numSlivers), *this);
+        Kokkos::parallel_for("KokkosBlas::gemm[packed]: compute",
+                             Kokkos::TeamPolicy<TagCompute, ExecSpace>(space, numIcBlocks * numJChunks, 1)
+                                 .set_scratch_size(1, Kokkos::PerTeam(scratch_bytes)),
+                             *this);
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION scalar_A opA(const int i, const int k) const {
+    return transA ? (conjA ? ATA::conj(A(k, i)) : A(k, i)) : A(i, k);
+  }
+
+  KOKKOS_INLINE_FUNCTION scalar_B opB(const int k, const int j) const {
+    return transB ? (conjB ? ATB::conj(B(j, k)) : B(j, k)) : B(k, j);
+  }
+
+  // Sliver s of the panel holds columns jc + s*NR ... of op(B), row by row
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPackB&, const int s) const {
+    const int j0     = jc + s * NR;
+    const int nr     = Kokkos::min(NR, jc + nc - j0);
+    scalar_B* sliver = Bp.data() + size_t(s) * kc * NR;
+    for (int p = 0; p < kc; p++) {
+      for (int j = 0; j < NR; j++) sliver[p * NR + j] = j < nr ? opB(pc + p, j0 + j) : ATB::zero();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagCompute&, const member_type& team) const {
+    const int ic            = (team.league_rank() / numJChunks) * MC;
+    const int chunk         = team.league_rank() % numJChunks;
+    const int mc            = Kokkos::min(MC, M - ic);
+    const int numRowSlivers = (mc + MR - 1) / MR;
+
+    // Sliver r of the block holds rows ic + r*MR ... of op(A), column by column
+    APanel Ap(team.team_scratch(1), size_t(MC) * kc);
+    for (int r = 0; r < numRowSlivers; r++) {
+      const int i0     = ic + r * MR;
+      const int mr     = Kokkos::min(MR, ic + mc - i0);
+      scalar_A* sliver = Ap.data() + size_t(r) * kc * MR;
+      for (int p = 0; p < kc; p++) {
+        for (int i = 0; i < MR; i++) sliver[p * MR + i] = i < mr ? opA(i0 + i, pc + p) : ATA::zero();
+      }
+    }
+
+    const int sBegin = chunk * slivers_per_chunk;
+    const int sEnd   = Kokkos::min(sBegin + slivers_per_chunk, (nc + NR - 1) / NR);
+    for (int s = sBegin; s < sEnd; s++) {
+      const int j0 = jc + s * NR;
+      const int nr = Kokkos::min(NR, jc + nc - j0);
+      for (int r = 0; r < numRowSlivers; r++) {
+        const int i0 = ic + r * MR;
+        const int mr = Kokkos::min(MR, ic + mc - i0);
+        micro_kernel(Ap.data() + size_t(r) * kc * MR, Bp.data() + size_t(s) * kc * NR, i0, j0, mr, nr);
+      }
+    }
+  }
+
+  // Computes the product of an MR x kc sliver a and a kc x NR sliver b in
+  // local accumulators and adds it to the mr x nr tile of C at (i0, j0). The
+  // loop over the rows of the tile is innermost: it reads MR contiguous
+  // entries of the packed a and one broadcast entry of b, which lets
+  // compilers keep the accumulators in registers and vectorize over the rows
+  // of the tile instead of over the inner dimension.
+  KOKKOS_INLINE_FUNCTION
+  void micro_kernel(const scalar_A* a, const scalar_B* b, const int i0, const int j0, const int mr,
+                    const int nr) const {
+    scalar_C ab[MR][NR];
+    for (int i = 0; i < MR; i++) {
+      for (int j = 0; j < NR; j++) ab[i][j] = ATC::zero();
+    }
+    for (int p = 0; p < kc; p++) {
+      for (int j = 0; j < NR; j++) {
+        for (int i = 0; i < MR; i++) ab[i][j] += a[p * MR + i] * b[p * NR + j];
+      }
+    }
+    update(ab, i0, j0, mr, nr);
+  }
+
+  // Add alpha*ab to the mr x nr tile of C at (i0, j0). The first block of the
+  // inner dimension also scales C by beta (without reading C if beta is 0).
+  KOKKOS_INLINE_FUNCTION
+  void update(const scalar_C (&ab)[MR][NR], const int i0, const int j0, const int mr, const int nr) const {
+    for (int j = 0; j < nr; j++) {
+      for (int i = 0; i < mr; i++) {
+        if (pc > 0)
+          C(i0 + i, j0 + j) += alpha * ab[i][j];
+        else if (beta == ATC::zero())
+          C(i0 + i, j0 + j) = alpha * ab[i][j];
+        else
+          C(i0 + i, j0 + j) = beta * C(i0 + i, j0 + j) + alpha * ab[i][j];
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_GEMM_PACKED_IMPL_HPP_
@@ -23,6 +23,7 @@
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include "KokkosBlas3_gemm_impl.hpp"
 #include "KokkosBlas3_gemm_dotbased_impl.hpp"
+#include "KokkosBlas3_gemm_packed_impl.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
 #endif
 
@@ -103,6 +104,7 @@ struct GEMM {
     // Figure out whether to use DotBased implementation
     const int M = static_cast<int>(C.extent(0));
     const int N = static_cast<int>(C.extent(1));
+    const int K = static_cast<int>(A.extent(transA[0] == 'N' || transA[0] == 'n' ? 1 : 0));
 
     const bool is_device_space = KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>;
     const bool A_is_lr         = std::is_same<Kokkos::LayoutRight, typename AViewType::array_layout>::value;
@@ -113,6 +115,9 @@ struct GEMM {
     // retuned
     constexpr int numDotsLayoutLeftThreshold  = 1600;
     constexpr int numDotsLayoutRightThreshold = 100;
+    // On host, products with at least this many multiply-adds use the packed
+    // (GotoBLAS/BLIS style) kernel; below, packing costs more than it saves
+    constexpr int64_t packedGemmThreshold = 32 * 32 * 32;
     if (((!A_is_lr && A_is_tr && !B_is_tr && M * N < numDotsLayoutLeftThreshold) ||
          (A_is_lr && A_is_tr && !B_is_tr && M * N < numDotsLayoutRightThreshold)) &&
         is_device_space) {
@@ -122,6 +127,12 @@ struct GEMM {
       DotBasedGEMM<execution_space, AViewType, BViewType, CViewType> dotBasedGemm(alpha, A, B, beta, C);
       dotBasedGemm.run(space, A_is_conj);
 
+    } else if (!is_device_space && int64_t(M) * N * K >= packedGemmThreshold) {
+      if constexpr (!KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+        PackedGEMM<execution_space, AViewType, BViewType, CViewType> packedGemm(transA[0], transB[0], alpha, A, B,
+                                                                                beta, C);
+        packedGemm.run(space);
+      }
     } else {
       // Define Blocking sizes (this will be used for scratch spaces)
       static constexpr int blockA0 = 24;
@@ -328,6 +328,9 @@ void test_gemm() {
                                                                                 beta);
         Test::impl_test_gemm<view_type_a, view_type_b, view_type_c, TestDevice>(amode, bmode, 12, 3071, 517, alpha,
                                                                                 beta);
+        // Several row blocks and inner blocks of the packed host kernel
+        Test::impl_test_gemm<view_type_a, view_type_b, view_type_c, TestDevice>(amode, bmode, 301, 67, 600, alpha,
+                                                                                beta);
       }
     }
   }
@@ -39,6 +39,7 @@ int main(int argc, char* argv[]) {
   double convTol = 1e-10;                // Relative residual convergence tolerance.
   int cycLim     = 50;                   // Maximum number of times to restart the solver.
   bool rand_rhs  = false;                // Generate random right-hand side.
+  int s_step     = 1;                    // Basis vectors per block (s-step GMRES).
 
   for (int i = 1; i < argc; ++i) {
     const std::string& token = argv[i];
@@ -48,6 +49,7 @@ int main(int argc, char* argv[]) {
     if (token == std::string("--tol")) convTol = std::stod(argv[++i]);
     if (token == std::string("--ortho")) ortho = argv[++i];
     if (token == std::string("--rand_rhs")) rand_rhs = true;
+    if (token == std::string("--s-step")) s_step = std::atoi(argv[++i]);
     if (token == std::string("--help") || token == std::string("-h")) {
       std::cout << "Kokkos GMRES solver options:" << std::endl
                 << "--filename    :  The name of a matrix market (.mtx) file for "
@@ -64,6 +66,9 @@ int main(int argc, char* argv[]) {
                 << "--rand_rhs    :  Generate a random right-hand side b.  (Else, "
                    "default uses b = vector of ones.)"
                 << std::endl
+                << "--s-step      :  Number of basis vectors per block for s-step GMRES. "
+                   "(Default 1, classical GMRES)"
+                << std::endl
                 << "--help  -h    :  Display this help message." << std::endl
                 << "Example Call  :  ./Gmres.exe --filename Laplace3D100.mtx --tol "
                    "1e-5 --max-subsp 100 "
@@ -95,6 +100,7 @@ int main(int argc, char* argv[]) {
     // reference, so we need to strip that too.
     using GMRESHandle = typename std::remove_reference<decltype(*gmres_handle)>::type;
     gmres_handle->set_ortho(ortho == "CGS2" ? GMRESHandle::Ortho::CGS2 : GMRESHandle::Ortho::MGS);
+    gmres_handle->set_s_step(s_step);
 
     if (rand_rhs) {
       // Make rhs random.
@@ -19,6 +19,8 @@
 
 #include "Kokkos_Core.hpp"
 #include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Sorting.hpp"
 #include <vector>
 #include <algorithm>
 
@@ -107,6 +109,375 @@ struct SerialRCM {
   }
 };
 
+// Orders vertices by increasing degree, with vertex ID as the tiebreak so that
+// the order is total (and results are deterministic).
+template <typename rowmap_t, typename lno_t>
+struct RCMDegreeLess {
+  RCMDegreeLess(const rowmap_t& rowmap_) : rowmap(rowmap_) {}
+
+  KOKKOS_INLINE_FUNCTION bool operator()(lno_t v1, lno_t v2) const {
+    auto d1 = rowmap(v1 + 1) - rowmap(v1);
+    auto d2 = rowmap(v2 + 1) - rowmap(v2);
+    return d1 < d2 || (d1 == d2 && v1 < v2);
+  }
+
+  rowmap_t rowmap;
+};
+
+// Level-synchronous parallel reverse Cuthill-McKee.
+//
+// Each BFS level (frontier) is a contiguous range of the Cuthill-McKee order.
+// The next level is built in three steps that reproduce exactly what a serial
+// queue would do, independent of thread scheduling:
+//  - every unvisited neighbor of the frontier finds its parent, the frontier
+//    vertex with the lowest position in the order (atomic min),
+//  - every frontier vertex counts its children, and a prefix sum over the
+//    counts gives where each frontier vertex appends its children,
+//  - every frontier vertex writes its children and sorts them by degree.
+// A new connected component is started from the unvisited vertex of lowest
+// degree, optionally moved to a pseudo-peripheral vertex of its component.
+template <typename device_t, typename rowmap_t, typename entries_t, typename lno_view_t>
+struct ParallelRCM {
+  using exec_space = typename device_t::execution_space;
+  using mem_space  = typename device_t::memory_space;
+  using size_type  = typename rowmap_t::non_const_value_type;
+  using lno_t      = typename entries_t::non_const_value_type;
+  using lno_view   = Kokkos::View<lno_t*, mem_space>;
+  using lno_scalar = Kokkos::View<lno_t, mem_space>;
+  using range_pol  = Kokkos::RangePolicy<exec_space>;
+  using degree_cmp = RCMDegreeLess<rowmap_t, lno_t>;
+
+  // Values of pos for vertices not in the order yet
+  static constexpr lno_t UNVISITED = -1;
+  static constexpr lno_t CLAIMED   = -2;
+
+  ParallelRCM(const rowmap_t& rowmap_, const entries_t& entries_)
+      : rowmap(rowmap_), entries(entries_), numVerts(std::max(rowmap_.extent_int(0), 1) - 1) {}
+
+  // Result of a BFS from a single root, used to find pseudo-peripheral roots
+  struct RootedLevels {
+    lno_t eccentricity;
+    // Vertex of lowest degree in the last level
+    lno_t farthest;
+  };
+
+  // Vertex with the lowest (degree, ID) in list[begin, end)
+  struct MinDegreeFunctor {
+    using value_type = lno_t;
+
+    MinDegreeFunctor(const lno_view& list_, const degree_cmp& cmp_, lno_t invalid_)
+        : list(list_), cmp(cmp_), invalid(invalid_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t i, lno_t& lmin) const {
+      lno_t v = list(i);
+      if (lmin == invalid || cmp(v, lmin)) lmin = v;
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(lno_t& dst, const lno_t& src) const {
+      if (src != invalid && (dst == invalid || cmp(src, dst))) dst = src;
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(lno_t& v) const { v = invalid; }
+
+    lno_view list;
+    degree_cmp cmp;
+    lno_t invalid;
+  };
+
+  // One level of an unordered BFS: claim unvisited neighbors of the frontier
+  // and append them to the queue.
+  struct BFSLevelFunctor {
+    BFSLevelFunctor(const rowmap_t& rowmap_, const entries_t& entries_, const lno_view& level_,
+                    const lno_view& queue_, const lno_scalar& tail_, lno_t nextLevel_, lno_t numVerts_)
+        : rowmap(rowmap_),
+          entries(entries_),
+          level(level_),
+          queue(queue_),
+          tail(tail_),
+          nextLevel(nextLevel_),
+          numVerts(numVerts_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t i) const {
+      lno_t v = queue(i);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        lno_t nei = entries(j);
+        if (nei == v || nei >= numVerts || level(nei) != UNVISITED) continue;
+        if (Kokkos::atomic_compare_exchange(&level(nei), UNVISITED, nextLevel) == UNVISITED)
+          queue(Kokkos::atomic_fetch_add(&tail(), lno_t(1))) = nei;
+      }
+    }
+
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_view level;
+    lno_view queue;
+    lno_scalar tail;
+    lno_t nextLevel;
+    lno_t numVerts;
+  };
+
+  // Step 1: parent(w) := lowest frontier position adjacent to w
+  struct FindParentsFunctor {
+    FindParentsFunctor(const rowmap_t& rowmap_, const entries_t& entries_, const lno_view& order_,
+                       const lno_view& pos_, const lno_view& parent_, lno_t numVerts_)
+        : rowmap(rowmap_), entries(entries_), order(order_), pos(pos_), parent(parent_), numVerts(numVerts_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t p) const {
+      lno_t v = order(p);
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        lno_t nei = entries(j);
+        if (nei == v || nei >= numVerts) continue;
+        if (pos(nei) == UNVISITED) Kokkos::atomic_min(&parent(nei), p);
+      }
+    }
+
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_view order;
+    lno_view pos;
+    lno_view parent;
+    lno_t numVerts;
+  };
+
+  // Step 2: count the children of each frontier vertex. Only the parent of a
+  // vertex writes its pos, so claiming it (which skips duplicate entries) is
+  // race free.
+  struct CountChildrenFunctor {
+    CountChildrenFunctor(const rowmap_t& rowmap_, const entries_t& entries_, const lno_view& order_,
+                         const lno_view& pos_, const lno_view& parent_, const lno_view& counts_, lno_t frontierBegin_,
+                         lno_t numVerts_)
+        : rowmap(rowmap_),
+          entries(entries_),
+          order(order_),
+          pos(pos_),
+          parent(parent_),
+          counts(counts_),
+          frontierBegin(frontierBegin_),
+          numVerts(numVerts_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t p) const {
+      lno_t v     = order(p);
+      lno_t count = 0;
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        lno_t nei = entries(j);
+        if (nei == v || nei >= numVerts) continue;
+        if (parent(nei) == p && pos(nei) == UNVISITED) {
+          pos(nei) = CLAIMED;
+          count++;
+        }
+      }
+      counts(p - frontierBegin) = count;
+    }
+
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_view order;
+    lno_view pos;
+    lno_view parent;
+    lno_view counts;
+    lno_t frontierBegin;
+    lno_t numVerts;
+  };
+
+  // Step 3: append the children of each frontier vertex, sorted by degree
+  struct AppendChildrenFunctor {
+    AppendChildrenFunctor(const rowmap_t& rowmap_, const entries_t& entries_, const lno_view& order_,
+                          const lno_view& pos_, const lno_view& parent_, const lno_view& offsets_,
+                          lno_t frontierBegin_, lno_t frontierEnd_, lno_t numVerts_)
+        : rowmap(rowmap_),
+          entries(entries_),
+          order(order_),
+          pos(pos_),
+          parent(parent_),
+          offsets(offsets_),
+          frontierBegin(frontierBegin_),
+          frontierEnd(frontierEnd_),
+          numVerts(numVerts_),
+          cmp(rowmap_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(lno_t p) const {
+      lno_t v     = order(p);
+      lno_t begin = frontierEnd + offsets(p - frontierBegin);
+      lno_t end   = begin;
+      for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+        lno_t nei = entries(j);
+        if (nei == v || nei >= numVerts) continue;
+        if (parent(nei) == p && pos(nei) == CLAIMED) {
+          pos(nei)     = end;
+          order(end++) = nei;
+        }
+      }
+      // Children lists are short: insertion sort
+      for (lno_t i = begin + 1; i < end; i++) {
+        lno_t w = order(i);
+        lno_t k = i;
+        for (; k > begin && cmp(w, order(k - 1)); k--) order(k) = order(k - 1);
+        order(k) = w;
+      }
+      for (lno_t i = begin; i < end; i++) pos(order(i)) = i;
+    }
+
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_view order;
+    lno_view pos;
+    lno_view parent;
+    lno_view offsets;
+    lno_t frontierBegin;
+    lno_t frontierEnd;
+    lno_t numVerts;
+    degree_cmp cmp;
+  };
+
+  // BFS from root, within root's connected component. level must be
+  // UNVISITED for all vertices of the component; it is restored on return.
+  RootedLevels bfsLevels(lno_t root) {
+    exec_space exec;
+    lno_scalar tail("BFS queue tail");
+    Kokkos::deep_copy(exec, Kokkos::subview(level, root), lno_t(0));
+    Kokkos::deep_copy(exec, Kokkos::subview(queue, 0), root);
+    lno_t levelBegin = 0;
+    lno_t levelEnd   = 1;
+    lno_t ecc        = 0;
+    while (true) {
+      Kokkos::deep_copy(exec, tail, levelEnd);
+      Kokkos::parallel_for("KokkosGraph::RCM::BFSLevel", range_pol(exec, levelBegin, levelEnd),
+                           BFSLevelFunctor(rowmap, entries, level, queue, tail, ecc + 1, numVerts));
+      lno_t newEnd;
+      Kokkos::deep_copy(exec, newEnd, tail);
+      exec.fence();
+      if (newEnd == levelEnd) break;
+      levelBegin = levelEnd;
+      levelEnd   = newEnd;
+      ecc++;
+    }
+    RootedLevels result;
+    result.eccentricity = ecc;
+    Kokkos::parallel_reduce("KokkosGraph::RCM::LastLevelMinDegree", range_pol(exec, levelBegin, levelEnd),
+                            MinDegreeFunctor(queue, degree_cmp(rowmap), numVerts), result.farthest);
+    auto levelCopy = level;
+    auto queueCopy = queue;
+    Kokkos::parallel_for(
+        "KokkosGraph::RCM::ResetLevels", range_pol(exec, 0, levelEnd),
+        KOKKOS_LAMBDA(lno_t i) { levelCopy(queueCopy(i)) = UNVISITED; });
+    return result;
+  }
+
+  // George-Liu: move the root to the lowest degree vertex of its last BFS
+  // level, as long as that increases the eccentricity
+  lno_t pseudoPeripheral(lno_t root) {
+    if (level.extent(0) != size_t(numVerts)) {
+      level = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM BFS levels"), numVerts);
+      queue = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM BFS queue"), numVerts);
+      Kokkos::deep_copy(exec_space(), level, UNVISITED);
+    }
+    RootedLevels rootLevels = bfsLevels(root);
+    while (true) {
+      RootedLevels candLevels = bfsLevels(rootLevels.farthest);
+      if (candLevels.eccentricity <= rootLevels.eccentricity) break;
+      root       = rootLevels.farthest;
+      rootLevels = candLevels;
+    }
+    return root;
+  }
+
+  // Append the vertices of levels after [frontierBegin, frontierEnd) to the
+  // order, and return the end of the component.
+  lno_t cuthillMcKee(lno_t frontierBegin, lno_t frontierEnd) {
+    exec_space exec;
+    while (frontierEnd > frontierBegin) {
+      Kokkos::parallel_for("KokkosGraph::RCM::FindParents", range_pol(exec, frontierBegin, frontierEnd),
+                           FindParentsFunctor(rowmap, entries, order, pos, parent, numVerts));
+      Kokkos::parallel_for(
+          "KokkosGraph::RCM::CountChildren", range_pol(exec, frontierBegin, frontierEnd),
+          CountChildrenFunctor(rowmap, entries, order, pos, parent, counts, frontierBegin, numVerts));
+      lno_t numChildren = 0;
+      KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, frontierEnd - frontierBegin, counts, numChildren);
+      Kokkos::parallel_for("KokkosGraph::RCM::AppendChildren", range_pol(exec, frontierBegin, frontierEnd),
+                           AppendChildrenFunctor(rowmap, entries, order, pos, parent, counts, frontierBegin,
+                                                 frontierEnd, numVerts));
+      frontierBegin = frontierEnd;
+      frontierEnd += numChildren;
+    }
+    return frontierEnd;
+  }
+
+  // Index of the first vertex in allVertices[begin, numVerts) that is not
+  // ordered yet. Searches windows of doubling size, so that the total cost of
+  // all restarts stays linear.
+  lno_t nextUnvisited(const lno_view& allVertices, lno_t begin) {
+    exec_space exec;
+    auto posCopy = pos;
+    lno_t window = 64;
+    while (begin < numVerts) {
+      lno_t end   = std::min<lno_t>(numVerts, begin + window);
+      lno_t found = numVerts;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::RCM::NextRoot", range_pol(exec, begin, end),
+          KOKKOS_LAMBDA(lno_t i, lno_t & lmin) {
+            if (i < lmin && posCopy(allVertices(i)) == UNVISITED) lmin = i;
+          },
+          Kokkos::Min<lno_t>(found));
+      if (found != numVerts) return found;
+      begin = end;
+      window *= 2;
+    }
+    return numVerts;
+  }
+
+  // Return the label (position in RCM order) of each vertex
+  lno_view_t rcm(bool pseudoPeripheralRoot) {
+    exec_space exec;
+    order  = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM order"), numVerts);
+    pos    = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM positions"), numVerts);
+    parent = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM parents"), numVerts);
+    counts = lno_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM child counts"), numVerts + 1);
+    Kokkos::deep_copy(exec, pos, UNVISITED);
+    Kokkos::deep_copy(exec, parent, numVerts);
+    // All vertices from lowest to highest degree: candidates for the root of
+    // each connected component
+    lno_view allVertices(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM roots"), numVerts);
+    Kokkos::parallel_for(
+        "KokkosGraph::RCM::Iota", range_pol(exec, 0, numVerts), KOKKOS_LAMBDA(lno_t i) { allVertices(i) = i; });
+    KokkosKernels::bitonicSort<lno_view, exec_space, lno_t, degree_cmp>(allVertices, degree_cmp(rowmap));
+    lno_t numOrdered = 0;
+    lno_t rootIter   = 0;
+    while (numOrdered < numVerts) {
+      rootIter = nextUnvisited(allVertices, rootIter);
+      lno_t root;
+      Kokkos::deep_copy(exec, root, Kokkos::subview(allVertices, rootIter));
+      exec.fence();
+      if (pseudoPeripheralRoot) root = pseudoPeripheral(root);
+      Kokkos::deep_copy(exec, Kokkos::subview(order, numOrdered), root);
+      Kokkos::deep_copy(exec, Kokkos::subview(pos, root), numOrdered);
+      numOrdered = cuthillMcKee(numOrdered, numOrdered + 1);
+    }
+    // Reverse the order
+    lno_view_t labels(Kokkos::view_alloc(Kokkos::WithoutInitializing, "RCM Permutation"), numVerts);
+    auto posCopy   = pos;
+    lno_t lastVert = numVerts - 1;
+    Kokkos::parallel_for(
+        "KokkosGraph::RCM::Reverse", range_pol(exec, 0, numVerts),
+        KOKKOS_LAMBDA(lno_t i) { labels(i) = lastVert - posCopy(i); });
+    return labels;
+  }
+
+  rowmap_t rowmap;
+  entries_t entries;
+  lno_t numVerts;
+  // Vertices in Cuthill-McKee order
+  lno_view order;
+  // Position of each vertex in order, or UNVISITED/CLAIMED
+  lno_view pos;
+  // Lowest position of a neighbor, for vertices adjacent to the frontier
+  lno_view parent;
+  // Number of children of each frontier vertex, then their offsets
+  lno_view counts;
+  // Scratch for the pseudo-peripheral root search
+  lno_view level;
+  lno_view queue;
+};
+
 }  // namespace Impl
 }  // namespace Experimental
 }  // namespace KokkosGraph
@@ -0,0 +1,292 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <sstream>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosGraph_Partition.hpp"
+
+namespace KokkosGraph {
+
+namespace Experimental {
+
+// Nested dissection fill-reducing ordering. The graph is bisected with
+// graph_partitioner (multilevel, on top of coarse_builder), the boundary of
+// the side with fewer boundary vertices becomes a vertex separator, and both
+// remaining halves are ordered recursively before the separator.
+//
+// this class is not meant to be instantiated
+// think of it like a templated namespace
+template <class crsMat>
+class nd_builder {
+ public:
+  // define internal types
+  using matrix_t      = crsMat;
+  using partitioner_t = graph_partitioner<crsMat>;
+  using exec_space    = typename matrix_t::execution_space;
+  using Device        = typename matrix_t::device_type;
+  using ordinal_t     = typename matrix_t::ordinal_type;
+  using edge_offset_t = typename matrix_t::size_type;
+  using scalar_t      = typename matrix_t::value_type;
+  using graph_type    = typename matrix_t::StaticCrsGraphType;
+  using rowmap_t      = typename graph_type::row_map_type::non_const_type;
+  using entries_t     = typename graph_type::entries_type::non_const_type;
+  using wgt_view_t    = typename matrix_t::values_type::non_const_type;
+  using vtx_view_t    = Kokkos::View<ordinal_t*, Device>;
+  using tree_view_t   = Kokkos::View<int*, Kokkos::HostSpace>;
+  using policy_t      = Kokkos::RangePolicy<exec_space>;
+  using side_t        = unsigned char;
+  using side_view_t   = Kokkos::View<side_t*, Device>;
+
+  static constexpr side_t SEPARATOR = 2;
+
+  struct nd_result {
+    // perm(i) is the vertex eliminated i-th (new to old, as in MDF_handle)
+    vtx_view_t perm;
+    // perm_inv(v) is the position of vertex v in the ordering (old to new, as
+    // the labels returned by graph_rcm)
+    vtx_view_t perm_inv;
+    // Separator tree in postorder, in the format of the supernodal etree of
+    // sptrsv: node s holds the new indices [tree_ptr(s), tree_ptr(s + 1)),
+    // and tree_parent(s) is its parent, or -1 for a root. Leaves are the
+    // subdomains, and every other node is a separator.
+    tree_view_t tree_ptr;
+    tree_view_t tree_parent;
+    int num_nodes = 0;
+  };
+
+  struct nd_handle {
+    // subgraphs with at most this many vertices are not dissected further
+    ordinal_t leaf_size = 64;
+    // coarsening heuristic and coarse graph builder used for each bisection
+    typename partitioner_t::coarsener_t::Heuristic h = partitioner_t::coarsener_t::HECv1;
+    typename partitioner_t::coarsener_t::Builder b   = partitioner_t::coarsener_t::Hybrid;
+    nd_result result;
+  };
+
+  // The vertices of g on side s, as a graph with unit edge weights and
+  // without self loops. orig maps the vertices of g to those of the input
+  // graph, and sub_orig is set to the same map for the subgraph.
+  static matrix_t extract(const matrix_t g, const vtx_view_t orig, const side_view_t side, const side_t s,
+                          vtx_view_t& sub_orig) {
+    const ordinal_t n = g.numRows();
+    auto rowmap       = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    vtx_view_t new_id(Kokkos::view_alloc(Kokkos::WithoutInitializing, "subgraph ids"), n);
+    ordinal_t sub_n = 0;
+    Kokkos::parallel_scan(
+        "subgraph ids", policy_t(0, n),
+        KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& update, const bool final) {
+          if (side(i) != s) return;
+          if (final) new_id(i) = update;
+          update++;
+        },
+        sub_n);
+
+    rowmap_t sub_rowmap("subgraph rowmap", sub_n + 1);
+    sub_orig = vtx_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "subgraph vertices"), sub_n);
+    Kokkos::parallel_for(
+        "subgraph degrees", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+          if (side(i) != s) return;
+          edge_offset_t degree = 0;
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+            const ordinal_t v = entries(j);
+            if (v != i && side(v) == s) degree++;
+          }
+          sub_rowmap(new_id(i) + 1) = degree;
+          sub_orig(new_id(i))       = orig(i);
+        });
+    edge_offset_t sub_nnz = 0;
+    Kokkos::parallel_scan(
+        "subgraph rowmap", policy_t(0, sub_n + 1),
+        KOKKOS_LAMBDA(const ordinal_t i, edge_offset_t& update, const bool final) {
+          update += sub_rowmap(i);
+          if (final) sub_rowmap(i) = update;
+        },
+        sub_nnz);
+
+    entries_t sub_entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "subgraph entries"), sub_nnz);
+    Kokkos::parallel_for(
+        "subgraph entries", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+          if (side(i) != s) return;
+          edge_offset_t k = sub_rowmap(new_id(i));
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+            const ordinal_t v = entries(j);
+            if (v != i && side(v) == s) sub_entries(k++) = new_id(v);
+          }
+        });
+    wgt_view_t sub_values("subgraph values", sub_nnz);
+    Kokkos::deep_copy(sub_values, static_cast<scalar_t>(1));
+    graph_type sub_graph(sub_entries, sub_rowmap);
+    return matrix_t("subgraph", sub_n, sub_values, sub_graph);
+  }
+
+  // Bisects g and marks each vertex with its side, 0 or 1, or SEPARATOR.
+  // The separator is the boundary of one side of the edge cut, so no edge
+  // joins side 0 and side 1.
+  static void find_separator(const nd_handle& handle, const matrix_t g, const side_view_t side) {
+    const ordinal_t n = g.numRows();
+    typename partitioner_t::partition_handle p_handle;
+    p_handle.k = 2;
+    p_handle.h = handle.h;
+    p_handle.b = handle.b;
+    partitioner_t::partition(p_handle, g);
+    const vtx_view_t parts = p_handle.result.parts;
+
+    auto rowmap  = g.graph.row_map;
+    auto entries = g.graph.entries;
+    Kokkos::View<ordinal_t[2], Device> boundary("boundary sizes");
+    Kokkos::parallel_for(
+        "mark boundary", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+          const ordinal_t p = parts(i);
+          side(i)           = static_cast<side_t>(p);
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+            if (parts(entries(j)) != p) {
+              Kokkos::atomic_inc(&boundary(p));
+              break;
+            }
+          }
+        });
+    auto h_boundary       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), boundary);
+    const side_t sep_side = h_boundary(0) <= h_boundary(1) ? 0 : 1;
+    Kokkos::parallel_for(
+        "mark separator", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+          if (parts(i) != sep_side) return;
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+            if (parts(entries(j)) != sep_side) {
+              side(i) = SEPARATOR;
+              return;
+            }
+          }
+        });
+  }
+
+  // Orders the vertices of g into perm(offset : offset + n) and appends the
+  // nodes of its separator tree in postorder. Returns the roots of the
+  // subtree, for the caller to set their parent: a disconnected g gets no
+  // separator, and then both halves are roots.
+  static std::vector<int> dissect(const nd_handle& handle, const matrix_t g, const vtx_view_t orig,
+                                  const ordinal_t offset, const vtx_view_t perm, std::vector<int>& tree_ptr,
+                                  std::vector<int>& tree_parent) {
+    const ordinal_t n = g.numRows();
+    std::vector<int> roots;
+    if (n == 0) return roots;
+
+    ordinal_t sizes[3] = {n, 0, 0};
+    side_view_t side("sides", n);
+    if (n > handle.leaf_size) {
+      find_separator(handle, g, side);
+      Kokkos::View<ordinal_t[3], Device> d_sizes("side sizes");
+      Kokkos::parallel_for(
+          "side sizes", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) { Kokkos::atomic_inc(&d_sizes(side(i))); });
+      auto h_sizes = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d_sizes);
+      for (int s = 0; s < 3; s++) sizes[s] = h_sizes(s);
+      // no progress: keep g as a leaf
+      if (sizes[0] == n || sizes[1] == n) {
+        Kokkos::deep_copy(side, static_cast<side_t>(0));
+        sizes[0] = n;
+        sizes[1] = sizes[SEPARATOR] = 0;
+      }
+    }
+
+    if (sizes[0] == n) {
+      Kokkos::parallel_for(
+          "order leaf", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) { perm(offset + i) = orig(i); });
+      tree_ptr.push_back(offset + n);
+      tree_parent.push_back(-1);
+      roots.push_back(tree_parent.size() - 1);
+      return roots;
+    }
+
+    ordinal_t child_offset = offset;
+    for (side_t s = 0; s < 2; s++) {
+      vtx_view_t sub_orig;
+      matrix_t sub_g               = extract(g, orig, side, s, sub_orig);
+      std::vector<int> child_roots = dissect(handle, sub_g, sub_orig, child_offset, perm, tree_ptr, tree_parent);
+      roots.insert(roots.end(), child_roots.begin(), child_roots.end());
+      child_offset += sizes[s];
+    }
+    if (sizes[SEPARATOR] == 0) return roots;
+
+    Kokkos::parallel_scan(
+        "order separator", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& update, const bool final) {
+          if (side(i) != SEPARATOR) return;
+          if (final) perm(child_offset + update) = orig(i);
+          update++;
+        });
+    tree_ptr.push_back(offset + n);
+    tree_parent.push_back(-1);
+    const int sep_node = tree_parent.size() - 1;
+    for (int r : roots) tree_parent[r] = sep_node;
+    return std::vector<int>(1, sep_node);
+  }
+
+  static void order(nd_handle& handle, const matrix_t g) {
+    const ordinal_t n = g.numRows();
+    if (g.numRows() != g.numCols()) {
+      std::ostringstream os;
+      os << "KokkosGraph::Experimental::nested_dissection: need a square matrix, got " << g.numRows() << " x "
+         << g.numCols();
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    nd_result& result = handle.result;
+
+    // drop self loops and edge weights
+    vtx_view_t identity(Kokkos::view_alloc(Kokkos::WithoutInitializing, "identity"), n);
+    Kokkos::parallel_for(
+        "identity", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) { identity(i) = i; });
+    side_view_t all("sides", n);
+    vtx_view_t orig;
+    matrix_t graph = extract(g, identity, all, 0, orig);
+
+    result.perm = vtx_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "ND permutation"), n);
+    std::vector<int> tree_ptr(1, 0), tree_parent;
+    dissect(handle, graph, orig, 0, result.perm, tree_ptr, tree_parent);
+
+    result.perm_inv = vtx_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "ND inverse permutation"), n);
+    auto perm       = result.perm;
+    auto perm_inv   = result.perm_inv;
+    Kokkos::parallel_for(
+        "invert permutation", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) { perm_inv(perm(i)) = i; });
+
+    result.num_nodes   = tree_parent.size();
+    result.tree_ptr    = tree_view_t("ND tree ptr", tree_ptr.size());
+    result.tree_parent = tree_view_t("ND tree parent", tree_parent.size());
+    for (size_t s = 0; s < tree_ptr.size(); s++) result.tree_ptr(s) = tree_ptr[s];
+    for (size_t s = 0; s < tree_parent.size(); s++) result.tree_parent(s) = tree_parent[s];
+  }
+};
+
+// Computes a nested dissection ordering of the matrix g, whose sparsity
+// pattern must be symmetric. The values and the diagonal are ignored.
+// Subgraphs of at most leaf_size vertices are kept in their original order.
+template <class crsMat>
+typename nd_builder<crsMat>::nd_result nested_dissection(const crsMat& g,
+                                                         const typename crsMat::ordinal_type leaf_size = 64) {
+  typename nd_builder<crsMat>::nd_handle handle;
+  handle.leaf_size = leaf_size;
+  nd_builder<crsMat>::order(handle, g);
+  return handle.result;
+}
+
+}  // end namespace Experimental
+}  // end namespace KokkosGraph
+// exclude from Cuda builds without lambdas enabled
+#endif
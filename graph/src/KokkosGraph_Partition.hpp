@@ -0,0 +1,393 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <algorithm>
+#include <queue>
+#include <sstream>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosGraph_CoarsenConstruct.hpp"
+
+namespace KokkosGraph {
+
+namespace Experimental {
+
+// Multilevel k-way graph partitioning. The graph is an undirected graph stored
+// as a symmetric CrsMatrix without self loops, whose values are edge weights.
+// It is coarsened with coarse_builder, the coarsest graph is split by greedy
+// graph growing, and the partition is projected back through each level and
+// improved there by parallel label propagation (in the style of Jet).
+//
+// this class is not meant to be instantiated
+// think of it like a templated namespace
+template <class crsMat>
+class graph_partitioner {
+ public:
+  // define internal types
+  using matrix_t            = crsMat;
+  using coarsener_t         = coarse_builder<crsMat>;
+  using coarse_level_triple = typename coarsener_t::coarse_level_triple;
+  using exec_space          = typename matrix_t::execution_space;
+  using Device              = typename matrix_t::device_type;
+  using ordinal_t           = typename matrix_t::ordinal_type;
+  using edge_offset_t       = typename matrix_t::size_type;
+  using scalar_t            = typename matrix_t::value_type;
+  using vtx_view_t          = Kokkos::View<ordinal_t*, Device>;
+  using wgt_view_t          = Kokkos::View<scalar_t*, Device>;
+  using policy_t            = Kokkos::RangePolicy<exec_space>;
+
+  static constexpr ordinal_t ORD_MAX = coarsener_t::ORD_MAX;
+
+  struct partition_result {
+    // part label of each vertex, in [0, k)
+    vtx_view_t parts;
+    // total weight of the edges between different parts
+    scalar_t edge_cut = 0;
+    // weight of the heaviest part divided by the average part weight
+    double imbalance = 0;
+    // number of levels of the coarsening hierarchy, including the input graph
+    int num_levels = 0;
+  };
+
+  struct partition_handle {
+    // number of parts
+    ordinal_t k = 2;
+    // allowed weight of a part, relative to the average part weight
+    double imbalance_tol = 1.03;
+    // maximum number of label propagation sweeps per level
+    int refine_iters = 12;
+    // coarsening heuristic and coarse graph builder
+    typename coarsener_t::Heuristic h = coarsener_t::HECv1;
+    typename coarsener_t::Builder b   = coarsener_t::Hybrid;
+    partition_result result;
+  };
+
+  // Greedy graph growing: parts are grown one after the other by a
+  // breadth-first search from an unassigned vertex, each up to the average
+  // weight of the remaining parts. The coarsest graph is small, so this runs
+  // on host.
+  static vtx_view_t initial_partition(const ordinal_t k, const matrix_t g, const vtx_view_t vtx_wgts) {
+    const ordinal_t n = g.numRows();
+    auto rowmap       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g.graph.row_map);
+    auto entries      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g.graph.entries);
+    auto wgts         = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), vtx_wgts);
+    vtx_view_t parts(Kokkos::view_alloc(Kokkos::WithoutInitializing, "parts"), n);
+    auto h_parts = Kokkos::create_mirror_view(parts);
+    Kokkos::deep_copy(h_parts, ORD_MAX);
+
+    ordinal_t remaining = 0;
+    for (ordinal_t i = 0; i < n; i++) remaining += wgts(i);
+
+    ordinal_t next_seed = 0;
+    for (ordinal_t p = 0; p < k - 1; p++) {
+      const ordinal_t target = (remaining + (k - p) - 1) / (k - p);
+      ordinal_t part_wgt     = 0;
+      std::queue<ordinal_t> frontier;
+      while (part_wgt < target) {
+        if (frontier.empty()) {
+          // start (or restart, for disconnected graphs) from the first
+          // unassigned vertex
+          while (next_seed < n && h_parts(next_seed) != ORD_MAX) next_seed++;
+          if (next_seed == n) break;
+          frontier.push(next_seed);
+        }
+        const ordinal_t u = frontier.front();
+        frontier.pop();
+        if (h_parts(u) != ORD_MAX) continue;
+        h_parts(u) = p;
+        part_wgt += wgts(u);
+        for (edge_offset_t j = rowmap(u); j < rowmap(u + 1); j++) {
+          if (h_parts(entries(j)) == ORD_MAX) frontier.push(entries(j));
+        }
+      }
+      remaining -= part_wgt;
+    }
+    for (ordinal_t i = 0; i < n; i++) {
+      if (h_parts(i) == ORD_MAX) h_parts(i) = k - 1;
+    }
+    Kokkos::deep_copy(parts, h_parts);
+    return parts;
+  }
+
+  // parts of a level from the parts of the next coarser level
+  static vtx_view_t project(const matrix_t interp_mtx, const vtx_view_t coarse_parts) {
+    const ordinal_t n = interp_mtx.numRows();
+    vtx_view_t parts(Kokkos::view_alloc(Kokkos::WithoutInitializing, "parts"), n);
+    auto vcmap = interp_mtx.graph.entries;
+    Kokkos::parallel_for(
+        "project partition", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) { parts(i) = coarse_parts(vcmap(i)); });
+    return parts;
+  }
+
+  static vtx_view_t part_weights(const ordinal_t k, const vtx_view_t parts, const vtx_view_t vtx_wgts) {
+    vtx_view_t part_wgts("part weights", k);
+    Kokkos::parallel_for(
+        "part weights", policy_t(0, parts.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t i) { Kokkos::atomic_add(&part_wgts(parts(i)), vtx_wgts(i)); });
+    return part_wgts;
+  }
+
+  // Moves vertices out of parts heavier than max_wgt, each into the
+  // neighboring part with room it is most connected to, or else into the
+  // lightest part. A vertex only leaves a part that is still too heavy.
+  static void rebalance(const matrix_t g, const vtx_view_t vtx_wgts, const vtx_view_t parts,
+                        const vtx_view_t part_wgts, const ordinal_t max_wgt, const int max_iters) {
+    const ordinal_t n = g.numRows();
+    const ordinal_t k = part_wgts.extent(0);
+    vtx_view_t dest(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rebalance destinations"), n);
+    auto rowmap  = g.graph.row_map;
+    auto entries = g.graph.entries;
+    auto values  = g.values;
+
+    for (int iter = 0; iter < max_iters; iter++) {
+      auto h_part_wgts   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), part_wgts);
+      ordinal_t lightest = 0;
+      bool balanced      = true;
+      for (ordinal_t p = 0; p < k; p++) {
+        if (h_part_wgts(p) > max_wgt) balanced = false;
+        if (h_part_wgts(p) < h_part_wgts(lightest)) lightest = p;
+      }
+      if (balanced) return;
+
+      Kokkos::parallel_for(
+          "find rebalancing moves", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+            const ordinal_t p = parts(i);
+            const ordinal_t w = vtx_wgts(i);
+            dest(i)           = ORD_MAX;
+            if (part_wgts(p) <= max_wgt) return;
+            ordinal_t best     = ORD_MAX;
+            scalar_t best_conn = 0;
+            for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+              const ordinal_t q = parts(entries(j));
+              if (q == p || part_wgts(q) + w > max_wgt) continue;
+              // evaluate each part at its first neighbor only
+              bool seen = false;
+              for (edge_offset_t jj = rowmap(i); jj < j && !seen; jj++) seen = parts(entries(jj)) == q;
+              if (seen) continue;
+              scalar_t conn = 0;
+              for (edge_offset_t jj = j; jj < rowmap(i + 1); jj++) {
+                if (parts(entries(jj)) == q) conn += values(jj);
+              }
+              if (best == ORD_MAX || conn > best_conn) {
+                best      = q;
+                best_conn = conn;
+              }
+            }
+            if (best == ORD_MAX && lightest != p && part_wgts(lightest) + w <= max_wgt) best = lightest;
+            dest(i) = best;
+          });
+
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "apply rebalancing moves", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& l_moved) {
+            const ordinal_t q = dest(i);
+            if (q == ORD_MAX) return;
+            const ordinal_t p = parts(i);
+            const ordinal_t w = vtx_wgts(i);
+            if (Kokkos::atomic_fetch_sub(&part_wgts(p), w) <= max_wgt) {
+              Kokkos::atomic_add(&part_wgts(p), w);
+              return;
+            }
+            if (Kokkos::atomic_fetch_add(&part_wgts(q), w) + w > max_wgt) {
+              Kokkos::atomic_sub(&part_wgts(q), w);
+              Kokkos::atomic_add(&part_wgts(p), w);
+              return;
+            }
+            parts(i) = q;
+            l_moved++;
+          },
+          moved);
+      if (moved == 0) return;
+    }
+  }
+
+  // Label propagation: every vertex proposes a move to the neighboring part
+  // that gains the most cut weight. A proposal is kept only if it still gains
+  // when all the proposals of higher priority (larger gain, then smaller
+  // index) among its neighbors are applied too, which keeps neighbors from
+  // swapping back and forth. Moves that would overfill a part are dropped.
+  static void refine(const matrix_t g, const vtx_view_t vtx_wgts, const vtx_view_t parts, const vtx_view_t part_wgts,
+                     const ordinal_t max_wgt, const int max_iters) {
+    const ordinal_t n = g.numRows();
+    vtx_view_t dest(Kokkos::view_alloc(Kokkos::WithoutInitializing, "refine destinations"), n);
+    vtx_view_t approved(Kokkos::view_alloc(Kokkos::WithoutInitializing, "approved destinations"), n);
+    wgt_view_t gains(Kokkos::view_alloc(Kokkos::WithoutInitializing, "refine gains"), n);
+    auto rowmap  = g.graph.row_map;
+    auto entries = g.graph.entries;
+    auto values  = g.values;
+
+    for (int iter = 0; iter < max_iters; iter++) {
+      Kokkos::parallel_for(
+          "find refinement moves", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+            const ordinal_t p = parts(i);
+            const ordinal_t w = vtx_wgts(i);
+            scalar_t own_conn = 0;
+            for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+              if (parts(entries(j)) == p) own_conn += values(j);
+            }
+            ordinal_t best     = ORD_MAX;
+            scalar_t best_conn = 0;
+            for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+              const ordinal_t q = parts(entries(j));
+              if (q == p || part_wgts(q) + w > max_wgt) continue;
+              // evaluate each part at its first neighbor only
+              bool seen = false;
+              for (edge_offset_t jj = rowmap(i); jj < j && !seen; jj++) seen = parts(entries(jj)) == q;
+              if (seen) continue;
+              scalar_t conn = 0;
+              for (edge_offset_t jj = j; jj < rowmap(i + 1); jj++) {
+                if (parts(entries(jj)) == q) conn += values(jj);
+              }
+              if (best == ORD_MAX || conn > best_conn) {
+                best      = q;
+                best_conn = conn;
+              }
+            }
+            if (best != ORD_MAX && best_conn > own_conn) {
+              dest(i)  = best;
+              gains(i) = best_conn - own_conn;
+            } else {
+              dest(i)  = ORD_MAX;
+              gains(i) = 0;
+            }
+          });
+
+      Kokkos::parallel_for(
+          "approve refinement moves", policy_t(0, n), KOKKOS_LAMBDA(const ordinal_t i) {
+            const ordinal_t q = dest(i);
+            approved(i)       = ORD_MAX;
+            if (q == ORD_MAX) return;
+            const ordinal_t p = parts(i);
+            scalar_t gain     = 0;
+            for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+              const ordinal_t v = entries(j);
+              ordinal_t v_part  = parts(v);
+              if (dest(v) != ORD_MAX && (gains(v) > gains(i) || (gains(v) == gains(i) && v < i))) v_part = dest(v);
+              if (v_part == q) gain += values(j);
+              if (v_part == p) gain -= values(j);
+            }
+            if (gain > 0) approved(i) = q;
+          });
+
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "apply refinement moves", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& l_moved) {
+            const ordinal_t q = approved(i);
+            if (q == ORD_MAX) return;
+            const ordinal_t w = vtx_wgts(i);
+            if (Kokkos::atomic_fetch_add(&part_wgts(q), w) + w > max_wgt) {
+              Kokkos::atomic_sub(&part_wgts(q), w);
+              return;
+            }
+            Kokkos::atomic_sub(&part_wgts(parts(i)), w);
+            parts(i) = q;
+            l_moved++;
+          },
+          moved);
+      if (moved == 0) return;
+    }
+  }
+
+  static scalar_t edge_cut(const matrix_t g, const vtx_view_t parts) {
+    auto rowmap   = g.graph.row_map;
+    auto entries  = g.graph.entries;
+    auto values   = g.values;
+    scalar_t cut2 = 0;
+    Kokkos::parallel_reduce(
+        "edge cut", policy_t(0, g.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i, scalar_t& l_cut) {
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++) {
+            if (parts(entries(j)) != parts(i)) l_cut += values(j);
+          }
+        },
+        cut2);
+    // every cut edge is seen from both of its endpoints
+    return cut2 / 2;
+  }
+
+  static void partition(partition_handle& handle, const matrix_t g) {
+    const ordinal_t k = handle.k;
+    const ordinal_t n = g.numRows();
+    if (k < 1 || g.numRows() != g.numCols()) {
+      std::ostringstream os;
+      os << "KokkosGraph::Experimental::partition: need k >= 1 and a square matrix, got k = " << k << " and "
+         << g.numRows() << " x " << g.numCols();
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    partition_result& result = handle.result;
+
+    typename coarsener_t::coarsen_handle coarsen_handle;
+    coarsen_handle.h = handle.h;
+    coarsen_handle.b = handle.b;
+    // stop coarsening while each part still has several coarse vertices
+    coarsen_handle.coarse_vtx_cutoff = std::max(coarsen_handle.coarse_vtx_cutoff, 8 * k);
+    coarsen_handle.min_allowed_vtx   = std::max(coarsen_handle.min_allowed_vtx, 2 * k);
+    if (k > 1) {
+      coarsener_t::generate_coarse_graphs(coarsen_handle, g);
+    } else {
+      coarse_level_triple finest;
+      finest.mtx      = g;
+      finest.vtx_wgts = vtx_view_t("vertex weights", n);
+      Kokkos::deep_copy(finest.vtx_wgts, static_cast<ordinal_t>(1));
+      coarsen_handle.results.push_back(finest);
+    }
+    std::list<coarse_level_triple>& levels = coarsen_handle.results;
+    result.num_levels                      = levels.size();
+
+    // total vertex weight is the same on every level
+    const ordinal_t total_wgt = n;
+    const ordinal_t max_wgt   = static_cast<ordinal_t>(handle.imbalance_tol * total_wgt / k) + 1;
+
+    auto level        = levels.rbegin();
+    vtx_view_t parts  = initial_partition(k, level->mtx, level->vtx_wgts);
+    vtx_view_t p_wgts = part_weights(k, parts, level->vtx_wgts);
+    refine(level->mtx, level->vtx_wgts, parts, p_wgts, max_wgt, handle.refine_iters);
+    for (auto coarse = level++; level != levels.rend(); coarse = level++) {
+      parts = project(coarse->interp_mtx, parts);
+      rebalance(level->mtx, level->vtx_wgts, parts, p_wgts, max_wgt, handle.refine_iters);
+      refine(level->mtx, level->vtx_wgts, parts, p_wgts, max_wgt, handle.refine_iters);
+    }
+
+    result.parts       = parts;
+    result.edge_cut    = edge_cut(g, parts);
+    auto h_p_wgts      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), p_wgts);
+    ordinal_t heaviest = 0;
+    for (ordinal_t p = 0; p < k; p++) heaviest = std::max(heaviest, h_p_wgts(p));
+    result.imbalance = total_wgt ? static_cast<double>(heaviest) * k / total_wgt : 1.0;
+  }
+};
+
+// Partitions the undirected graph g (a symmetric CrsMatrix without self loops,
+// whose values are edge weights) into k parts of equal vertex count, up to the
+// default imbalance tolerance, while trying to minimize the edge cut.
+template <class crsMat>
+typename graph_partitioner<crsMat>::partition_result partition(const crsMat& g,
+                                                               const typename crsMat::ordinal_type k) {
+  typename graph_partitioner<crsMat>::partition_handle handle;
+  handle.k = k;
+  graph_partitioner<crsMat>::partition(handle, g);
+  return handle.result;
+}
+
+}  // end namespace Experimental
+}  // end namespace KokkosGraph
+// exclude from Cuda builds without lambdas enabled
+#endif
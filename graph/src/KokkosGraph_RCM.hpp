@@ -17,18 +17,32 @@
 #ifndef _KOKKOSGRAPH_RCM_HPP
 #define _KOKKOSGRAPH_RCM_HPP
 
+#include <cstdint>
+#include <stdexcept>
 #include "KokkosGraph_BFS_impl.hpp"
 
 namespace KokkosGraph {
 namespace Experimental {
 
+enum RCM_Algorithm {
+  RCM_SERIAL,   // Single-threaded, on host
+  RCM_PARALLEL  // Level-synchronous, in parallel on device_t
+};
+
 // Compute the reverse Cuthill-McKee ordering of a graph.
 // The graph must be symmetric, but it may have any number of connected
 // components. This function returns a list of vertices in RCM order.
+//
+// RCM_PARALLEL gives the same result on any execution space and for any
+// number of threads. It starts each connected component from its vertex of
+// lowest degree or, if pseudoPeripheralRoot is true, from a pseudo-peripheral
+// vertex found from there (which usually gives a smaller bandwidth).
+// RCM_SERIAL always starts from the vertex of lowest degree.
 
 template <typename device_t, typename rowmap_t, typename colinds_t,
           typename labels_t = typename colinds_t::non_const_type>
-labels_t graph_rcm(const rowmap_t& rowmap, const colinds_t& colinds) {
+labels_t graph_rcm(const rowmap_t& rowmap, const colinds_t& colinds, RCM_Algorithm algo = RCM_PARALLEL,
+                   bool pseudoPeripheralRoot = true) {
   using lno_t = typename colinds_t::non_const_value_type;
   if (rowmap.extent(0) <= 2) {
     // there are 0 or 1 vertices - return trivial ordering
@@ -36,8 +50,95 @@ labels_t graph_rcm(const rowmap_t& rowmap, const colinds_t& colinds) {
     if (numVerts) numVerts--;
     return labels_t("RCM Labels", numVerts);
   }
-  Impl::SerialRCM<rowmap_t, colinds_t, labels_t> algo(rowmap, colinds);
-  return algo.rcm();
+  switch (algo) {
+    case RCM_SERIAL: {
+      Impl::SerialRCM<rowmap_t, colinds_t, labels_t> serial(rowmap, colinds);
+      return serial.rcm();
+    }
+    case RCM_PARALLEL: {
+      Impl::ParallelRCM<device_t, rowmap_t, colinds_t, labels_t> parallel(rowmap, colinds);
+      return parallel.rcm(pseudoPeripheralRoot);
+    }
+  }
+  throw std::invalid_argument("graph_rcm: invalid algorithm");
+}
+
+// Find a pseudo-peripheral vertex (George-Liu) in the connected component of
+// start: a vertex whose eccentricity (number of BFS levels) is close to the
+// diameter of the component. Good starting point for RCM.
+
+template <typename device_t, typename rowmap_t, typename colinds_t>
+typename colinds_t::non_const_value_type graph_pseudo_peripheral_vertex(
+    const rowmap_t& rowmap, const colinds_t& colinds, typename colinds_t::non_const_value_type start) {
+  using lno_t = typename colinds_t::non_const_value_type;
+  lno_t numVerts = std::max(rowmap.extent_int(0), 1) - 1;
+  if (start < 0 || start >= numVerts) throw std::invalid_argument("graph_pseudo_peripheral_vertex: invalid start");
+  Impl::ParallelRCM<device_t, rowmap_t, colinds_t, typename colinds_t::non_const_type> algo(rowmap, colinds);
+  return algo.pseudoPeripheral(start);
+}
+
+// Quality of a graph ordering, as the bandwidth and profile of the adjacency
+// matrix with rows and columns permuted by labels.
+//  bandwidth: max |labels(u) - labels(v)| over all edges (u, v)
+//  profile:   sum over all vertices v of labels(v) - min(labels(u)), for u in
+//             v and its neighbors (size of the lower envelope)
+struct GraphBandwidthProfile {
+  int64_t bandwidth = 0;
+  int64_t profile   = 0;
+};
+
+// Compute bandwidth and profile of the graph, where vertex v is relabeled to
+// labels(v) (for example, the output of graph_rcm). Column indices >=
+// num_verts are ignored.
+
+template <typename device_t, typename rowmap_t, typename colinds_t, typename labels_t>
+GraphBandwidthProfile graph_bandwidth_profile(const rowmap_t& rowmap, const colinds_t& colinds,
+                                              const labels_t& labels) {
+  using exec_space = typename device_t::execution_space;
+  using size_type  = typename rowmap_t::non_const_value_type;
+  using lno_t      = typename colinds_t::non_const_value_type;
+  lno_t numVerts   = std::max(rowmap.extent_int(0), 1) - 1;
+  GraphBandwidthProfile result;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::Bandwidth", Kokkos::RangePolicy<exec_space>(0, numVerts),
+      KOKKOS_LAMBDA(lno_t v, int64_t & lmax) {
+        int64_t lv = labels(v);
+        for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+          lno_t nei = colinds(j);
+          if (nei >= numVerts) continue;
+          int64_t dist = lv - int64_t(labels(nei));
+          if (dist < 0) dist = -dist;
+          if (dist > lmax) lmax = dist;
+        }
+      },
+      Kokkos::Max<int64_t>(result.bandwidth));
+  Kokkos::parallel_reduce(
+      "KokkosGraph::Profile", Kokkos::RangePolicy<exec_space>(0, numVerts),
+      KOKKOS_LAMBDA(lno_t v, int64_t & lsum) {
+        int64_t lv     = labels(v);
+        int64_t lowest = lv;
+        for (size_type j = rowmap(v); j < rowmap(v + 1); j++) {
+          lno_t nei = colinds(j);
+          if (nei >= numVerts) continue;
+          if (labels(nei) < lowest) lowest = labels(nei);
+        }
+        lsum += lv - lowest;
+      },
+      result.profile);
+  return result;
+}
+
+// Bandwidth and profile of the graph in its original order.
+
+template <typename device_t, typename rowmap_t, typename colinds_t>
+GraphBandwidthProfile graph_bandwidth_profile(const rowmap_t& rowmap, const colinds_t& colinds) {
+  using lno_t    = typename colinds_t::non_const_value_type;
+  lno_t numVerts = std::max(rowmap.extent_int(0), 1) - 1;
+  typename colinds_t::non_const_type identity(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Identity"), numVerts);
+  Kokkos::parallel_for(
+      "KokkosGraph::Identity", Kokkos::RangePolicy<typename device_t::execution_space>(0, numVerts),
+      KOKKOS_LAMBDA(lno_t i) { identity(i) = i; });
+  return graph_bandwidth_profile<device_t>(rowmap, colinds, identity);
 }
 
 }  // namespace Experimental
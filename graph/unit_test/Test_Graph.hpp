@@ -22,7 +22,11 @@
 #include "Test_Graph_mis2.hpp"
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
 #include "Test_Graph_coarsen.hpp"
+#include "Test_Graph_partition.hpp"
 #endif
 #include "Test_Graph_rcm.hpp"
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include "Test_Graph_nested_dissection.hpp"
+#endif
 
 #endif  // TEST_GRAPH_HPP
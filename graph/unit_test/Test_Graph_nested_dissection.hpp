@@ -0,0 +1,204 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_NestedDissection.hpp"
+#include "KokkosGraph_RCM.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+// Number of off-diagonal entries in the Cholesky factor L of the graph with
+// vertex v moved to position labels(v), by symbolic elimination along the
+// elimination tree.
+template <typename rowmap_t, typename entries_t, typename labels_t>
+int64_t cholesky_fill(const rowmap_t& rowmap, const entries_t& entries, const labels_t& labels) {
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  lno_t n         = std::max(rowmap.extent_int(0), 1) - 1;
+  std::vector<lno_t> perm(n);
+  for (lno_t v = 0; v < n; v++) perm[labels(v)] = v;
+  std::vector<std::vector<lno_t>> cols(n), children(n);
+  int64_t fill = 0;
+  for (lno_t j = 0; j < n; j++) {
+    std::vector<lno_t>& col = cols[j];
+    const lno_t v           = perm[j];
+    for (size_type k = rowmap(v); k < rowmap(v + 1); k++) {
+      if (labels(entries(k)) > j) col.push_back(labels(entries(k)));
+    }
+    for (lno_t c : children[j]) {
+      for (lno_t i : cols[c])
+        if (i > j) col.push_back(i);
+      std::vector<lno_t>().swap(cols[c]);
+    }
+    std::sort(col.begin(), col.end());
+    col.erase(std::unique(col.begin(), col.end()), col.end());
+    fill += col.size();
+    if (!col.empty()) children[col.front()].push_back(j);
+  }
+  return fill;
+}
+
+template <typename crsMat>
+void verify_nested_dissection(const crsMat& A,
+                              const typename KokkosGraph::Experimental::nd_builder<crsMat>::nd_result& nd) {
+  using lno_t     = typename crsMat::ordinal_type;
+  using size_type = typename crsMat::size_type;
+  const lno_t n   = A.numRows();
+  auto rowmap     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto perm       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nd.perm);
+  auto perm_inv   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nd.perm_inv);
+  ASSERT_EQ(perm.extent(0), static_cast<size_t>(n));
+  ASSERT_EQ(perm_inv.extent(0), static_cast<size_t>(n));
+  // perm is a permutation and perm_inv its inverse
+  std::vector<int> counts(n, 0);
+  for (lno_t i = 0; i < n; i++) {
+    ASSERT_GE(perm(i), 0);
+    ASSERT_LT(perm(i), n);
+    counts[perm(i)]++;
+    ASSERT_EQ(perm_inv(perm(i)), i);
+  }
+  for (lno_t i = 0; i < n; i++) ASSERT_EQ(counts[i], 1);
+
+  // the tree covers [0, n) in postorder
+  const int num_nodes = nd.num_nodes;
+  ASSERT_EQ(nd.tree_ptr.extent_int(0), num_nodes + 1);
+  ASSERT_EQ(nd.tree_parent.extent_int(0), num_nodes);
+  EXPECT_EQ(nd.tree_ptr(0), 0);
+  EXPECT_EQ(nd.tree_ptr(num_nodes), n);
+  for (int s = 0; s < num_nodes; s++) {
+    EXPECT_LT(nd.tree_ptr(s), nd.tree_ptr(s + 1));
+    EXPECT_TRUE(nd.tree_parent(s) == -1 || nd.tree_parent(s) > s);
+  }
+  // each edge joins a node and one of its ancestors (or the node itself), so
+  // eliminating a node creates no fill outside its ancestors
+  std::vector<int> node(n);
+  for (int s = 0; s < num_nodes; s++)
+    for (int i = nd.tree_ptr(s); i < nd.tree_ptr(s + 1); i++) node[i] = s;
+  auto is_ancestor = [&](int a, int s) {
+    while (s != -1 && s < a) s = nd.tree_parent(s);
+    return s == a;
+  };
+  for (lno_t v = 0; v < n; v++) {
+    for (size_type k = rowmap(v); k < rowmap(v + 1); k++) {
+      int s = node[perm_inv(v)], t = node[perm_inv(entries(k))];
+      ASSERT_TRUE(is_ancestor(s, t) || is_ancestor(t, s))
+          << "Edge (" << v << ", " << entries(k) << ") joins tree nodes " << s << " and " << t;
+    }
+  }
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_nested_dissection_7pt(lno_t gridX, lno_t gridY, lno_t gridZ) {
+  using crsMat    = KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using graph_t   = typename crsMat::StaticCrsGraphType;
+  using rowmap_t  = typename graph_t::row_map_type::non_const_type;
+  using entries_t = typename graph_t::entries_type::non_const_type;
+  using values_t  = typename crsMat::values_type::non_const_type;
+  // from Test_Graph_rcm.hpp
+  rowmap_t rowmap;
+  entries_t entries;
+  generate7pt(rowmap, entries, gridX, gridY, gridZ);
+  values_t values("values", entries.extent(0));
+  Kokkos::deep_copy(values, static_cast<scalar>(1));
+  const lno_t n = gridX * gridY * gridZ;
+  crsMat A("A", n, values, graph_t(entries, rowmap));
+
+  for (lno_t leaf_size : {1, 16, 64}) {
+    auto nd = KokkosGraph::Experimental::nested_dissection(A, leaf_size);
+    verify_nested_dissection(A, nd);
+    if (n > leaf_size) EXPECT_GT(nd.num_nodes, 1);
+  }
+
+  // fewer entries in the Cholesky factor than with RCM
+  auto nd          = KokkosGraph::Experimental::nested_dissection(A);
+  auto rcm         = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(rowmap, entries);
+  auto rowmapHost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
+  auto entriesHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  auto ndHost      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nd.perm_inv);
+  auto rcmHost     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rcm);
+  int64_t ndFill   = cholesky_fill(rowmapHost, entriesHost, ndHost);
+  int64_t rcmFill  = cholesky_fill(rowmapHost, entriesHost, rcmHost);
+  EXPECT_LT(ndFill, rcmFill) << "Nested dissection fill " << ndFill << ", RCM fill " << rcmFill;
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_nested_dissection_small() {
+  using crsMat = KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  // empty graph
+  crsMat empty;
+  auto nd = KokkosGraph::Experimental::nested_dissection(empty);
+  EXPECT_EQ(nd.perm.extent(0), 0u);
+  EXPECT_EQ(nd.num_nodes, 0);
+  // a path with self loops, which are ignored
+  const lno_t n = 200;
+  Kokkos::View<size_type*, Kokkos::HostSpace> rowmap("rowmap", n + 1);
+  Kokkos::View<lno_t*, Kokkos::HostSpace> entries("entries", 3 * n - 2);
+  size_type k = 0;
+  for (lno_t i = 0; i < n; i++) {
+    if (i > 0) entries(k++) = i - 1;
+    entries(k++) = i;
+    if (i < n - 1) entries(k++) = i + 1;
+    rowmap(i + 1) = k;
+  }
+  typename crsMat::row_map_type::non_const_type d_rowmap("rowmap", n + 1);
+  typename crsMat::index_type::non_const_type d_entries("entries", k);
+  typename crsMat::values_type::non_const_type d_values("values", k);
+  Kokkos::deep_copy(d_rowmap, rowmap);
+  Kokkos::deep_copy(d_entries, entries);
+  Kokkos::deep_copy(d_values, static_cast<scalar>(2));
+  crsMat A("path", n, n, k, d_values, d_rowmap, d_entries);
+  nd = KokkosGraph::Experimental::nested_dissection(A, lno_t(8));
+  verify_nested_dissection(A, nd);
+  EXPECT_GT(nd.num_nodes, 1);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                                 \
+  TEST_F(TestCategory, graph##_##nested_dissection##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_nested_dissection_small<SCALAR, ORDINAL, OFFSET, DEVICE>();                                  \
+    test_nested_dissection_7pt<SCALAR, ORDINAL, OFFSET, DEVICE>(12, 12, 12);                          \
+    test_nested_dissection_7pt<SCALAR, ORDINAL, OFFSET, DEVICE>(30, 20, 4);                           \
+  }
+
+// FIXME_SYCL
+#ifndef KOKKOS_ENABLE_SYCL
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+#endif
+
+#undef EXECUTE_TEST
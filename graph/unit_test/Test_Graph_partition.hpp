@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_Partition.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosKernels_IOUtils.hpp"
+
+// Checks that the labels are in [0, k), that the reported edge cut and
+// imbalance match the labels, and that the balance constraint holds.
+// Returns the total edge weight of the graph.
+template <class crsMat, class result_t>
+double verify_partition(const crsMat& A, const typename crsMat::ordinal_type k, const result_t& result) {
+  using lno_t     = typename crsMat::ordinal_type;
+  using size_type = typename crsMat::size_type;
+  const lno_t n   = A.numRows();
+  EXPECT_EQ(result.parts.extent(0), static_cast<size_t>(n));
+  if (result.parts.extent(0) != static_cast<size_t>(n)) return 0;
+  auto rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto parts   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result.parts);
+
+  std::vector<lno_t> part_sizes(k, 0);
+  double cut = 0, total = 0;
+  for (lno_t i = 0; i < n; i++) {
+    EXPECT_TRUE(parts(i) >= 0 && parts(i) < k) << "Vertex " << i << " has invalid part " << parts(i);
+    if (parts(i) < 0 || parts(i) >= k) return 0;
+    part_sizes[parts(i)]++;
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++) {
+      total += values(j);
+      if (parts(entries(j)) != parts(i)) cut += values(j);
+    }
+  }
+  cut /= 2;
+  total /= 2;
+  EXPECT_NEAR(result.edge_cut, cut, 1e-8 * (total + 1));
+  lno_t heaviest = 0;
+  for (lno_t p = 0; p < k; p++) heaviest = std::max(heaviest, part_sizes[p]);
+  const double imbalance = n ? static_cast<double>(heaviest) * k / n : 1.0;
+  EXPECT_NEAR(result.imbalance, imbalance, 1e-12);
+  // the partitioner allows one vertex over tol * n / k
+  typename KokkosGraph::Experimental::graph_partitioner<crsMat>::partition_handle handle;
+  EXPECT_LE(heaviest, static_cast<lno_t>(handle.imbalance_tol * n / k) + 1) << "Partition into " << k
+                                                                             << " parts is unbalanced";
+  return total;
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_partition_grid() {
+  using crsMat = KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  // 200 x 300 grid, from Test_Graph_coarsen.hpp
+  crsMat A = gen_grid<crsMat>();
+  for (lno_t k : {1, 2, 4, 7}) {
+    auto result  = KokkosGraph::Experimental::partition(A, k);
+    double total = verify_partition(A, k, result);
+    if (k == 1) {
+      EXPECT_EQ(result.edge_cut, 0);
+    } else {
+      // optimal cuts are a few hundred edges out of about 120000, and a
+      // random assignment cuts most of them
+      EXPECT_LT(result.edge_cut, 0.05 * total) << "Poor edge cut for k = " << k;
+    }
+  }
+}
+
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_partition_random(lno_t numVerts, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using execution_space = typename device::execution_space;
+  using crsMat          = KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  using graph_type      = typename crsMat::StaticCrsGraphType;
+  using c_rowmap_t      = typename graph_type::row_map_type;
+  using c_entries_t     = typename graph_type::entries_type;
+  using rowmap_t        = typename c_rowmap_t::non_const_type;
+  using entries_t       = typename c_entries_t::non_const_type;
+  using svt             = typename crsMat::values_type;
+  using partitioner_t   = KokkosGraph::Experimental::graph_partitioner<crsMat>;
+  // Generate graph
+  crsMat A =
+      KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat>(numVerts, numVerts, nnz, row_size_variance, bandwidth);
+  auto G = A.graph;
+  // Symmetrize the graph
+  rowmap_t symRowmap;
+  entries_t symEntries;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<c_rowmap_t, c_entries_t, rowmap_t, entries_t, execution_space>(
+      numVerts, G.row_map, G.entries, symRowmap, symEntries);
+  graph_type GS(symEntries, symRowmap);
+  svt symValues("sym values", symEntries.extent(0));
+  Kokkos::deep_copy(symValues, static_cast<scalar>(2.5));
+  crsMat AS("A symmetric", numVerts, symValues, GS);
+  for (lno_t k : {2, 3, 16}) {
+    if (k > numVerts) continue;
+    typename partitioner_t::partition_handle handle;
+    handle.k = k;
+    partitioner_t::partition(handle, AS);
+    verify_partition(AS, k, handle.result);
+    EXPECT_GE(handle.result.num_levels, 1);
+  }
+  // invalid part counts are reported
+  EXPECT_THROW(KokkosGraph::Experimental::partition(AS, lno_t(0)), std::runtime_error);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                                  \
+  TEST_F(TestCategory, graph##_##random_graph_partition##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_partition_random<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20, 1000, 10);                 \
+    test_partition_random<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40, 10);                       \
+  }                                                                                                    \
+  TEST_F(TestCategory, graph##_##grid_graph_partition##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {   \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>();                                            \
+  }
+
+// FIXME_SYCL
+#ifndef KOKKOS_ENABLE_SYCL
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+#endif
+
+#undef EXECUTE_TEST
@@ -87,9 +87,11 @@ int maxBandwidth(const rowmap_t& rowmap, const entries_t& entries, const labels_
 }
 
 template <typename device, typename rowmap_t, typename entries_t>
-void test_rcm(const rowmap_t& rowmap, const entries_t& entries, bool expectBandwidthReduced) {
+void test_rcm(const rowmap_t& rowmap, const entries_t& entries, bool expectBandwidthReduced,
+              KokkosGraph::Experimental::RCM_Algorithm algo, bool pseudoPeripheralRoot) {
   using lno_t      = typename entries_t::non_const_value_type;
-  auto rcm         = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(rowmap, entries);
+  auto rcm         = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(rowmap, entries, algo,
+                                                                                   pseudoPeripheralRoot);
   auto rowmapHost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
   auto entriesHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
   auto rcmHost     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rcm);
@@ -107,14 +109,66 @@ void test_rcm(const rowmap_t& rowmap, const entries_t& entries, bool expectBandw
     }
     for (lno_t i = 0; i < numVerts; i++) ASSERT_EQ(counts[i], 1);
   }
+  Kokkos::View<lno_t*, Kokkos::HostSpace> identityOrder(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Identity"),
+                                                        numVerts);
+  for (lno_t i = 0; i < numVerts; i++) identityOrder(i) = i;
+  size_t origBW = maxBandwidth(rowmapHost, entriesHost, identityOrder, identityOrder);
+  size_t rcmBW  = maxBandwidth(rowmapHost, entriesHost, rcmHost, rcmPermHost);
   if (expectBandwidthReduced) {
-    Kokkos::View<lno_t*, Kokkos::HostSpace> identityOrder(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Identity"),
-                                                          numVerts);
-    for (lno_t i = 0; i < numVerts; i++) identityOrder(i) = i;
-    size_t origBW = maxBandwidth(rowmapHost, entriesHost, identityOrder, identityOrder);
-    size_t rcmBW  = maxBandwidth(rowmapHost, entriesHost, rcmHost, rcmPermHost);
     EXPECT_LE(rcmBW, origBW);
   }
+  // graph_bandwidth_profile must agree with the reference bandwidth
+  auto origReport = KokkosGraph::Experimental::graph_bandwidth_profile<device>(rowmap, entries);
+  auto rcmReport  = KokkosGraph::Experimental::graph_bandwidth_profile<device>(rowmap, entries, rcm);
+  EXPECT_EQ(size_t(origReport.bandwidth), origBW);
+  EXPECT_EQ(size_t(rcmReport.bandwidth), rcmBW);
+  EXPECT_GE(rcmReport.profile, 0);
+  if (algo == KokkosGraph::Experimental::RCM_PARALLEL) {
+    // The parallel ordering is deterministic: it must not depend on the
+    // execution space
+    auto rcmOnHost = KokkosGraph::Experimental::graph_rcm<Kokkos::DefaultHostExecutionSpace>(
+        rowmapHost, entriesHost, algo, pseudoPeripheralRoot);
+    for (lno_t i = 0; i < numVerts; i++) ASSERT_EQ(rcmOnHost(i), rcmHost(i));
+  }
+}
+
+template <typename device, typename rowmap_t, typename entries_t>
+void test_rcm(const rowmap_t& rowmap, const entries_t& entries, bool expectBandwidthReduced) {
+  using KokkosGraph::Experimental::RCM_PARALLEL;
+  using KokkosGraph::Experimental::RCM_SERIAL;
+  test_rcm<device>(rowmap, entries, expectBandwidthReduced, RCM_SERIAL, false);
+  test_rcm<device>(rowmap, entries, expectBandwidthReduced, RCM_PARALLEL, false);
+  test_rcm<device>(rowmap, entries, expectBandwidthReduced, RCM_PARALLEL, true);
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_pseudo_peripheral() {
+  using graph_t   = Kokkos::StaticCrsGraph<lno_t, KokkosKernels::default_layout, device, void, size_type>;
+  using rowmap_t  = typename graph_t::row_map_type::non_const_type;
+  using entries_t = typename graph_t::entries_type::non_const_type;
+  // On a path, starting from an interior vertex, the pseudo-peripheral vertex
+  // is one of the two ends
+  lno_t n = 50;
+  rowmap_t rowmap("rowmap", n + 1);
+  entries_t entries("entries", 2 * (n - 1));
+  auto rowmapHost  = Kokkos::create_mirror_view(rowmap);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  size_type k      = 0;
+  for (lno_t i = 0; i < n; i++) {
+    rowmapHost(i) = k;
+    if (i > 0) entriesHost(k++) = i - 1;
+    if (i < n - 1) entriesHost(k++) = i + 1;
+  }
+  rowmapHost(n) = k;
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  lno_t v = KokkosGraph::Experimental::graph_pseudo_peripheral_vertex<device>(rowmap, entries, lno_t(17));
+  EXPECT_TRUE(v == 0 || v == n - 1);
+  // RCM from an end of a path is the path reversed: bandwidth 1
+  auto rcm    = KokkosGraph::Experimental::graph_rcm<device, rowmap_t, entries_t>(rowmap, entries);
+  auto report = KokkosGraph::Experimental::graph_bandwidth_profile<device>(rowmap, entries, rcm);
+  EXPECT_EQ(report.bandwidth, 1);
+  EXPECT_EQ(report.profile, n - 1);
 }
 
 template <typename lno_t, typename size_type, typename device>
@@ -206,6 +260,9 @@ void test_rcm_multiple_components() {
   }                                                                                                      \
   TEST_F(TestCategory, graph##_##rcm_multiple_components##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     test_rcm_multiple_components<ORDINAL, OFFSET, DEVICE>();                                             \
+  }                                                                                                      \
+  TEST_F(TestCategory, graph##_##rcm_pseudo_peripheral##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {   \
+    test_pseudo_peripheral<ORDINAL, OFFSET, DEVICE>();                                                   \
   }
 
 #if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
@@ -0,0 +1,165 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// Measures the algorithms that BatchedGemm can select with
+// BaseHeuristicAlgos::AUTO on the default execution space, for a range of
+// square matrix sizes and batch sizes, and writes the fastest algorithm of
+// each case as the rules of a BatchedGemmTuningTable. Point the environment
+// variable KOKKOSKERNELS_BATCHED_GEMM_TUNING_FILE to the output so that AUTO
+// handles load it.
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosBatched_HostLevel_Gemm.hpp"
+#include "KokkosKernels_TestStringUtils.hpp"
+
+using namespace KokkosBatched;
+
+struct Params {
+  std::string output = "batched_gemm_tuning.txt";
+  int repeat         = 10;
+  bool use_float     = false;
+  // Cases whose batch has more matrix entries than this are skipped
+  size_t max_entries = size_t(1) << 24;
+};
+
+void print_options() {
+  std::cerr << "Options\n" << std::endl;
+  std::cerr << "\t[Optional] --output :: file to write the rules to (default: batched_gemm_tuning.txt)" << std::endl;
+  std::cerr << "\t[Optional] --repeat :: how many times each case is timed (default: 10)" << std::endl;
+  std::cerr << "\t[Optional] --float  :: tune for float instead of double" << std::endl;
+  std::cerr << "\tKokkos options (e.g. --kokkos-num-threads) select the execution space setup." << std::endl;
+}
+
+int parse_inputs(Params& params, int argc, char** argv) {
+  for (int i = 1; i < argc; ++i) {
+    if (0 == Test::string_compare_no_case(argv[i], "--help") || 0 == Test::string_compare_no_case(argv[i], "-h")) {
+      print_options();
+      exit(0);  // note: this is before Kokkos::initialize
+    } else if (0 == Test::string_compare_no_case(argv[i], "--output")) {
+      params.output = argv[++i];
+    } else if (0 == Test::string_compare_no_case(argv[i], "--repeat")) {
+      params.repeat = atoi(argv[++i]);
+    } else if (0 == Test::string_compare_no_case(argv[i], "--float")) {
+      params.use_float = true;
+    } else if (0 == std::string(argv[i]).rfind("--kokkos", 0)) {
+      ;  // handled by Kokkos::initialize
+    } else {
+      std::cerr << "Unrecognized command line argument #" << i << ": " << argv[i] << std::endl;
+      print_options();
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Average time of BatchedGemm with AUTO forced to algo
+template <typename Scalar, typename BatchLayoutType, typename ViewType>
+double time_algo(const int algo, const ViewType& A, const ViewType& B, const ViewType& C, const int repeat) {
+  using N = Trans::NoTranspose;
+  BatchedGemmHandle handle(BaseHeuristicAlgos::AUTO);
+  handle.tuningTable.rules = {{"*", "*", "*", -1, -1, algo}};
+  // Warm-up run
+  BatchedGemm<N, N, BatchLayoutType>(&handle, Scalar(1), A, B, Scalar(0), C);
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  for (int i = 0; i < repeat; ++i) BatchedGemm<N, N, BatchLayoutType>(&handle, Scalar(1), A, B, Scalar(0), C);
+  Kokkos::fence();
+  return timer.seconds() / repeat;
+}
+
+template <typename Scalar, typename BatchLayoutType>
+void tune(const Params& params, BatchedGemmTuningTable& table) {
+  using exec_space  = Kokkos::DefaultExecutionSpace;
+  using view_layout = std::conditional_t<std::is_same<BatchLayoutType, BatchLayout::Left>::value, Kokkos::LayoutRight,
+                                         Kokkos::LayoutLeft>;
+  using view_type   = Kokkos::View<Scalar***, view_layout, exec_space>;
+
+  const bool left          = std::is_same<BatchLayoutType, BatchLayout::Left>::value;
+  const std::string layout = left ? "Left" : "Right";
+  const std::string scalar = Kokkos::ArithTraits<Scalar>::name();
+
+  const std::vector<int> dims    = {2, 4, 8, 12, 16, 20, 24, 28, 32, 40, 48, 64, 96, 128};
+  const std::vector<int> batches = {8, 64, 512, 4096, 32768};
+  std::vector<int> algos         = {BaseKokkosBatchedAlgos::KK_SERIAL, GemmKokkosBatchedAlgos::KK_SERIAL_RANK0};
+  if (KokkosKernels::Impl::is_gpu_exec_space_v<exec_space>) algos.push_back(GemmKokkosBatchedAlgos::KK_DBLBUF);
+
+  Kokkos::Random_XorShift64_Pool<exec_space> pool(123);
+  for (size_t ib = 0; ib < batches.size(); ++ib) {
+    const int batch = batches[ib];
+    std::vector<std::pair<int, int>> best;  // (dim, algo)
+    for (const int dim : dims) {
+      if (size_t(batch) * dim * dim > params.max_entries) break;
+      view_type A, B, C;
+      if (left) {
+        A = view_type("A", batch, dim, dim);
+        B = view_type("B", batch, dim, dim);
+        C = view_type("C", batch, dim, dim);
+      } else {
+        A = view_type("A", dim, dim, batch);
+        B = view_type("B", dim, dim, batch);
+        C = view_type("C", dim, dim, batch);
+      }
+      Kokkos::fill_random(A, pool, Scalar(1));
+      Kokkos::fill_random(B, pool, Scalar(1));
+
+      int best_algo    = -1;
+      double best_time = 0;
+      std::cout << layout << " batch " << batch << " dim " << dim << ":";
+      for (const int algo : algos) {
+        const double time = time_algo<Scalar, BatchLayoutType>(algo, A, B, C, params.repeat);
+        std::cout << " " << BatchedGemmHandle(algo).get_kernel_algo_type_str() << " " << time;
+        if (best_algo < 0 || time < best_time) {
+          best_algo = algo;
+          best_time = time;
+        }
+      }
+      std::cout << std::endl;
+      best.emplace_back(dim, best_algo);
+    }
+
+    // One rule per run of sizes with the same fastest algorithm; the last
+    // rule of the last batch size has no bounds
+    const int max_batch = ib + 1 < batches.size() ? batch : -1;
+    for (size_t i = 0; i < best.size(); ++i) {
+      if (i + 1 < best.size() && best[i + 1].second == best[i].second) continue;
+      const int max_dim = i + 1 < best.size() ? best[i].first : -1;
+      table.rules.push_back({exec_space::name(), scalar, layout, max_dim, max_batch, best[i].second});
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  Params params;
+  if (parse_inputs(params, argc, argv)) return 1;
+
+  Kokkos::initialize(argc, argv);
+  {
+    BatchedGemmTuningTable table;
+    if (params.use_float) {
+      tune<float, BatchLayout::Left>(params, table);
+      tune<float, BatchLayout::Right>(params, table);
+    } else {
+      tune<double, BatchLayout::Left>(params, table);
+      tune<double, BatchLayout::Right>(params, table);
+    }
+    table.save(params.output);
+    std::cout << "Wrote " << table.rules.size() << " rules to " << params.output << std::endl;
+  }
+  Kokkos::finalize();
+  return 0;
+}
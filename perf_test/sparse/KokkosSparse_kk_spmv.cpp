@@ -49,6 +49,7 @@ struct SPMVBenchmarking {
   std::string filename = "";
   bool flush_cache     = false;
   bool non_reuse       = false;
+  bool cache_binary    = false;
 
   // Using the parameters above, run and time spmv where x and y use the given
   // memory layout.
@@ -62,7 +63,10 @@ struct SPMVBenchmarking {
     matrix_type A;
     if (filename != "") {
       std::cout << "Reading A from file \"" << filename << "\"...\n";
-      A        = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(filename.c_str());
+      if (cache_binary)
+        A = KokkosSparse::Impl::read_kokkos_crst_matrix_cached<matrix_type>(filename.c_str());
+      else
+        A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(filename.c_str());
       num_rows = A.numRows();
       num_cols = A.numCols();
     } else {
@@ -195,6 +199,9 @@ void print_help() {
   printf(
       "  --non-reuse           : Use non-reuse interface (without "
       "SPMVHandle)\n");
+  printf(
+      "  --cache-binary        : Keep a binary copy of the -f file next to "
+      "it, and load that on later runs\n");
 }
 
 int main(int argc, char** argv) {
@@ -257,6 +264,10 @@ int main(int argc, char** argv) {
       sb.non_reuse = true;
       continue;
     }
+    if ((strcmp(argv[i], "--cache-binary") == 0)) {
+      sb.cache_binary = true;
+      continue;
+    }
     if ((strcmp(argv[i], "--help") == 0) || (strcmp(argv[i], "-h") == 0)) {
       print_help();
       return 0;
@@ -0,0 +1,506 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSSPARSE_IMPL_CG_HPP_
+#define KOKKOSSPARSE_IMPL_CG_HPP_
+
+/// \file KokkosSparse_cg_impl.hpp
+/// \brief Implementation(s) of the conjugate gradient solver.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosSparse_cg_handle.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_fused.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+template <class CgHandle>
+struct CgWrap {
+  //
+  // Useful types
+  //
+  using execution_space       = typename CgHandle::execution_space;
+  using index_t               = typename CgHandle::nnz_lno_t;
+  using size_type             = typename CgHandle::size_type;
+  using scalar_t              = typename CgHandle::nnz_scalar_t;
+  using HandleDeviceValueType = typename CgHandle::nnz_value_view_t;
+  using karith                = typename Kokkos::ArithTraits<scalar_t>;
+  using device_t              = typename HandleDeviceValueType::device_type;
+  using ST                    = typename karith::val_type;
+  using MT                    = typename karith::mag_type;
+  using Flag                  = typename CgHandle::Flag;
+  using range_policy          = Kokkos::RangePolicy<execution_space, index_t>;
+
+  /**
+   * The three inner products needed by an iteration, computed by a single
+   * reduction: dots = [(r, u), (w, u), (r, r)].
+   */
+  struct FusedDots {
+    typedef ST value_type[];
+    index_t value_count;  // Kokkos needs this for reductions w/ array results
+
+    HandleDeviceValueType r, u, w;
+
+    FusedDots(const HandleDeviceValueType& r_, const HandleDeviceValueType& u_, const HandleDeviceValueType& w_)
+        : value_count(3), r(r_), u(u_), w(w_) {}
+
+    KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+      for (index_t j = 0; j < value_count; ++j) dots[j] = karith::zero();
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+      for (index_t j = 0; j < value_count; ++j) dst[j] += src[j];
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(const index_t i, value_type dots) const {
+      const ST ri = r(i), ui = u(i);
+      dots[0] += karith::conj(ri) * ui;
+      dots[1] += karith::conj(w(i)) * ui;
+      dots[2] += karith::conj(ri) * ri;
+    }
+  };
+
+  /**
+   * Chronopoulos-Gear vector updates:
+   * p = u + beta p, s = w + beta s, x = x + alpha p, r = r - alpha s
+   */
+  template <class XType>
+  struct ChronopoulosGearUpdate {
+    ST alpha, beta;
+    HandleDeviceValueType u, w, p, s, r;
+    XType x;
+
+    ChronopoulosGearUpdate(const ST alpha_, const ST beta_, const HandleDeviceValueType& u_,
+                           const HandleDeviceValueType& w_, const HandleDeviceValueType& p_,
+                           const HandleDeviceValueType& s_, const HandleDeviceValueType& r_, const XType& x_)
+        : alpha(alpha_), beta(beta_), u(u_), w(w_), p(p_), s(s_), r(r_), x(x_) {}
+
+    KOKKOS_INLINE_FUNCTION void operator()(const index_t i) const {
+      const ST pi = u(i) + beta * p(i);
+      const ST si = w(i) + beta * s(i);
+      p(i)        = pi;
+      s(i)        = si;
+      x(i) += alpha * pi;
+      r(i) -= alpha * si;
+    }
+  };
+
+  /**
+   * Ghysels-Vanroose vector updates, fused with the inner products of the
+   * next iteration:
+   * z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p,
+   * x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z,
+   * then dots = [(r, u), (w, u), (r, r)].
+   * Without a preconditioner u = r, q = s and m = w, so only the updates of
+   * z, s, p, x, r and w are done.
+   */
+  template <class XType>
+  struct PipelinedUpdate {
+    typedef ST value_type[];
+    index_t value_count;  // Kokkos needs this for reductions w/ array results
+
+    ST alpha, beta;
+    bool hasPrec;
+    HandleDeviceValueType nv, mv, z, q, s, p, r, u, w;
+    XType x;
+
+    PipelinedUpdate(const ST alpha_, const ST beta_, const bool hasPrec_, const HandleDeviceValueType& nv_,
+                    const HandleDeviceValueType& mv_, const HandleDeviceValueType& z_, const HandleDeviceValueType& q_,
+                    const HandleDeviceValueType& s_, const HandleDeviceValueType& p_, const HandleDeviceValueType& r_,
+                    const HandleDeviceValueType& u_, const HandleDeviceValueType& w_, const XType& x_)
+        : value_count(3),
+          alpha(alpha_),
+          beta(beta_),
+          hasPrec(hasPrec_),
+          nv(nv_),
+          mv(mv_),
+          z(z_),
+          q(q_),
+          s(s_),
+          p(p_),
+          r(r_),
+          u(u_),
+          w(w_),
+          x(x_) {}
+
+    KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+      for (index_t j = 0; j < value_count; ++j) dots[j] = karith::zero();
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+      for (index_t j = 0; j < value_count; ++j) dst[j] += src[j];
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(const index_t i, value_type dots) const {
+      const ST wi = w(i);
+      const ST zi = nv(i) + beta * z(i);
+      const ST si = wi + beta * s(i);
+      const ST pi = u(i) + beta * p(i);
+      z(i)        = zi;
+      s(i)        = si;
+      p(i)        = pi;
+      x(i) += alpha * pi;
+      const ST ri = r(i) - alpha * si;
+      const ST wn = wi - alpha * zi;
+      r(i)        = ri;
+      w(i)        = wn;
+      ST ui       = ri;
+      if (hasPrec) {
+        const ST qi = mv(i) + beta * q(i);
+        q(i)        = qi;
+        ui          = u(i) - alpha * qi;
+        u(i)        = ui;
+      }
+      dots[0] += karith::conj(ri) * ui;
+      dots[1] += karith::conj(wn) * ui;
+      dots[2] += karith::conj(ri) * ri;
+    }
+  };
+
+  /**
+   * r = b - Ax. Returns the norm of r.
+   */
+  template <class AMatrix, class BType, class XType>
+  static MT true_residual(const AMatrix& A, const BType& B, const XType& X, const HandleDeviceValueType& R) {
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -karith::one(), A, X, karith::one(), R);  // r = b - Ax
+    return KokkosBlas::nrm2(R);
+  }
+
+  /**
+   * Called when the recursively updated residual has converged. Overwrites r
+   * with the true residual and returns true if the solver should stop: the
+   * true residual has converged too (Conv), or it did not decrease since the
+   * previous check (LOA). Otherwise the caller restarts its recurrences from
+   * the true residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static bool check_true_residual(const AMatrix& A, const BType& B, const XType& X, const HandleDeviceValueType& R,
+                                  const MT nrmB, const MT tol, const bool verbose, MT& relRes, Flag& flag) {
+    const MT prevRelRes = relRes;
+    relRes              = true_residual(A, B, X, R) / nrmB;
+    if (verbose) {
+      std::cout << "True relative residual is: " << relRes << std::endl;
+    }
+    if (relRes < tol) {
+      flag = CgHandle::Flag::Conv;
+      return true;
+    }
+    if (!(relRes < prevRelRes)) {
+      flag = CgHandle::Flag::LOA;
+      return true;
+    }
+    if (verbose) {
+      std::cout << "Restarting from the true residual." << std::endl;
+    }
+    return false;
+  }
+
+  /**
+   * Hestenes-Stiefel CG: (p, Ap) and then [(r, Mr), (r, r)] are two
+   * synchronizing reductions per iteration. R holds the initial residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static Flag cg_classical(const CgHandle& thandle, const AMatrix& A, const BType& B, XType& X,
+                           KokkosSparse::Experimental::Preconditioner<AMatrix>* precond, const MT nrmB,
+                           const HandleDeviceValueType& R, int& numIters, MT& relRes) {
+    const ST one       = karith::one();
+    const ST zero      = karith::zero();
+    const auto n       = A.numPointRows();
+    const int maxIters = thandle.get_max_iters();
+    const auto tol     = thandle.get_tol();
+    const auto verbose = thandle.get_verbose();
+    Flag flag          = CgHandle::Flag::NoConv;
+    const bool hasPrec = precond != nullptr;
+    using HostDotsType = typename HandleDeviceValueType::HostMirror;
+
+    HandleDeviceValueType U = R, P("P", n), W(Kokkos::view_alloc(Kokkos::WithoutInitializing, "W"), n),
+                          dots("dots", 3);
+    HostDotsType dots_h = Kokkos::create_mirror_view(dots);
+    if (hasPrec) U = HandleDeviceValueType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U"), n);
+
+    ST rz        = zero;
+    bool restart = true;
+    while (numIters < maxIters) {
+      if (restart) {
+        if (hasPrec) precond->apply(R, U);  // u = Mr
+        Kokkos::deep_copy(P, U);
+        rz      = KokkosBlas::dot(R, U);
+        restart = false;
+      }
+      ST pw;
+      if constexpr (KokkosSparse::is_crs_matrix_v<AMatrix>) {
+        // w = Ap and (p, w) in one pass over w
+        KokkosSparse::Experimental::spmv_dot("N", one, A, P, W, Kokkos::subview(dots, Kokkos::make_pair(0, 2)));
+        Kokkos::deep_copy(dots_h, dots);
+        pw = dots_h(0);
+      } else {
+        KokkosSparse::spmv("N", one, A, P, zero, W);  // w = Ap
+        pw = KokkosBlas::dot(P, W);
+      }
+      if (pw == zero) break;
+      const ST alpha = rz / pw;
+      KokkosBlas::axpy(alpha, P, X);   // x = x + alpha p
+      KokkosBlas::axpy(-alpha, W, R);  // r = r - alpha w
+      if (hasPrec) precond->apply(R, U);
+      Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n), FusedDots(R, U, U), dots);
+      Kokkos::deep_copy(dots_h, dots);
+      numIters++;
+
+      const MT recRelRes = Kokkos::sqrt(karith::abs(dots_h(2))) / nrmB;
+      if (verbose) {
+        std::cout << "Relative residual for iteration " << numIters << " is: " << recRelRes << std::endl;
+      }
+      if (recRelRes < tol) {
+        if (check_true_residual(A, B, X, R, nrmB, tol, verbose, relRes, flag)) return flag;
+        restart = true;
+        continue;
+      }
+      const ST beta = dots_h(0) / rz;
+      rz            = dots_h(0);
+      KokkosBlas::axpby(one, U, beta, P);  // p = u + beta p
+    }
+    relRes = true_residual(A, B, X, R) / nrmB;
+    return relRes < tol ? CgHandle::Flag::Conv : flag;
+  }
+
+  /**
+   * Chronopoulos-Gear CG: (r, u), (w, u) and (r, r) come from one reduction
+   * per iteration, with u = Mr and w = Au. R holds the initial residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static Flag cg_chronopoulos_gear(const CgHandle& thandle, const AMatrix& A, const BType& B, XType& X,
+                                   KokkosSparse::Experimental::Preconditioner<AMatrix>* precond, const MT nrmB,
+                                   const HandleDeviceValueType& R, int& numIters, MT& relRes) {
+    const ST one       = karith::one();
+    const ST zero      = karith::zero();
+    const auto n       = A.numPointRows();
+    const int maxIters = thandle.get_max_iters();
+    const auto tol     = thandle.get_tol();
+    const auto verbose = thandle.get_verbose();
+    Flag flag          = CgHandle::Flag::NoConv;
+    const bool hasPrec = precond != nullptr;
+    using HostDotsType = typename HandleDeviceValueType::HostMirror;
+
+    HandleDeviceValueType U = R, W(Kokkos::view_alloc(Kokkos::WithoutInitializing, "W"), n), P("P", n), S("S", n),
+                          dots("dots", 3);
+    HostDotsType dots_h = Kokkos::create_mirror_view(dots);
+    if (hasPrec) U = HandleDeviceValueType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U"), n);
+
+    ST gammaOld = zero, alphaOld = zero;
+    bool first  = true;  // First iteration since the (re)start
+    if (hasPrec) precond->apply(R, U);            // u = Mr
+    KokkosSparse::spmv("N", one, A, U, zero, W);  // w = Au
+    while (true) {
+      Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n), FusedDots(R, U, W), dots);
+      Kokkos::deep_copy(dots_h, dots);
+      const ST gamma = dots_h(0), delta = dots_h(1);
+
+      const MT recRelRes = Kokkos::sqrt(karith::abs(dots_h(2))) / nrmB;
+      if (verbose) {
+        std::cout << "Relative residual for iteration " << numIters << " is: " << recRelRes << std::endl;
+      }
+      if (recRelRes < tol) {
+        if (check_true_residual(A, B, X, R, nrmB, tol, verbose, relRes, flag)) return flag;
+        first = true;
+        if (hasPrec) precond->apply(R, U);
+        KokkosSparse::spmv("N", one, A, U, zero, W);
+        continue;
+      }
+      if (numIters >= maxIters) break;
+
+      const ST beta  = first ? zero : gamma / gammaOld;
+      const ST denom = first ? delta : delta - beta * gamma / alphaOld;
+      if (denom == zero) break;
+      const ST alpha = gamma / denom;
+      Kokkos::parallel_for("KokkosSparse::cg::update", range_policy(0, n),
+                           ChronopoulosGearUpdate<XType>(alpha, beta, U, W, P, S, R, X));
+      if (hasPrec) precond->apply(R, U);            // u = Mr
+      KokkosSparse::spmv("N", one, A, U, zero, W);  // w = Au
+      gammaOld = gamma;
+      alphaOld = alpha;
+      first    = false;
+      numIters++;
+    }
+    relRes = true_residual(A, B, X, R) / nrmB;
+    return relRes < tol ? CgHandle::Flag::Conv : flag;
+  }
+
+  /**
+   * Pipelined (Ghysels-Vanroose) CG: the vector updates of an iteration are
+   * fused with the reduction [(r, u), (w, u), (r, r)] needed by the next one.
+   * That reduction is launched asynchronously, and the preconditioner apply
+   * m = Mw and the spmv n = Am are issued before waiting for its result.
+   * R holds the initial residual.
+   */
+  template <class AMatrix, class BType, class XType>
+  static Flag cg_pipelined(const CgHandle& thandle, const AMatrix& A, const BType& B, XType& X,
+                           KokkosSparse::Experimental::Preconditioner<AMatrix>* precond, const MT nrmB,
+                           const HandleDeviceValueType& R, int& numIters, MT& relRes) {
+    const ST one       = karith::one();
+    const ST zero      = karith::zero();
+    const auto n       = A.numPointRows();
+    const int maxIters = thandle.get_max_iters();
+    const auto tol     = thandle.get_tol();
+    const auto verbose = thandle.get_verbose();
+    Flag flag          = CgHandle::Flag::NoConv;
+    const bool hasPrec = precond != nullptr;
+    using HostDotsType = typename HandleDeviceValueType::HostMirror;
+
+    // Without a preconditioner u = r, q = s and m = w
+    HandleDeviceValueType U = R, W(Kokkos::view_alloc(Kokkos::WithoutInitializing, "W"), n), P("P", n), S("S", n),
+                          Z("Z", n), Nv(Kokkos::view_alloc(Kokkos::WithoutInitializing, "N"), n), Q = S, Mv = W,
+                          dots("dots", 3);
+    HostDotsType dots_h = Kokkos::create_mirror_view(dots);
+    if (hasPrec) {
+      U  = HandleDeviceValueType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U"), n);
+      Q  = HandleDeviceValueType("Q", n);
+      Mv = HandleDeviceValueType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "M"), n);
+    }
+
+    ST gammaOld = zero, alphaOld = zero;
+    bool first  = true;  // First iteration since the (re)start
+    if (hasPrec) precond->apply(R, U);            // u = Mr
+    KokkosSparse::spmv("N", one, A, U, zero, W);  // w = Au
+    Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n), FusedDots(R, U, W), dots);
+    while (true) {
+      // Overlapped with the reduction in flight
+      if (hasPrec) precond->apply(W, Mv);             // m = Mw
+      KokkosSparse::spmv("N", one, A, Mv, zero, Nv);  // n = Am
+      Kokkos::deep_copy(dots_h, dots);
+      const ST gamma = dots_h(0), delta = dots_h(1);
+
+      const MT recRelRes = Kokkos::sqrt(karith::abs(dots_h(2))) / nrmB;
+      if (verbose) {
+        std::cout << "Relative residual for iteration " << numIters << " is: " << recRelRes << std::endl;
+      }
+      if (recRelRes < tol) {
+        if (check_true_residual(A, B, X, R, nrmB, tol, verbose, relRes, flag)) return flag;
+        first = true;
+        if (hasPrec) precond->apply(R, U);
+        KokkosSparse::spmv("N", one, A, U, zero, W);
+        Kokkos::parallel_reduce("KokkosSparse::cg::dots", range_policy(0, n), FusedDots(R, U, W), dots);
+        continue;
+      }
+      if (numIters >= maxIters) break;
+
+      const ST beta  = first ? zero : gamma / gammaOld;
+      const ST denom = first ? delta : delta - beta * gamma / alphaOld;
+      if (denom == zero) break;
+      const ST alpha = gamma / denom;
+      Kokkos::parallel_reduce("KokkosSparse::cg::pipelined_update", range_policy(0, n),
+                              PipelinedUpdate<XType>(alpha, beta, hasPrec, Nv, Mv, Z, Q, S, P, R, U, W, X), dots);
+      gammaOld = gamma;
+      alphaOld = alpha;
+      first    = false;
+      numIters++;
+    }
+    relRes = true_residual(A, B, X, R) / nrmB;
+    return relRes < tol ? CgHandle::Flag::Conv : flag;
+  }
+
+  /**
+   * The main cg numeric function.
+   */
+  template <class AMatrix, class BType, class XType>
+  static void cg(CgHandle& thandle, const AMatrix& A, const BType& B, XType& X,
+                 KokkosSparse::Experimental::Preconditioner<AMatrix>* precond = nullptr) {
+    Kokkos::Profiling::pushRegion("CG::TotalTime:");
+
+    // Store solver options:
+    const auto n        = A.numPointRows();
+    const auto maxIters = thandle.get_max_iters();
+    const auto tol      = thandle.get_tol();
+    const auto algo     = thandle.get_algorithm();
+    const auto verbose  = thandle.get_verbose();
+
+    if (verbose) {
+      std::cout << "Starting CG with..." << std::endl;
+      std::cout << "  n:         " << n << std::endl;
+      std::cout << "  maxIters:  " << maxIters << std::endl;
+      std::cout << "  tol:       " << tol << std::endl;
+      std::cout << "  algorithm: "
+                << ((algo == CgHandle::Algorithm::CLASSICAL)
+                        ? "classical"
+                        : ((algo == CgHandle::Algorithm::CHRONOPOULOS_GEAR) ? "Chronopoulos-Gear" : "pipelined"))
+                << std::endl;
+      std::cout << "  precond:   " << (precond ? "ON" : "OFF") << std::endl;
+    }
+
+    HandleDeviceValueType R(Kokkos::view_alloc(Kokkos::WithoutInitializing, "R"), n);  // Residual vector
+
+    // Compute initial residuals:
+    const MT nrmB  = KokkosBlas::nrm2(B);
+    const MT nrmR0 = true_residual(A, B, X, R);
+    MT relRes;
+    if (nrmB != 0) {
+      relRes = nrmR0 / nrmB;
+    } else if (nrmR0 == 0) {
+      relRes = nrmR0;
+    } else {  // B is zero, but X has wrong initial guess.
+      Kokkos::deep_copy(X, 0.0);
+      relRes = 0;
+    }
+    if (verbose) {
+      std::cout << "Initial relative residual is: " << relRes << std::endl;
+    }
+
+    int num_iters = 0;
+    Flag conv_flag_val;
+    if (relRes < tol) {
+      conv_flag_val = CgHandle::Flag::Conv;
+    } else if (algo == CgHandle::Algorithm::CLASSICAL) {
+      conv_flag_val = cg_classical(thandle, A, B, X, precond, nrmB, R, num_iters, relRes);
+    } else if (algo == CgHandle::Algorithm::CHRONOPOULOS_GEAR) {
+      conv_flag_val = cg_chronopoulos_gear(thandle, A, B, X, precond, nrmB, R, num_iters, relRes);
+    } else {
+      conv_flag_val = cg_pipelined(thandle, A, B, X, precond, nrmB, R, num_iters, relRes);
+    }
+
+    if (verbose) {
+      std::cout << "Ending relative residual is: " << relRes << std::endl;
+      if (conv_flag_val == CgHandle::Flag::Conv) {
+        std::cout << "Solver converged! " << std::endl;
+      } else if (conv_flag_val == CgHandle::Flag::LOA) {
+        std::cout << "Recursive residual converged, but solver experienced a loss "
+                     "of accuracy."
+                  << std::endl;
+      } else {
+        std::cout << "Solver did not converge. :( " << std::endl;
+      }
+      std::cout << "The solver completed " << num_iters << " iterations." << std::endl;
+    }
+
+    thandle.set_stats(num_iters, relRes, conv_flag_val);
+
+    Kokkos::Profiling::popRegion();
+  }  // end cg
+
+};  // struct CgWrap
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
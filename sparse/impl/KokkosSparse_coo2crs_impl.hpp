@@ -19,6 +19,7 @@
 #include <Kokkos_StdAlgorithms.hpp>
 #include "Kokkos_UnorderedMap.hpp"
 #include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
 
 namespace KokkosSparse {
 namespace Impl {
@@ -250,6 +251,179 @@ class Coo2Crs {
 
   CrsType get_crsMat() { return CrsType("coo2crs", m_nrows, m_ncols, m_nnz, m_crs_vals, m_crs_row_map, m_crs_col_ids); }
 };
+
+// Two-phase assembly for a COO stream whose (row, col) tuples do not change.
+// Symbolic groups the tuples by row, sorts each row by column and builds the
+// CRS pattern together with a map from each tuple to its CRS slot (-1 for the
+// tuples with a negative row or column, which are skipped as in Coo2Crs).
+// Numeric then only scatter-adds the data through the map.
+
+template <class RowViewType, class ColViewType, class CountsViewType>
+struct Coo2CrsCountFunctor {
+  Coo2CrsCountFunctor(const RowViewType &row_, const ColViewType &col_, const CountsViewType &counts_,
+                      const int64_t nrows_, const int64_t ncols_)
+      : row(row_), col(col_), counts(counts_), nrows(nrows_), ncols(ncols_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t idx) const {
+    const int64_t i = row(idx);
+    const int64_t j = col(idx);
+    if (i >= nrows || j >= ncols) {
+      Kokkos::abort("tuple is out of bounds");
+    } else if (i >= 0 && j >= 0) {
+      Kokkos::atomic_inc(&counts(i));
+    }
+  }
+
+  RowViewType row;
+  ColViewType col;
+  CountsViewType counts;
+  int64_t nrows;
+  int64_t ncols;
+};
+
+// Groups the tuples by row, in any order within a row
+template <class RowViewType, class ColViewType, class CursorViewType, class ColsViewType, class TuplesViewType>
+struct Coo2CrsBucketFunctor {
+  Coo2CrsBucketFunctor(const RowViewType &row_, const ColViewType &col_, const CursorViewType &cursor_,
+                       const ColsViewType &bucketCols_, const TuplesViewType &bucketTuples_)
+      : row(row_), col(col_), cursor(cursor_), bucketCols(bucketCols_), bucketTuples(bucketTuples_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t idx) const {
+    const int64_t i = row(idx);
+    const int64_t j = col(idx);
+    if (i >= 0 && j >= 0) {
+      auto pos          = Kokkos::atomic_fetch_add(&cursor(i), 1);
+      bucketCols(pos)   = j;
+      bucketTuples(pos) = idx;
+    }
+  }
+
+  RowViewType row;
+  ColViewType col;
+  CursorViewType cursor;
+  ColsViewType bucketCols;
+  TuplesViewType bucketTuples;
+};
+
+// Counts (into crsRowmap) or fills (into crsCols and map) the unique columns
+// of each row, whose tuples are sorted by column
+template <class RowmapViewType, class ColsViewType, class TuplesViewType, class CrsRowmapViewType,
+          class CrsColsViewType, class MapViewType>
+struct Coo2CrsUniqueFunctor {
+  using size_type = typename CrsRowmapViewType::non_const_value_type;
+
+  Coo2CrsUniqueFunctor(const RowmapViewType &bucketRowmap_, const ColsViewType &bucketCols_,
+                       const TuplesViewType &bucketTuples_, const CrsRowmapViewType &crsRowmap_,
+                       const CrsColsViewType &crsCols_, const MapViewType &map_, const bool count_)
+      : bucketRowmap(bucketRowmap_),
+        bucketCols(bucketCols_),
+        bucketTuples(bucketTuples_),
+        crsRowmap(crsRowmap_),
+        crsCols(crsCols_),
+        map(map_),
+        count(count_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t i) const {
+    const auto begin = bucketRowmap(i);
+    const auto end   = bucketRowmap(i + 1);
+    if (count) {
+      size_type unique = 0;
+      for (auto k = begin; k < end; k++) unique += (k == begin || bucketCols(k) != bucketCols(k - 1));
+      crsRowmap(i) = unique;
+    } else {
+      size_type slot = crsRowmap(i);
+      for (auto k = begin; k < end; k++) {
+        if (k != begin && bucketCols(k) != bucketCols(k - 1)) slot++;
+        crsCols(slot)        = bucketCols(k);
+        map(bucketTuples(k)) = slot;
+      }
+    }
+  }
+
+  RowmapViewType bucketRowmap;
+  ColsViewType bucketCols;
+  TuplesViewType bucketTuples;
+  CrsRowmapViewType crsRowmap;
+  CrsColsViewType crsCols;
+  MapViewType map;
+  bool count;
+};
+
+template <class MapViewType, class DataViewType, class ValuesViewType>
+struct Coo2CrsScatterFunctor {
+  Coo2CrsScatterFunctor(const MapViewType &map_, const DataViewType &data_, const ValuesViewType &values_)
+      : map(map_), data(data_), values(values_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t idx) const {
+    const auto slot = map(idx);
+    if (slot >= 0) Kokkos::atomic_add(&values(slot), data(idx));
+  }
+
+  MapViewType map;
+  DataViewType data;
+  ValuesViewType values;
+};
+
+template <class CrsType, class RowViewType, class ColViewType, class MapViewType>
+CrsType coo2crs_symbolic_impl(const int64_t m, const int64_t n, const RowViewType &row, const ColViewType &col,
+                              MapViewType &map) {
+  using ExecSpace    = typename CrsType::execution_space;
+  using size_type    = typename CrsType::size_type;
+  using ordinal_type = typename CrsType::ordinal_type;
+  using RowmapView   = typename CrsType::row_map_type::non_const_type;
+  using ColsView     = typename CrsType::index_type::non_const_type;
+  using ValuesView   = typename CrsType::values_type::non_const_type;
+  using TuplesView   = Kokkos::View<typename MapViewType::non_const_value_type *, ExecSpace>;
+  using range_type   = Kokkos::RangePolicy<ExecSpace, int64_t>;
+
+  ExecSpace exec;
+  const int64_t n_tuples = row.extent(0);
+  map                    = MapViewType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "coo2crs map"), n_tuples);
+  Kokkos::deep_copy(exec, map, -1);
+
+  // tuples grouped by row
+  RowmapView bucketRowmap("coo2crs bucket rowmap", m + 1);
+  Kokkos::parallel_for("KokkosSparse::coo2crs_symbolic::Count", range_type(exec, 0, n_tuples),
+                       Coo2CrsCountFunctor<RowViewType, ColViewType, RowmapView>(row, col, bucketRowmap, m, n));
+  size_type n_valid = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, m + 1, bucketRowmap, n_valid);
+  RowmapView cursor(Kokkos::view_alloc(Kokkos::WithoutInitializing, "coo2crs cursor"), m + 1);
+  Kokkos::deep_copy(exec, cursor, bucketRowmap);
+  ColsView bucketCols(Kokkos::view_alloc(Kokkos::WithoutInitializing, "coo2crs bucket cols"), n_valid);
+  TuplesView bucketTuples(Kokkos::view_alloc(Kokkos::WithoutInitializing, "coo2crs bucket tuples"), n_valid);
+  Kokkos::parallel_for("KokkosSparse::coo2crs_symbolic::Bucket", range_type(exec, 0, n_tuples),
+                       Coo2CrsBucketFunctor<RowViewType, ColViewType, RowmapView, ColsView, TuplesView>(
+                           row, col, cursor, bucketCols, bucketTuples));
+  KokkosSparse::sort_crs_matrix(exec, bucketRowmap, bucketCols, bucketTuples, ordinal_type(n));
+
+  // one CRS entry per unique column of each row
+  using unique_type = Coo2CrsUniqueFunctor<RowmapView, ColsView, TuplesView, RowmapView, ColsView, MapViewType>;
+  RowmapView crsRowmap("coo2crs row map", m + 1);
+  ColsView crsCols;
+  Kokkos::parallel_for("KokkosSparse::coo2crs_symbolic::CountUnique", range_type(exec, 0, m),
+                       unique_type(bucketRowmap, bucketCols, bucketTuples, crsRowmap, crsCols, map, true));
+  size_type nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, m + 1, crsRowmap, nnz);
+  crsCols = ColsView(Kokkos::view_alloc(Kokkos::WithoutInitializing, "coo2crs col ids"), nnz);
+  Kokkos::parallel_for("KokkosSparse::coo2crs_symbolic::FillUnique", range_type(exec, 0, m),
+                       unique_type(bucketRowmap, bucketCols, bucketTuples, crsRowmap, crsCols, map, false));
+  ValuesView values("coo2crs values", nnz);
+  exec.fence();
+  return CrsType("coo2crs", ordinal_type(m), ordinal_type(n), nnz, values, crsRowmap, crsCols);
+}
+
+template <class MapViewType, class DataViewType, class CrsType>
+void coo2crs_numeric_impl(const MapViewType &map, const DataViewType &data, CrsType &crsMat) {
+  using ExecSpace  = typename CrsType::execution_space;
+  using ValuesView = typename CrsType::values_type::non_const_type;
+  ExecSpace exec;
+  Kokkos::deep_copy(exec, crsMat.values, Kokkos::ArithTraits<typename CrsType::non_const_value_type>::zero());
+  Kokkos::parallel_for("KokkosSparse::coo2crs_numeric::Scatter",
+                       Kokkos::RangePolicy<ExecSpace, int64_t>(exec, 0, int64_t(map.extent(0))),
+                       Coo2CrsScatterFunctor<MapViewType, DataViewType, ValuesView>(map, data, crsMat.values));
+  exec.fence();
+}
+
 }  // namespace Impl
 }  // namespace KokkosSparse
 
@@ -28,8 +28,14 @@
 #include <KokkosBlas.hpp>
 #include <KokkosBlas3_trsm_impl.hpp>
 #include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_matrix_free.hpp>
 #include <KokkosSparse_Preconditioner.hpp>
 #include "KokkosKernels_Error.hpp"
+#include "KokkosBatched_Eigenvalue_Serial_Internal.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace KokkosSparse {
 namespace Impl {
@@ -48,9 +54,272 @@ struct GmresWrap {
   using HandleDeviceRowMapType  = typename GmresHandle::nnz_row_view_t;
   using HandleDeviceValueType   = typename GmresHandle::nnz_value_view_t;
   using HandleDevice2dValueType = typename GmresHandle::nnz_value_view2d_t;
+  using HandleHost2dValueType   = typename HandleDevice2dValueType::HostMirror;
   using karith                  = typename Kokkos::ArithTraits<scalar_t>;
   using device_t                = typename HandleDeviceEntriesType::device_type;
 
+  /**
+   * Parameters of the Newton basis used by s-step GMRES. Vector c+1 of a
+   * block is (Op - shift_c) u_c / sigma_c, where u_0 is the last orthonormal
+   * basis vector and Op = A*M. A complex pair of shifts a +/- bi takes two
+   * consecutive steps (shiftIm > 0, then shiftIm < 0) and is applied in real
+   * arithmetic as (Op - a)^2 + b^2.
+   */
+  struct SStepBasis {
+    using MT = typename karith::mag_type;
+    std::vector<MT> shiftRe, shiftIm, sigma;
+    bool haveShifts = false;  // Until the first Ritz values are known, the basis is scaled monomial
+    explicit SStepBasis(const int s) : shiftRe(s, MT(0)), shiftIm(s, MT(0)), sigma(s, MT(1)) {}
+  };
+
+  /**
+   * In-place Cholesky factorization G = R^H R of the leading t x t block of a
+   * Gram matrix; R overwrites the upper triangle. Returns the number of
+   * leading columns with a numerically positive pivot.
+   */
+  template <class HostView>
+  static int cholesky_upper(const HostView& G, const int t) {
+    using MT = typename karith::mag_type;
+    for (int c = 0; c < t; c++) {
+      for (int i = 0; i < c; i++) {
+        scalar_t sum = G(i, c);
+        for (int k = 0; k < i; k++) sum -= karith::conj(G(k, i)) * G(k, c);
+        G(i, c) = sum / G(i, i);
+      }
+      const MT gcc = karith::real(G(c, c));
+      MT d         = gcc;
+      for (int k = 0; k < c; k++) d -= karith::abs(G(k, c)) * karith::abs(G(k, c));
+      if (!(d > 10 * karith::eps() * gcc)) return c;
+      G(c, c) = scalar_t(Kokkos::sqrt(d));
+    }
+    return t;
+  }
+
+  /**
+   * Rinv := R^{-1} for the leading t x t block of an upper triangular R.
+   */
+  template <class HostViewIn, class HostViewOut>
+  static void invert_upper(const HostViewIn& R, const HostViewOut& Rinv, const int t) {
+    for (int c = 0; c < t; c++) {
+      for (int i = c + 1; i < t; i++) Rinv(i, c) = karith::zero();
+      Rinv(c, c) = karith::one() / R(c, c);
+      for (int i = c - 1; i >= 0; i--) {
+        scalar_t sum = karith::zero();
+        for (int k = i + 1; k <= c; k++) sum += R(i, k) * Rinv(k, c);
+        Rinv(i, c) = -sum / R(i, i);
+      }
+    }
+  }
+
+  /**
+   * Set the shifts of the Newton basis to the Ritz values of the leading
+   * t x t block of the Hessenberg matrix H, in Leja order. For complex scalar
+   * types, or if the eigenvalue iteration fails, the shifts stay zero.
+   */
+  template <class HostView>
+  static void set_newton_shifts(const HostView& H, const int t, SStepBasis& basis) {
+    using MT         = typename karith::mag_type;
+    basis.haveShifts = true;
+    if constexpr (!karith::is_complex) {
+      const int s = basis.shiftRe.size();
+      std::vector<MT> Hc(t * t), er(t), ei(t, MT(0));
+      for (int i = 0; i < t; i++)
+        for (int k = 0; k < t; k++) Hc[i * t + k] = H(i, k);
+      if (t == 1)
+        er[0] = Hc[0];
+      else if (KokkosBatched::SerialEigenvalueInternal::invoke(t, Hc.data(), t, 1, er.data(), 1, ei.data(), 1) != 0)
+        return;
+      for (int i = 0; i < t; i++)
+        if (!Kokkos::isfinite(er[i]) || !Kokkos::isfinite(ei[i])) return;
+
+      // Leja order: each shift maximizes the product of its distances to the
+      // previous ones. The two members of a complex pair stay adjacent.
+      std::vector<int> order;
+      std::vector<bool> used(t, false);
+      while (int(order.size()) < t) {
+        int best     = -1;
+        MT bestScore = 0;
+        for (int i = 0; i < t; i++) {
+          if (used[i] || ei[i] < 0) continue;
+          MT score = 0;
+          if (order.empty())
+            score = std::hypot(er[i], ei[i]);
+          else
+            for (int k : order) score += std::log(std::hypot(er[i] - er[k], ei[i] - ei[k]));
+          if (best < 0 || score > bestScore) {
+            best      = i;
+            bestScore = score;
+          }
+        }
+        if (best < 0) break;
+        used[best] = true;
+        order.push_back(best);
+        for (int i = 0; ei[best] > 0 && i < t; i++) {
+          if (!used[i] && ei[i] == -ei[best] && er[i] == er[best]) {
+            used[i] = true;
+            order.push_back(i);
+            break;
+          }
+        }
+      }
+
+      // Cycle through the Ritz values if there are fewer than s of them. A
+      // pair that does not fit in the block is replaced by its real part.
+      const int numRitz = order.size();
+      for (int c = 0, k = 0; c < s && numRitz > 0;) {
+        const int i     = order[k % numRitz];
+        const bool pair = ei[i] > 0 && k % numRitz + 1 < numRitz;
+        if (pair && c + 1 < s) {
+          basis.shiftRe[c]     = er[i];
+          basis.shiftIm[c]     = ei[i];
+          basis.shiftRe[c + 1] = er[i];
+          basis.shiftIm[c + 1] = -ei[i];
+          c += 2;
+        } else {
+          basis.shiftRe[c] = er[i];
+          basis.shiftIm[c] = 0;
+          c++;
+        }
+        k += pair ? 2 : 1;
+      }
+    }
+  }
+
+  /**
+   * One block of s-step GMRES: build up to t new basis vectors, in columns
+   * j+1, ..., j+t of V, with t products by A (and M), then orthogonalize
+   * them against columns 0, ..., j with two passes of block classical
+   * Gram-Schmidt and among themselves with CholQR2. This takes four global
+   * reductions for the whole block. The matching columns j, ..., j+t-1 of
+   * the (unrotated) Hessenberg matrix are recovered on host from the change
+   * of basis. Returns the number of new columns, which is less than t if the
+   * block lost rank.
+   */
+  template <class AMatrix>
+  static int sstep_block(const AMatrix& A, KokkosSparse::Experimental::Preconditioner<AMatrix>* precond,
+                         const HandleDevice2dValueType& V, const int j, int t, SStepBasis& basis,
+                         const HandleDeviceValueType& Wj, const HandleDeviceValueType& Wj2,
+                         const HandleDevice2dValueType& Wtmp, const HandleHost2dValueType& Hraw_h) {
+    using ST      = typename karith::val_type;
+    using MT      = typename karith::mag_type;
+    const ST one  = karith::one();
+    const ST zero = karith::zero();
+
+    // Matrix powers kernel
+    for (int c = 0; c < t; c++) {
+      auto uc = Kokkos::subview(V, Kokkos::ALL, j + c);
+      auto un = Kokkos::subview(V, Kokkos::ALL, j + c + 1);
+      if (precond) {
+        precond->apply(uc, Wj2);                         // wj2 = M*uc
+        KokkosSparse::spmv("N", one, A, Wj2, zero, Wj);  // wj = A*M*uc
+      } else {
+        KokkosSparse::spmv("N", one, A, uc, zero, Wj);  // wj = A*uc
+      }
+      if (!basis.haveShifts) basis.sigma[c] = KokkosBlas::nrm2(Wj);
+      if (!(basis.sigma[c] > 0)) {
+        t = c;
+        break;
+      }
+      const ST scale = one / ST(basis.sigma[c]);
+      KokkosBlas::update(scale, Wj, -ST(basis.shiftRe[c]) * scale, uc, zero, un);  // un = (wj - shift*uc)/sigma
+      if (basis.shiftIm[c] < 0) {
+        auto up = Kokkos::subview(V, Kokkos::ALL, j + c - 1);
+        KokkosBlas::axpy(ST(basis.shiftIm[c] * basis.shiftIm[c] / basis.sigma[c - 1]) * scale, up, un);
+      }
+    }
+    if (t == 0) return 0;
+
+    // Block classical Gram-Schmidt, twice: W := W - Q*C with C = Q^H W
+    auto Q = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+    auto W = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j + 1, j + 1 + t));
+    HandleDevice2dValueType C(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C"), j + 1, t),
+        C2(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C2"), j + 1, t);
+    KokkosBlas::gemm("C", "N", one, Q, W, zero, C);
+    KokkosBlas::gemm("N", "N", -one, Q, C, one, W);
+    KokkosBlas::gemm("C", "N", one, Q, W, zero, C2);
+    KokkosBlas::gemm("N", "N", -one, Q, C2, one, W);
+    KokkosBlas::axpy(one, C2, C);
+    auto C_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+    // CholQR2: W := W R^{-1} with R = R2*R1, the Cholesky factors of W^H W
+    // for both passes. Columns past a vanishing pivot are dropped.
+    HandleHost2dValueType R_h("R", t, t);
+    for (int i = 0; i < t; i++) R_h(i, i) = one;
+    for (int pass = 0; pass < 2; pass++) {
+      auto Wt = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j + 1, j + 1 + t));
+      HandleDevice2dValueType G(Kokkos::view_alloc(Kokkos::WithoutInitializing, "G"), t, t);
+      KokkosBlas::gemm("C", "N", one, Wt, Wt, zero, G);
+      auto G_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G);
+      t        = cholesky_upper(G_h, t);
+      if (t == 0) return 0;
+
+      HandleDevice2dValueType Rinv(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Rinv"), t, t);
+      auto Rinv_h = Kokkos::create_mirror_view(Rinv);
+      invert_upper(G_h, Rinv_h, t);
+      Kokkos::deep_copy(Rinv, Rinv_h);
+      auto Wtt   = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j + 1, j + 1 + t));
+      auto Wtmpt = Kokkos::subview(Wtmp, Kokkos::ALL, Kokkos::make_pair(0, t));
+      KokkosBlas::gemm("N", "N", one, Wtt, Rinv, zero, Wtmpt);
+      Kokkos::deep_copy(Wtt, Wtmpt);
+
+      // R := R_pass * R, top down so that each entry is only needed before it is overwritten
+      for (int c = 0; c < t; c++) {
+        for (int i = 0; i <= c; i++) {
+          ST sum = zero;
+          for (int k = i; k <= c; k++) sum += G_h(i, k) * R_h(k, c);
+          R_h(i, c) = sum;
+        }
+      }
+    }
+
+    // Block vector u_c = V(:, 0:j+t) * Rf(:, c), and Op u_c = V(:, 0:j+t) * (Rf*B)(:, c)
+    // with the change of basis B of the Newton recurrence.
+    const int nb = j + t + 1;
+    HandleHost2dValueType Rf("Rf", nb, t + 1), M("M", nb, t);
+    Rf(j, 0) = one;
+    for (int c = 1; c <= t; c++) {
+      for (int i = 0; i <= j; i++) Rf(i, c) = C_h(i, c - 1);
+      for (int r = 0; r < c; r++) Rf(j + 1 + r, c) = R_h(r, c - 1);
+    }
+    for (int c = 0; c < t; c++) {
+      const ST shift  = basis.shiftRe[c];
+      const ST sigma  = basis.sigma[c];
+      const ST before = basis.shiftIm[c] < 0 ? ST(-basis.shiftIm[c] * basis.shiftIm[c] / basis.sigma[c - 1]) : zero;
+      for (int i = 0; i < nb; i++) {
+        M(i, c) = sigma * Rf(i, c + 1) + shift * Rf(i, c);
+        if (c > 0) M(i, c) += before * Rf(i, c - 1);
+        // Op V(:, 0:j-1) = V(:, 0:j) * H(0:j, 0:j-1) is already known
+        for (int d = (i > 0 ? i - 1 : 0); d < j; d++) M(i, c) -= Hraw_h(i, d) * Rf(d, c);
+      }
+    }
+    // Op V(:, j:j+t-1) * T = V(:, 0:j+t) * M with T = Rf(j:j+t-1, 0:t-1)
+    // upper triangular, so H(:, j:j+t-1) = M * T^{-1}
+    for (int c = 0; c < t; c++) {
+      for (int i = 0; i < int(Hraw_h.extent(0)); i++) {
+        ST h = zero;
+        if (i < nb && i <= j + c + 1) {
+          h = M(i, c);
+          for (int d = 0; d < c; d++) h -= Hraw_h(i, j + d) * Rf(j + d, c);
+          h /= Rf(j + c, c);
+        }
+        Hraw_h(i, j + c) = h;
+      }
+    }
+
+    // Rescale the next blocks so that their vectors have about unit norm
+    std::vector<MT> nrm(t + 1, MT(0));
+    for (int c = 0; c <= t; c++) {
+      for (int i = 0; i < nb; i++) nrm[c] += karith::abs(Rf(i, c)) * karith::abs(Rf(i, c));
+      nrm[c] = Kokkos::sqrt(nrm[c]);
+    }
+    for (int c = 0; c < t; c++) {
+      const MT ratio = nrm[c + 1] / nrm[c];
+      if (ratio > 0 && Kokkos::isfinite(ratio)) basis.sigma[c] *= ratio;
+    }
+    if (!basis.haveShifts) set_newton_shifts(Hraw_h, t, basis);
+    return t;
+  }
+
   /**
    * The main gmres numeric function. Copied with slight modifications from
    * example/gmres/gmres.hpp
@@ -75,6 +344,7 @@ struct GmresWrap {
     const auto tol        = thandle.get_tol();
     const auto ortho      = thandle.get_ortho();
     const auto verbose    = thandle.get_verbose();
+    const int s           = std::min<int>(thandle.get_s_step(), m);
 
     bool converged     = false;
     size_type cycle    = 0;  // How many times have we restarted?
@@ -88,7 +358,12 @@ struct GmresWrap {
       std::cout << "  m:          " << m << std::endl;
       std::cout << "  maxRestart: " << maxRestart << std::endl;
       std::cout << "  tol:        " << tol << std::endl;
-      std::cout << "  ortho:      " << ((ortho == GmresHandle::Ortho::CGS2) ? "CGS2" : "MGS") << std::endl;
+      if (s > 1) {
+        std::cout << "  ortho:      s-step (BCGS2 + CholQR2)" << std::endl;
+        std::cout << "  s:          " << s << std::endl;
+      } else {
+        std::cout << "  ortho:      " << ((ortho == GmresHandle::Ortho::CGS2) ? "CGS2" : "MGS") << std::endl;
+      }
       std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
     }
 
@@ -114,6 +389,12 @@ struct GmresWrap {
 
     auto H_h = Kokkos::create_mirror_view(H);  // Make H into a host view of H.
 
+    // s-step only: Hessenberg matrix before the Givens rotations, Newton basis
+    // parameters (kept across restarts) and a work block
+    HandleHost2dValueType Hraw_h("Hraw", s > 1 ? m + 1 : 0, s > 1 ? m : 0);
+    SStepBasis basis(s);
+    HandleDevice2dValueType Wtmp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Wtmp"), s > 1 ? n : 0, s);
+
     // Compute initial residuals:
     nrmB = KokkosBlas::nrm2(B);
     Kokkos::deep_copy(Res, B);
@@ -146,140 +427,161 @@ struct GmresWrap {
       Kokkos::deep_copy(Vj, Res);
       KokkosBlas::scal(Vj, one / trueRes, Vj);  // V0 = V0/norm(V0)
 
-      for (int j = 0; j < m; j++) {
-        if (precond) {                                     // Apply Right prec
-          precond->apply(Vj, Wj2);                         // wj2 = M*Vj
-          KokkosSparse::spmv("N", one, A, Wj2, zero, Wj);  // wj = A*MVj = A*Wj2
-        } else {
-          KokkosSparse::spmv("N", one, A, Vj, zero, Wj);  // wj = A*Vj
-        }
-        Kokkos::Profiling::pushRegion("GMRES::Orthog:");
-        if (ortho == GmresHandle::Ortho::MGS) {
-          for (int i = 0; i <= j; i++) {
-            auto Vi   = Kokkos::subview(V, Kokkos::ALL, i);
-            H_h(i, j) = KokkosBlas::dot(Vi, Wj);   // Vi^* Wj
-            KokkosBlas::axpy(-H_h(i, j), Vi, Wj);  // wj = wj-Hij*Vi
+      bool endArnoldi = false;
+      for (int j = 0; j < m && !endArnoldi;) {
+        int numCols = 1;  // Number of new columns of H
+        if (s > 1) {
+          // s-step: build and orthogonalize the next (up to) s basis vectors at once
+          Kokkos::Profiling::pushRegion("GMRES::SStep:");
+          numCols = sstep_block(A, precond, V, j, std::min(s, m - j), basis, Wj, Wj2, Wtmp, Hraw_h);
+          Kokkos::Profiling::popRegion();
+          if (numCols == 0) {
+            throw std::runtime_error(
+                "GMRES has experienced lucky breakdown, but the residual has not converged.\n\
+                                  Solver terminated without convergence.");
           }
-          auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
-        } else if (ortho == GmresHandle::Ortho::CGS2) {
-          auto V0j  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
-          auto Hj   = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
-          auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
-          KokkosBlas::gemv("C", one, V0j, Wj, zero, Hj);  // Hj = Vj^T * wj
-          KokkosBlas::gemv("N", -one, V0j, Hj, one, Wj);  // wj = wj - Vj * Hj
-
-          // Re-orthog CGS:
-          auto orthoTmpSub = Kokkos::subview(orthoTmp, Kokkos::make_pair(0, j + 1));
-          KokkosBlas::gemv("C", one, V0j, Wj, zero,
-                           orthoTmpSub);  // tmp (Hj) = Vj^T * wj
-          KokkosBlas::gemv("N", -one, V0j, orthoTmpSub, one,
-                           Wj);                    // wj = wj - Vj * tmp
-          KokkosBlas::axpy(one, orthoTmpSub, Hj);  // Hj = Hj + tmp
-          Kokkos::deep_copy(Hj_h, Hj);
+          for (int jj = j; jj < j + numCols; jj++)
+            for (int i = 0; i <= m; i++) H_h(i, jj) = Hraw_h(i, jj);
         } else {
-          throw std::invalid_argument("Invalid argument for 'ortho'.  Please use 'CGS2' or 'MGS'.");
-        }
+          if (precond) {                                     // Apply Right prec
+            precond->apply(Vj, Wj2);                         // wj2 = M*Vj
+            KokkosSparse::spmv("N", one, A, Wj2, zero, Wj);  // wj = A*MVj = A*Wj2
+          } else {
+            KokkosSparse::spmv("N", one, A, Vj, zero, Wj);  // wj = A*Vj
+          }
+          Kokkos::Profiling::pushRegion("GMRES::Orthog:");
+          if (ortho == GmresHandle::Ortho::MGS) {
+            for (int i = 0; i <= j; i++) {
+              auto Vi   = Kokkos::subview(V, Kokkos::ALL, i);
+              H_h(i, j) = KokkosBlas::dot(Vi, Wj);   // Vi^* Wj
+              KokkosBlas::axpy(-H_h(i, j), Vi, Wj);  // wj = wj-Hij*Vi
+            }
+            auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
+          } else if (ortho == GmresHandle::Ortho::CGS2) {
+            auto V0j  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+            auto Hj   = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+            auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
+            KokkosBlas::gemv("C", one, V0j, Wj, zero, Hj);  // Hj = Vj^T * wj
+            KokkosBlas::gemv("N", -one, V0j, Hj, one, Wj);  // wj = wj - Vj * Hj
+
+            // Re-orthog CGS:
+            auto orthoTmpSub = Kokkos::subview(orthoTmp, Kokkos::make_pair(0, j + 1));
+            KokkosBlas::gemv("C", one, V0j, Wj, zero,
+                             orthoTmpSub);  // tmp (Hj) = Vj^T * wj
+            KokkosBlas::gemv("N", -one, V0j, orthoTmpSub, one,
+                             Wj);                    // wj = wj - Vj * tmp
+            KokkosBlas::axpy(one, orthoTmpSub, Hj);  // Hj = Hj + tmp
+            Kokkos::deep_copy(Hj_h, Hj);
+          } else {
+            throw std::invalid_argument("Invalid argument for 'ortho'.  Please use 'CGS2' or 'MGS'.");
+          }
 
-        MT tmpNrm     = KokkosBlas::nrm2(Wj);
-        H_h(j + 1, j) = tmpNrm;
-        if (tmpNrm > 1e-14) {
-          Vj = Kokkos::subview(V, Kokkos::ALL, j + 1);
-          KokkosBlas::scal(Vj, one / H_h(j + 1, j), Wj);  // Vj = Wj/H(j+1,j)
-        }
-        Kokkos::Profiling::popRegion();
-
-        // Givens for real and complex (See Alg 3 in "On computing Givens
-        // rotations reliably and efficiently" by Demmel, et. al. 2001) Apply
-        // Givens rotation and compute shortcut residual:
-        for (int i = 0; i < j; i++) {
-          ST tempVal    = CosVal_h(i) * H_h(i, j) + SinVal_h(i) * H_h(i + 1, j);
-          H_h(i + 1, j) = -karith::conj(SinVal_h(i)) * H_h(i, j) + CosVal_h(i) * H_h(i + 1, j);
-          H_h(i, j)     = tempVal;
-        }
-        ST f          = H_h(j, j);
-        ST g          = H_h(j + 1, j);
-        MT f2         = karith::real(f) * karith::real(f) + karith::imag(f) * karith::imag(f);
-        MT g2         = karith::real(g) * karith::real(g) + karith::imag(g) * karith::imag(g);
-        ST fg2        = f2 + g2;
-        ST D1         = one / karith::sqrt(f2 * fg2);
-        CosVal_h(j)   = f2 * D1;
-        fg2           = fg2 * D1;
-        H_h(j, j)     = f * fg2;
-        SinVal_h(j)   = f * D1 * karith::conj(g);
-        H_h(j + 1, j) = zero;
-
-        GVec_h(j + 1) = GVec_h(j) * (-karith::conj(SinVal_h(j)));
-        GVec_h(j)     = GVec_h(j) * CosVal_h(j);
-        shortRelRes   = karith::abs(GVec_h(j + 1)) / nrmB;
-
-        if (verbose) {
-          std::cout << "Shortcut relative residual for iteration " << j + (cycle * m) << " is: " << shortRelRes
-                    << std::endl;
-        }
-        if (tmpNrm <= 1e-14 && shortRelRes >= tol) {
-          throw std::runtime_error(
-              "GMRES has experienced lucky breakdown, but the residual has not converged.\n\
-                                  Solver terminated without convergence.");
-        }
-        if (karith::isNan(ST(shortRelRes))) {
-          throw std::runtime_error("gmres: Relative residual is nan. Terminating solver.");
+          MT tmpNrm     = KokkosBlas::nrm2(Wj);
+          H_h(j + 1, j) = tmpNrm;
+          if (tmpNrm > 1e-14) {
+            Vj = Kokkos::subview(V, Kokkos::ALL, j + 1);
+            KokkosBlas::scal(Vj, one / H_h(j + 1, j), Wj);  // Vj = Wj/H(j+1,j)
+          }
+          Kokkos::Profiling::popRegion();
         }
 
-        // If short residual converged, or time to restart, check true residual
-        if (shortRelRes < tol || j == m - 1) {
-          // Compute least squares soln with Givens rotation:
-          auto GLsSolnSub_h = Kokkos::subview(GLsSoln_h, Kokkos::ALL,
-                                              0);  // Original view has rank 2, need a rank 1 here.
-          auto GVecSub_h    = Kokkos::subview(GVec_h, Kokkos::make_pair(0, m));
-          Kokkos::deep_copy(GLsSolnSub_h,
-                            GVecSub_h);  // Copy LS rhs vec for triangle solve.
-          auto GLsSolnSub2_h = Kokkos::subview(GLsSoln_h, Kokkos::make_pair(0, j + 1), Kokkos::ALL);
-          auto H_Sub_h       = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), Kokkos::make_pair(0, j + 1));
-          {
-            // Hack to get around uninstantiated trsm for layoutleft
-            KokkosBlas::Impl::SerialTrsm_Invoke("L", "U", "N", "N", one, H_Sub_h, GLsSolnSub2_h);
-          }
-          Kokkos::deep_copy(GLsSoln, GLsSoln_h);
-
-          // Update solution and compute residual with Givens:
-          VSub = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
-          Kokkos::deep_copy(Xiter,
-                            X);  // Can't overwrite X with intermediate solution.
-          auto GLsSolnSub3 = Kokkos::subview(GLsSoln, Kokkos::make_pair(0, j + 1), 0);
-          if (precond) {  // Apply right prec to correct soln.
-            KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, zero,
-                             Wj);                      // wj = V(1:j+1)*lsSoln
-            precond->apply(Wj, Xiter, "N", one, one);  // Xiter = M*wj + X
-          } else {
-            KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, one,
-                             Xiter);  // x_iter = x + V(1:j+1)*lsSoln
+        for (int jj = j; jj < j + numCols && !endArnoldi; jj++) {
+          MT tmpNrm = karith::abs(H_h(jj + 1, jj));
+
+          // Givens for real and complex (See Alg 3 in "On computing Givens
+          // rotations reliably and efficiently" by Demmel, et. al. 2001) Apply
+          // Givens rotation and compute shortcut residual:
+          for (int i = 0; i < jj; i++) {
+            ST tempVal     = CosVal_h(i) * H_h(i, jj) + SinVal_h(i) * H_h(i + 1, jj);
+            H_h(i + 1, jj) = -karith::conj(SinVal_h(i)) * H_h(i, jj) + CosVal_h(i) * H_h(i + 1, jj);
+            H_h(i, jj)     = tempVal;
           }
-          KokkosSparse::spmv("N", one, A, Xiter, zero, Wj);  // wj = Ax
-          Kokkos::deep_copy(Res, B);                         // Reset r=b.
-          KokkosBlas::axpy(-one, Wj, Res);                   // r = b-Ax.
-          trueRes = KokkosBlas::nrm2(Res);
-          relRes  = trueRes / nrmB;
+          ST f            = H_h(jj, jj);
+          ST g            = H_h(jj + 1, jj);
+          MT f2           = karith::real(f) * karith::real(f) + karith::imag(f) * karith::imag(f);
+          MT g2           = karith::real(g) * karith::real(g) + karith::imag(g) * karith::imag(g);
+          ST fg2          = f2 + g2;
+          ST D1           = one / karith::sqrt(f2 * fg2);
+          CosVal_h(jj)    = f2 * D1;
+          fg2             = fg2 * D1;
+          H_h(jj, jj)     = f * fg2;
+          SinVal_h(jj)    = f * D1 * karith::conj(g);
+          H_h(jj + 1, jj) = zero;
+
+          GVec_h(jj + 1) = GVec_h(jj) * (-karith::conj(SinVal_h(jj)));
+          GVec_h(jj)     = GVec_h(jj) * CosVal_h(jj);
+          shortRelRes    = karith::abs(GVec_h(jj + 1)) / nrmB;
+
           if (verbose) {
-            std::cout << "True relative residual for iteration " << j + (cycle * m) << " is : " << relRes << std::endl;
+            std::cout << "Shortcut relative residual for iteration " << jj + (cycle * m) << " is: " << shortRelRes
+                      << std::endl;
+          }
+          if (tmpNrm <= 1e-14 && shortRelRes >= tol) {
+            throw std::runtime_error(
+                "GMRES has experienced lucky breakdown, but the residual has not converged.\n\
+                                  Solver terminated without convergence.");
+          }
+          if (karith::isNan(ST(shortRelRes))) {
+            throw std::runtime_error("gmres: Relative residual is nan. Terminating solver.");
           }
-          numIters = j + 1;
 
-          if (relRes < tol) {
-            converged = true;
-            Kokkos::deep_copy(X, Xiter);  // Final solution is the iteration solution.
-            break;                        // End Arnoldi iteration.
-          } else if (shortRelRes < 1e-30) {
+          // If short residual converged, or time to restart, check true residual
+          if (shortRelRes < tol || jj == m - 1) {
+            // Compute least squares soln with Givens rotation:
+            auto GLsSolnSub_h = Kokkos::subview(GLsSoln_h, Kokkos::ALL,
+                                                0);  // Original view has rank 2, need a rank 1 here.
+            auto GVecSub_h    = Kokkos::subview(GVec_h, Kokkos::make_pair(0, m));
+            Kokkos::deep_copy(GLsSolnSub_h,
+                              GVecSub_h);  // Copy LS rhs vec for triangle solve.
+            auto GLsSolnSub2_h = Kokkos::subview(GLsSoln_h, Kokkos::make_pair(0, jj + 1), Kokkos::ALL);
+            auto H_Sub_h       = Kokkos::subview(H_h, Kokkos::make_pair(0, jj + 1), Kokkos::make_pair(0, jj + 1));
+            {
+              // Hack to get around uninstantiated trsm for layoutleft
+              KokkosBlas::Impl::SerialTrsm_Invoke("L", "U", "N", "N", one, H_Sub_h, GLsSolnSub2_h);
+            }
+            Kokkos::deep_copy(GLsSoln, GLsSoln_h);
+
+            // Update solution and compute residual with Givens:
+            VSub = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, jj + 1));
+            Kokkos::deep_copy(Xiter,
+                              X);  // Can't overwrite X with intermediate solution.
+            auto GLsSolnSub3 = Kokkos::subview(GLsSoln, Kokkos::make_pair(0, jj + 1), 0);
+            if (precond) {  // Apply right prec to correct soln.
+              KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, zero,
+                               Wj);                      // wj = V(1:jj+1)*lsSoln
+              precond->apply(Wj, Xiter, "N", one, one);  // Xiter = M*wj + X
+            } else {
+              KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, one,
+                               Xiter);  // x_iter = x + V(1:jj+1)*lsSoln
+            }
+            KokkosSparse::spmv("N", one, A, Xiter, zero, Wj);  // wj = Ax
+            Kokkos::deep_copy(Res, B);                         // Reset r=b.
+            KokkosBlas::axpy(-one, Wj, Res);                   // r = b-Ax.
+            trueRes = KokkosBlas::nrm2(Res);
+            relRes  = trueRes / nrmB;
             if (verbose) {
-              std::cout << "Short residual has converged to machine zero, but true "
-                           "residual is not converged.\n"
-                        << "You may have given GMRES a singular matrix. Ending the "
-                           "GMRES iteration."
+              std::cout << "True relative residual for iteration " << jj + (cycle * m) << " is : " << relRes
                         << std::endl;
             }
-            break;  // End Arnoldi iteration; we can't make any more progress.
+            numIters = jj + 1;
+
+            if (relRes < tol) {
+              converged = true;
+              Kokkos::deep_copy(X, Xiter);  // Final solution is the iteration solution.
+              endArnoldi = true;            // End Arnoldi iteration.
+            } else if (shortRelRes < 1e-30) {
+              if (verbose) {
+                std::cout << "Short residual has converged to machine zero, but true "
+                             "residual is not converged.\n"
+                          << "You may have given GMRES a singular matrix. Ending the "
+                             "GMRES iteration."
+                          << std::endl;
+              }
+              endArnoldi = true;  // End Arnoldi iteration; we can't make any more progress.
+            }
           }
         }
-
+        j += numCols;
       }  // end Arnoldi iter.
 
       cycle++;
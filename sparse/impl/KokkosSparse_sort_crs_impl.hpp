@@ -19,6 +19,7 @@
 #include "Kokkos_Core.hpp"
 #include "Kokkos_Sort.hpp"
 #include "KokkosKernels_Sorting.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
 
 // Workaround for issue with Kokkos::Experimental::sort_by_key, with nvcc and OpenMP enabled
 // (Kokkos issue #7036, fixed in 4.4 release)
@@ -358,6 +359,146 @@ bool useBulkSortHeuristic(Ordinal avgDeg, Ordinal maxDeg) {
 }
 #endif
 
+// Parallel LSD radix sort of bulk CRS keys, one byte per pass. The keys are
+// split into numBlocks contiguous blocks. Each block counts its digits, the
+// counts are scanned digit-major, and each block then scatters its keys in
+// order after the keys with the same digit in all previous blocks, so each
+// pass is stable.
+template <typename Offset, typename Keys, typename Counts>
+struct BulkRadixCountFunctor {
+  BulkRadixCountFunctor(const Keys& keys_, const Counts& counts_, int numBlocks_, int shift_)
+      : keys(keys_), counts(counts_), numBlocks(numBlocks_), shift(shift_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(int b) const {
+    const Offset n     = keys.extent(0);
+    const Offset begin = n / numBlocks * b + Kokkos::min<Offset>(b, n % numBlocks);
+    const Offset end   = begin + n / numBlocks + (Offset(b) < n % numBlocks);
+    Offset local[256];
+    for (int d = 0; d < 256; d++) local[d] = 0;
+    for (Offset i = begin; i < end; i++) local[(keys(i) >> shift) & 0xFF]++;
+    for (int d = 0; d < 256; d++) counts(d * numBlocks + b) = local[d];
+  }
+
+  Keys keys;
+  Counts counts;
+  int numBlocks;
+  int shift;
+};
+
+template <typename Offset, typename Keys, typename Perm, typename Counts>
+struct BulkRadixScatterFunctor {
+  BulkRadixScatterFunctor(const Keys& keys_, const Keys& keysOut_, const Perm& perm_, const Perm& permOut_,
+                          const Counts& counts_, int numBlocks_, int shift_)
+      : keys(keys_),
+        keysOut(keysOut_),
+        perm(perm_),
+        permOut(permOut_),
+        counts(counts_),
+        numBlocks(numBlocks_),
+        shift(shift_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(int b) const {
+    const Offset n     = keys.extent(0);
+    const Offset begin = n / numBlocks * b + Kokkos::min<Offset>(b, n % numBlocks);
+    const Offset end   = begin + n / numBlocks + (Offset(b) < n % numBlocks);
+    Offset pos[256];
+    for (int d = 0; d < 256; d++) pos[d] = counts(d * numBlocks + b);
+    for (Offset i = begin; i < end; i++) {
+      const Offset p = pos[(keys(i) >> shift) & 0xFF]++;
+      keysOut(p)     = keys(i);
+      if (perm.extent(0)) permOut(p) = perm(i);
+    }
+  }
+
+  Keys keys;
+  Keys keysOut;
+  Perm perm;
+  Perm permOut;
+  Counts counts;
+  int numBlocks;
+  int shift;
+};
+
+// Sorts keys, whose values are below 2^numBits, and permutes perm alongside
+// unless it is empty. keys and perm are replaced by the sorted views.
+template <typename ExecSpace, typename Offset>
+void bulkRadixSort(const ExecSpace& exec, Kokkos::View<uint64_t*, ExecSpace>& keys,
+                   Kokkos::View<Offset*, ExecSpace>& perm, int numBits) {
+  using Keys     = Kokkos::View<uint64_t*, ExecSpace>;
+  using Perm     = Kokkos::View<Offset*, ExecSpace>;
+  using Counts   = Kokkos::View<Offset*, ExecSpace>;
+  const Offset n = keys.extent(0);
+  // blocks of at least 4096 keys, so that the counts stay small
+  const int numBlocks = Kokkos::max<int>(1, Kokkos::min<Offset>(exec.concurrency(), n / 4096));
+  Keys keysAux(Kokkos::view_alloc(Kokkos::WithoutInitializing, "keys aux"), n);
+  Perm permAux(Kokkos::view_alloc(Kokkos::WithoutInitializing, "permutation aux"), perm.extent(0));
+  Counts counts(Kokkos::view_alloc(Kokkos::WithoutInitializing, "radix counts"), 256 * numBlocks);
+  for (int shift = 0; shift < numBits; shift += 8) {
+    Kokkos::parallel_for("CRS bulk sorting: radix count", Kokkos::RangePolicy<ExecSpace>(exec, 0, numBlocks),
+                         BulkRadixCountFunctor<Offset, Keys, Counts>(keys, counts, numBlocks, shift));
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, 256 * numBlocks, counts);
+    Kokkos::parallel_for(
+        "CRS bulk sorting: radix scatter", Kokkos::RangePolicy<ExecSpace>(exec, 0, numBlocks),
+        BulkRadixScatterFunctor<Offset, Keys, Perm, Counts>(keys, keysAux, perm, permAux, counts, numBlocks, shift));
+    std::swap(keys, keysAux);
+    std::swap(perm, permAux);
+  }
+}
+
+// Number of bits of the bulk CRS keys (row * ncols + col), or -1 if they do
+// not fit in 64 bits
+template <typename Ordinal>
+int bulkCrsKeyBits(Ordinal numRows, Ordinal numCols) {
+  const uint64_t maxBulkKey = (uint64_t)numRows * (uint64_t)numCols;
+  if (numRows && maxBulkKey / numRows != (uint64_t)numCols) return -1;
+  int bits = 0;
+  while (bits < 64 && (maxBulkKey - 1) >> bits) bits++;
+  return bits;
+}
+
+// Permutation that sorts the entries of each row, computed by one radix sort
+// over all the entries
+template <typename ExecSpace, typename Rowmap, typename Entries>
+Kokkos::View<typename Rowmap::non_const_value_type*, ExecSpace> computeEntryPermutationRadix(
+    const ExecSpace& exec, const Rowmap& rowmap, const Entries& entries, typename Entries::non_const_value_type ncols) {
+  using Offset          = typename Rowmap::non_const_value_type;
+  using Ordinal         = typename Entries::non_const_value_type;
+  const Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+  auto keys             = generateBulkCrsKeys(exec, rowmap, entries, ncols);
+  Kokkos::View<Offset*, ExecSpace> permutation(Kokkos::view_alloc(Kokkos::WithoutInitializing, "permutation"),
+                                               entries.extent(0));
+  // This initializes permutation as the identity
+  KokkosKernels::Impl::sequential_fill(exec, permutation);
+  bulkRadixSort(exec, keys, permutation, bulkCrsKeyBits(numRows, ncols));
+  return permutation;
+}
+
+// Sorts the entries of each row of a graph by one radix sort over all the
+// entries, and recovers the columns from the sorted keys
+template <typename ExecSpace, typename Rowmap, typename Entries>
+void bulkRadixSortGraph(const ExecSpace& exec, const Rowmap& rowmap, const Entries& entries,
+                        typename Entries::non_const_value_type ncols) {
+  using Offset          = typename Rowmap::non_const_value_type;
+  using Ordinal         = typename Entries::non_const_value_type;
+  const Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+  auto keys             = generateBulkCrsKeys(exec, rowmap, entries, ncols);
+  Kokkos::View<Offset*, ExecSpace> noPermutation;
+  bulkRadixSort(exec, keys, noPermutation, bulkCrsKeyBits(numRows, ncols));
+  Kokkos::parallel_for(
+      "CRS bulk sorting: columns from keys", Kokkos::RangePolicy<ExecSpace>(exec, 0, entries.extent(0)),
+      KOKKOS_LAMBDA(size_t i) { entries(i) = Ordinal(keys(i) % uint64_t(ncols)); });
+}
+
+// Heuristic for sorting all the entries at once with bulkRadixSort on CPUs,
+// instead of one row per thread: when the longest row alone is more work than
+// an even share of the entries per thread, the per-row sort is serialized by
+// the few long rows.
+template <typename ExecSpace, typename Ordinal>
+bool useRadixBulkSortHeuristic(const ExecSpace& exec, size_t nnz, Ordinal maxDeg) {
+  const uint64_t concurrency = exec.concurrency();
+  return concurrency > 1 && maxDeg > 1024 && (uint64_t)maxDeg * concurrency > (uint64_t)nnz;
+}
+
 template <typename ExecSpace, typename Permutation, typename InView, typename OutView>
 void applyPermutation(const ExecSpace& exec, const Permutation& permutation, const InView& in, const OutView& out) {
   Kokkos::parallel_for(
@@ -33,7 +33,8 @@ struct SortedNumericSumFunctor {
   SortedNumericSumFunctor(const ArowptrsT& Arowptrs_, const BrowptrsT& Browptrs_, const CrowptrsT& Crowptrs_,
                           const AcolindsT& Acolinds_, const BcolindsT& Bcolinds_, const CcolindsT& Ccolinds_,
                           const AvaluesT& Avalues_, const BvaluesT& Bvalues_, const CvaluesT& Cvalues_,
-                          const AscalarT alpha_, const BscalarT beta_)
+                          const AscalarT alpha_, const BscalarT beta_, const CcolindsT& Apos_,
+                          const CcolindsT& Bpos_)
       : Arowptrs(Arowptrs_),
         Browptrs(Browptrs_),
         Crowptrs(Crowptrs_),
@@ -44,7 +45,9 @@ struct SortedNumericSumFunctor {
         Bvalues(Bvalues_),
         Cvalues(Cvalues_),
         alpha(alpha_),
-        beta(beta_) {}
+        beta(beta_),
+        Apos(Apos_),
+        Bpos(Bpos_) {}
 
   KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
     const ordinal_type ORDINAL_MAX = Kokkos::ArithTraits<ordinal_type>::max();
@@ -58,7 +61,8 @@ struct SortedNumericSumFunctor {
     size_type Browlen   = Browptrs(i + 1) - Browstart;
     ordinal_type Acol   = (Arowlen == 0) ? ORDINAL_MAX : Acolinds(Arowstart);
     ordinal_type Bcol   = (Browlen == 0) ? ORDINAL_MAX : Bcolinds(Browstart);
-    size_type Coffset   = Crowptrs(i);
+    size_type Crowstart = Crowptrs(i);
+    size_type Coffset   = Crowstart;
     while (Acol != ORDINAL_MAX || Bcol != ORDINAL_MAX) {
       ordinal_type Ccol = (Acol < Bcol) ? Acol : Bcol;
       // Eat all entries in both A and B which have this column
@@ -67,6 +71,7 @@ struct SortedNumericSumFunctor {
       CscalarT accum = Kokkos::ArithTraits<CscalarT>::zero();
       while (Acol == Ccol) {
         accum += static_cast<CscalarT>(alpha * Avalues(Arowstart + ai));
+        Apos(Arowstart + ai) = Coffset - Crowstart;
         ai++;
         if (ai == Arowlen)
           Acol = ORDINAL_MAX;
@@ -75,6 +80,7 @@ struct SortedNumericSumFunctor {
       }
       while (Bcol == Ccol) {
         accum += static_cast<CscalarT>(beta * Bvalues(Browstart + bi));
+        Bpos(Browstart + bi) = Coffset - Crowstart;
         bi++;
         if (bi == Browlen)
           Bcol = ORDINAL_MAX;
@@ -98,6 +104,10 @@ struct SortedNumericSumFunctor {
   CvaluesT Cvalues;
   const AscalarT alpha;
   const BscalarT beta;
+  // positions of the A and B entries within their C row, recorded for the
+  // next calls
+  CcolindsT Apos;
+  CcolindsT Bpos;
 };
 
 template <typename size_type, typename ordinal_type, typename ArowptrsT, typename BrowptrsT, typename CrowptrsT,
@@ -158,6 +168,47 @@ struct UnsortedNumericSumFunctor {
   const CcolindsT Bpos;
 };
 
+// Numeric when C already has its column indices from a previous call with the
+// same A and B patterns: a pure scatter of the values through Apos and Bpos,
+// with no merging of the rows.
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename BrowptrsT, typename CrowptrsT,
+          typename CposT, typename AvaluesT, typename BvaluesT, typename CvaluesT, typename AscalarT, typename BscalarT>
+struct ValuesOnlyNumericSumFunctor {
+  using CscalarT = typename CvaluesT::non_const_value_type;
+
+  ValuesOnlyNumericSumFunctor(const ArowptrsT Arowptrs_, const BrowptrsT Browptrs_, const CrowptrsT Crowptrs_,
+                              const AvaluesT Avalues_, const BvaluesT Bvalues_, CvaluesT Cvalues_,
+                              const AscalarT alpha_, const BscalarT beta_, const CposT Apos_, const CposT Bpos_)
+      : Arowptrs(Arowptrs_),
+        Browptrs(Browptrs_),
+        Crowptrs(Crowptrs_),
+        Avalues(Avalues_),
+        Bvalues(Bvalues_),
+        Cvalues(Cvalues_),
+        alpha(alpha_),
+        beta(beta_),
+        Apos(Apos_),
+        Bpos(Bpos_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type CrowStart = Crowptrs(i);
+    size_type CrowEnd   = Crowptrs(i + 1);
+    for (size_type j = CrowStart; j < CrowEnd; j++) Cvalues(j) = Kokkos::ArithTraits<CscalarT>::zero();
+    for (size_type j = Arowptrs(i); j < Arowptrs(i + 1); j++) Cvalues(CrowStart + Apos(j)) += alpha * Avalues(j);
+    for (size_type j = Browptrs(i); j < Browptrs(i + 1); j++) Cvalues(CrowStart + Bpos(j)) += beta * Bvalues(j);
+  }
+  const ArowptrsT Arowptrs;
+  const BrowptrsT Browptrs;
+  const CrowptrsT Crowptrs;
+  const AvaluesT Avalues;
+  const BvaluesT Bvalues;
+  CvaluesT Cvalues;
+  const AscalarT alpha;
+  const BscalarT beta;
+  const CposT Apos;
+  const CposT Bpos;
+};
+
 // Two types are the same (ignoring const)
 template <typename T, typename U>
 constexpr bool spadd_numeric_same_type =
@@ -219,13 +270,31 @@ void spadd_numeric_impl(const execution_space& exec, KernelHandle* kernel_handle
     return;
   }
   ordinal_type nrows = a_rowmap.extent(0) - 1;
-  if (addHandle->is_input_sorted()) {
+  auto a_pos         = addHandle->get_a_pos();
+  auto b_pos         = addHandle->get_b_pos();
+  if (addHandle->is_c_pattern_reused() && addHandle->is_numeric_called() && a_pos.extent(0) == a_entries.extent(0) &&
+      b_pos.extent(0) == b_entries.extent(0)) {
+    // the caller kept C and its column indices from the first numeric call
+    // after symbolic, only the values need to be refreshed
+    ValuesOnlyNumericSumFunctor<size_type, ordinal_type, alno_row_view_t, blno_row_view_t, clno_row_view_t,
+                                decltype(a_pos), ascalar_nnz_view_t, bscalar_nnz_view_t, cscalar_nnz_view_t, ascalar_t,
+                                bscalar_t>
+        valuesNumeric(a_rowmap, b_rowmap, c_rowmap, a_values, b_values, c_values, alpha, beta, a_pos, b_pos);
+    Kokkos::parallel_for("KokkosSparse::SpAdd:Numeric::ValuesOnly", range_type(exec, 0, nrows), valuesNumeric);
+  } else if (addHandle->is_input_sorted()) {
+    // merge the rows, and record where each entry of A and B went for the
+    // next calls
+    a_pos = decltype(a_pos)(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "A entry positions"),
+                            a_entries.extent(0));
+    b_pos = decltype(b_pos)(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "B entry positions"),
+                            b_entries.extent(0));
     SortedNumericSumFunctor<size_type, ordinal_type, alno_row_view_t, blno_row_view_t, clno_row_view_t, alno_nnz_view_t,
                             blno_nnz_view_t, clno_nnz_view_t, ascalar_nnz_view_t, bscalar_nnz_view_t,
                             cscalar_nnz_view_t, ascalar_t, bscalar_t>
         sortedNumeric(a_rowmap, b_rowmap, c_rowmap, a_entries, b_entries, c_entries, a_values, b_values, c_values,
-                      alpha, beta);
+                      alpha, beta, a_pos, b_pos);
     Kokkos::parallel_for("KokkosSparse::SpAdd:Numeric::InputSorted", range_type(exec, 0, nrows), sortedNumeric);
+    addHandle->set_a_b_pos(a_pos, b_pos);
   } else {
     // use a_pos and b_pos (set in the handle by symbolic) to quickly compute C
     // entries and values
@@ -233,7 +302,7 @@ void spadd_numeric_impl(const execution_space& exec, KernelHandle* kernel_handle
                               alno_nnz_view_t, blno_nnz_view_t, clno_nnz_view_t, ascalar_nnz_view_t, bscalar_nnz_view_t,
                               cscalar_nnz_view_t, ascalar_t, bscalar_t>
         unsortedNumeric(a_rowmap, b_rowmap, c_rowmap, a_entries, b_entries, c_entries, a_values, b_values, c_values,
-                        alpha, beta, addHandle->get_a_pos(), addHandle->get_b_pos());
+                        alpha, beta, a_pos, b_pos);
     Kokkos::parallel_for("KokkosSparse::SpAdd:Numeric::InputNotSorted", range_type(exec, 0, nrows), unsortedNumeric);
   }
   addHandle->set_call_numeric();
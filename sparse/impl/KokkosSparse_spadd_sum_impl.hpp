@@ -0,0 +1,280 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOS_SPADD_SUM_IMPL_HPP
+#define _KOKKOS_SPADD_SUM_IMPL_HPP
+
+#include <sstream>
+#include <vector>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+// Sum of several matrices, C = sum_i alpha_i * A_i. Symbolic concatenates the
+// rows of all the A_i, sorts and merges them into the pattern of C, and finds
+// the position of every entry of every A_i in its row of C. Numeric is then a
+// scatter of each A_i into C through these positions.
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Adds the row lengths of A to Crowcounts
+template <typename ordinal_type, typename ArowptrsT, typename CrowcountsT>
+struct SpaddSumCountFunctor {
+  SpaddSumCountFunctor(const ArowptrsT& Arowptrs_, const CrowcountsT& Crowcounts_)
+      : Arowptrs(Arowptrs_), Crowcounts(Crowcounts_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    Crowcounts(i) += Arowptrs(i + 1) - Arowptrs(i);
+  }
+
+  const ArowptrsT Arowptrs;
+  CrowcountsT Crowcounts;
+};
+
+// Appends the rows of A to the unmerged rows of C. Cfill counts the entries
+// already appended to each row.
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename CrowptrsT,
+          typename CcolindsT, typename CfillT>
+struct SpaddSumAppendFunctor {
+  SpaddSumAppendFunctor(const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_, const CrowptrsT& Crowptrs_,
+                        const CcolindsT& Ccolinds_, const CfillT& Cfill_)
+      : Arowptrs(Arowptrs_), Acolinds(Acolinds_), Crowptrs(Crowptrs_), Ccolinds(Ccolinds_), Cfill(Cfill_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type Coffset = Crowptrs(i) + Cfill(i);
+    for (size_type j = Arowptrs(i); j < Arowptrs(i + 1); j++) Ccolinds(Coffset++) = Acolinds(j);
+    Cfill(i) = Coffset - Crowptrs(i);
+  }
+
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const CrowptrsT Crowptrs;
+  CcolindsT Ccolinds;
+  CfillT Cfill;
+};
+
+// Counts (into Crowptrs) or copies (into Ccolinds) the unique entries of the
+// sorted, unmerged rows of C
+template <typename size_type, typename ordinal_type, typename UrowptrsT, typename UcolindsT, typename CrowptrsT,
+          typename CcolindsT>
+struct SpaddSumMergeFunctor {
+  SpaddSumMergeFunctor(const UrowptrsT& Urowptrs_, const UcolindsT& Ucolinds_, const CrowptrsT& Crowptrs_,
+                       const CcolindsT& Ccolinds_, const bool count_)
+      : Urowptrs(Urowptrs_), Ucolinds(Ucolinds_), Crowptrs(Crowptrs_), Ccolinds(Ccolinds_), count(count_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type Coffset = count ? 0 : Crowptrs(i);
+    for (size_type j = Urowptrs(i); j < Urowptrs(i + 1); j++) {
+      if (j > Urowptrs(i) && Ucolinds(j) == Ucolinds(j - 1)) continue;
+      if (!count) Ccolinds(Coffset) = Ucolinds(j);
+      Coffset++;
+    }
+    if (count) Crowptrs(i) = Coffset;
+  }
+
+  const UrowptrsT Urowptrs;
+  const UcolindsT Ucolinds;
+  CrowptrsT Crowptrs;
+  CcolindsT Ccolinds;
+  const bool count;
+};
+
+// Finds the position of each entry of A within its (sorted, merged) row of C
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename CrowptrsT,
+          typename CcolindsT, typename AposT>
+struct SpaddSumPositionsFunctor {
+  SpaddSumPositionsFunctor(const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_, const CrowptrsT& Crowptrs_,
+                           const CcolindsT& Ccolinds_, const AposT& Apos_)
+      : Arowptrs(Arowptrs_), Acolinds(Acolinds_), Crowptrs(Crowptrs_), Ccolinds(Ccolinds_), Apos(Apos_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const size_type CrowStart = Crowptrs(i);
+    const size_type CrowEnd   = Crowptrs(i + 1);
+    for (size_type j = Arowptrs(i); j < Arowptrs(i + 1); j++) {
+      const ordinal_type col = Acolinds(j);
+      size_type lo           = CrowStart, hi = CrowEnd;
+      while (lo < hi) {
+        size_type mid = lo + (hi - lo) / 2;
+        if (Ccolinds(mid) < col)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      Apos(j) = lo - CrowStart;
+    }
+  }
+
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const CrowptrsT Crowptrs;
+  const CcolindsT Ccolinds;
+  AposT Apos;
+};
+
+// C += alpha * A through the positions of A in C. The first matrix of the sum
+// overwrites C instead.
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AvaluesT, typename AposT,
+          typename CrowptrsT, typename CvaluesT, typename AscalarT>
+struct SpaddSumScatterFunctor {
+  using CscalarT = typename CvaluesT::non_const_value_type;
+
+  SpaddSumScatterFunctor(const ArowptrsT& Arowptrs_, const AvaluesT& Avalues_, const AposT& Apos_,
+                         const CrowptrsT& Crowptrs_, const CvaluesT& Cvalues_, const AscalarT alpha_, const bool first_)
+      : Arowptrs(Arowptrs_),
+        Avalues(Avalues_),
+        Apos(Apos_),
+        Crowptrs(Crowptrs_),
+        Cvalues(Cvalues_),
+        alpha(alpha_),
+        first(first_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const size_type CrowStart = Crowptrs(i);
+    if (first) {
+      for (size_type j = CrowStart; j < Crowptrs(i + 1); j++) Cvalues(j) = Kokkos::ArithTraits<CscalarT>::zero();
+    }
+    for (size_type j = Arowptrs(i); j < Arowptrs(i + 1); j++) Cvalues(CrowStart + Apos(j)) += alpha * Avalues(j);
+  }
+
+  const ArowptrsT Arowptrs;
+  const AvaluesT Avalues;
+  const AposT Apos;
+  const CrowptrsT Crowptrs;
+  CvaluesT Cvalues;
+  const CscalarT alpha;
+  const bool first;
+};
+
+template <typename AMatrix>
+void spadd_sum_check(const char name[], const std::vector<AMatrix>& A) {
+  if (A.empty()) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": needs at least one matrix";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  for (const AMatrix& Ai : A) {
+    if (Ai.numRows() != A[0].numRows() || Ai.numCols() != A[0].numCols()) {
+      std::ostringstream os;
+      os << "KokkosSparse::" << name << ": matrix dimensions do not match: " << A[0].numRows() << " x "
+         << A[0].numCols() << " and " << Ai.numRows() << " x " << Ai.numCols();
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+  }
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename CMatrix>
+void spadd_sum_symbolic_impl(const ExecSpace& exec, KernelHandle* handle, const std::vector<AMatrix>& A, CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  using pos_type     = typename KernelHandle::SPADDHandleType::nnz_lno_view_t;
+  using range_type   = Kokkos::RangePolicy<ExecSpace, ordinal_type>;
+
+  spadd_sum_check("spadd_symbolic", A);
+  const ordinal_type nrows = A[0].numRows();
+  auto addHandle           = handle->get_spadd_handle();
+
+  // all the rows of the A_i, concatenated and sorted
+  row_map_type u_rowmap("C unmerged rowmap", nrows + 1);
+  for (const AMatrix& Ai : A) {
+    Kokkos::parallel_for("KokkosSparse::SpAdd:Sum::Symbolic::Count", range_type(exec, 0, nrows),
+                         SpaddSumCountFunctor<ordinal_type, typename AMatrix::row_map_type, row_map_type>(
+                             Ai.graph.row_map, u_rowmap));
+  }
+  size_type u_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, nrows + 1, u_rowmap, u_nnz);
+  entries_type u_entries(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "C unmerged entries"), u_nnz);
+  {
+    row_map_type u_fill("C unmerged fill", nrows);
+    for (const AMatrix& Ai : A) {
+      Kokkos::parallel_for(
+          "KokkosSparse::SpAdd:Sum::Symbolic::Append", range_type(exec, 0, nrows),
+          SpaddSumAppendFunctor<size_type, ordinal_type, typename AMatrix::row_map_type, typename AMatrix::index_type,
+                                row_map_type, entries_type, row_map_type>(Ai.graph.row_map, Ai.graph.entries, u_rowmap,
+                                                                          u_entries, u_fill));
+    }
+  }
+  KokkosSparse::sort_crs_graph(exec, u_rowmap, u_entries, A[0].numCols());
+
+  // merge the sorted rows into C
+  using merge_functor = SpaddSumMergeFunctor<size_type, ordinal_type, row_map_type, entries_type, row_map_type,
+                                             entries_type>;
+  row_map_type c_rowmap(Kokkos::view_alloc(exec, "row map"), nrows + 1);
+  entries_type c_entries;
+  Kokkos::parallel_for("KokkosSparse::SpAdd:Sum::Symbolic::CountMerged", range_type(exec, 0, nrows),
+                       merge_functor(u_rowmap, u_entries, c_rowmap, c_entries, true));
+  size_type c_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, nrows + 1, c_rowmap, c_nnz);
+  c_entries = entries_type(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "entries"), c_nnz);
+  Kokkos::parallel_for("KokkosSparse::SpAdd:Sum::Symbolic::Merge", range_type(exec, 0, nrows),
+                       merge_functor(u_rowmap, u_entries, c_rowmap, c_entries, false));
+
+  std::vector<pos_type> sum_pos;
+  for (const AMatrix& Ai : A) {
+    pos_type pos(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "A entry positions"), Ai.nnz());
+    Kokkos::parallel_for("KokkosSparse::SpAdd:Sum::Symbolic::Positions", range_type(exec, 0, nrows),
+                         SpaddSumPositionsFunctor<size_type, ordinal_type, typename AMatrix::row_map_type,
+                                                  typename AMatrix::index_type, row_map_type, entries_type, pos_type>(
+                             Ai.graph.row_map, Ai.graph.entries, c_rowmap, c_entries, pos));
+    sum_pos.push_back(pos);
+  }
+  addHandle->set_sum_pos(sum_pos);
+  addHandle->set_c_nnz(c_nnz);
+  addHandle->set_call_symbolic();
+  addHandle->set_call_numeric(false);
+
+  values_type c_values(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), c_nnz);
+  C = CMatrix("matrix", nrows, A[0].numCols(), c_nnz, c_values, c_rowmap, c_entries);
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AScalar, typename AMatrix, typename CMatrix>
+void spadd_sum_numeric_impl(const ExecSpace& exec, KernelHandle* handle, const std::vector<AScalar>& alpha,
+                            const std::vector<AMatrix>& A, CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using scalar_type  = typename CMatrix::non_const_value_type;
+  using pos_type     = typename KernelHandle::SPADDHandleType::nnz_lno_view_t;
+  using range_type   = Kokkos::RangePolicy<ExecSpace, ordinal_type>;
+
+  spadd_sum_check("spadd_numeric", A);
+  auto addHandle                       = handle->get_spadd_handle();
+  const std::vector<pos_type>& sum_pos = addHandle->get_sum_pos();
+  if (alpha.size() != A.size() || sum_pos.size() != A.size()) {
+    std::ostringstream os;
+    os << "KokkosSparse::spadd_numeric: got " << A.size() << " matrices and " << alpha.size()
+       << " coefficients, and symbolic was called for " << sum_pos.size() << " matrices";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  const ordinal_type nrows = C.numRows();
+  for (size_t m = 0; m < A.size(); m++) {
+    Kokkos::parallel_for(
+        "KokkosSparse::SpAdd:Sum::Numeric", range_type(exec, 0, nrows),
+        SpaddSumScatterFunctor<size_type, ordinal_type, typename AMatrix::row_map_type, typename AMatrix::values_type,
+                               pos_type, typename CMatrix::row_map_type, typename CMatrix::values_type, scalar_type>(
+            A[m].graph.row_map, A[m].values, sum_pos[m], C.graph.row_map, C.values, scalar_type(alpha[m]), m == 0));
+  }
+  addHandle->set_call_numeric();
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
@@ -0,0 +1,269 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOS_SPGEMM_CHUNKED_IMPL_HPP
+#define _KOKKOS_SPGEMM_CHUNKED_IMPL_HPP
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_spgemm_numeric.hpp"
+#include "KokkosSparse_spgemm_symbolic.hpp"
+
+// Row-chunked SpGEMM, for products whose C (and spgemm work memory) does not
+// fit at once. The rows of A are split into chunks so that an upper bound on
+// the size of each chunk of C, from the row flops of A*B, fits in the memory
+// budget of the spgemm handle. Each chunk is an ordinary spgemm of the rows of
+// A in the chunk with all of B, with its own handle.
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Upper bound on the entries of row i of A*B: its flops, at most ncols
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename BrowptrsT,
+          typename BoundT>
+struct SpgemmChunkRowBoundFunctor {
+  SpgemmChunkRowBoundFunctor(const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_, const BrowptrsT& Browptrs_,
+                             const BoundT& bound_, const size_type ncols_)
+      : Arowptrs(Arowptrs_), Acolinds(Acolinds_), Browptrs(Browptrs_), bound(bound_), ncols(ncols_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    size_type flops = 0;
+    for (size_type ka = Arowptrs(i); ka < Arowptrs(i + 1); ka++) {
+      const ordinal_type k = Acolinds(ka);
+      flops += Browptrs(k + 1) - Browptrs(k);
+    }
+    bound(i) = flops < ncols ? flops : ncols;
+  }
+
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const BrowptrsT Browptrs;
+  BoundT bound;
+  const size_type ncols;
+};
+
+// rowmap(i) = in(begin + i) - in(begin) + offset
+template <typename ordinal_type, typename InT, typename OutT>
+struct SpgemmChunkRowmapFunctor {
+  using size_type = typename OutT::non_const_value_type;
+
+  SpgemmChunkRowmapFunctor(const InT& in_, const OutT& out_, const ordinal_type begin_, const size_type offset_)
+      : in(in_), out(out_), begin(begin_), offset(offset_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    out(i) = in(begin + i) - in(begin) + offset;
+  }
+
+  const InT in;
+  OutT out;
+  const ordinal_type begin;
+  const size_type offset;
+};
+
+// Splits the rows of A into chunks [chunks[c], chunks[c + 1]) whose bound of
+// the size of C, in bytes, is at most budget. A single row over the budget
+// gets a chunk to itself. A budget of 0 gives one chunk, and an A without rows
+// none.
+template <typename CMatrix, typename AMatrix, typename BMatrix>
+std::vector<typename CMatrix::ordinal_type> spgemm_chunk_rows(const AMatrix& A, const BMatrix& B,
+                                                              const size_t budget) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using exec_space   = typename CMatrix::execution_space;
+  using bound_type   = Kokkos::View<size_type*, typename CMatrix::device_type>;
+
+  const ordinal_type nrows = A.numRows();
+  std::vector<ordinal_type> chunks(1, 0);
+  if (budget && nrows) {
+    bound_type bound(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C row bounds"), nrows);
+    Kokkos::parallel_for(
+        "KokkosSparse::SpGEMM:Chunked::RowBounds", Kokkos::RangePolicy<exec_space, ordinal_type>(0, nrows),
+        SpgemmChunkRowBoundFunctor<size_type, ordinal_type, typename AMatrix::row_map_type,
+                                   typename AMatrix::index_type, typename BMatrix::row_map_type, bound_type>(
+            A.graph.row_map, A.graph.entries, B.graph.row_map, bound, B.numCols()));
+    auto hostBound = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bound);
+    // C entries, values and rowmap of each row
+    const size_t entryBytes = sizeof(typename CMatrix::ordinal_type) + sizeof(typename CMatrix::value_type);
+    size_t chunkBytes       = 0;
+    for (ordinal_type i = 0; i < nrows; i++) {
+      const size_t rowBytes = hostBound(i) * entryBytes + sizeof(size_type);
+      if (chunkBytes && chunkBytes + rowBytes > budget) {
+        chunks.push_back(i);
+        chunkBytes = 0;
+      }
+      chunkBytes += rowBytes;
+    }
+  }
+  if (nrows) chunks.push_back(nrows);
+  return chunks;
+}
+
+// Rows [begin, end) of A, sharing the entries and values of A
+template <typename AMatrix>
+AMatrix spgemm_chunk_matrix(const AMatrix& A, const typename AMatrix::ordinal_type begin,
+                            const typename AMatrix::ordinal_type end) {
+  using ordinal_type = typename AMatrix::ordinal_type;
+  using size_type    = typename AMatrix::size_type;
+  using row_map_type = typename AMatrix::row_map_type::non_const_type;
+  using exec_space   = typename AMatrix::execution_space;
+
+  row_map_type rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "A chunk rowmap"), end - begin + 1);
+  Kokkos::parallel_for(
+      "KokkosSparse::SpGEMM:Chunked::ChunkRowmap", Kokkos::RangePolicy<exec_space, ordinal_type>(0, end - begin + 1),
+      SpgemmChunkRowmapFunctor<ordinal_type, typename AMatrix::row_map_type, row_map_type>(A.graph.row_map, rowmap,
+                                                                                         begin, 0));
+  size_type nnzBegin = 0, nnzEnd = 0;
+  Kokkos::deep_copy(nnzBegin, Kokkos::subview(A.graph.row_map, begin));
+  Kokkos::deep_copy(nnzEnd, Kokkos::subview(A.graph.row_map, end));
+  const auto range = Kokkos::make_pair(nnzBegin, nnzEnd);
+  return AMatrix("A chunk", end - begin, A.numCols(), nnzEnd - nnzBegin, Kokkos::subview(A.values, range), rowmap,
+                 Kokkos::subview(A.graph.entries, range));
+}
+
+template <typename AMatrix, typename BMatrix>
+void spgemm_chunked_check(const AMatrix& A, const BMatrix& B) {
+  if (A.numCols() != B.numRows()) {
+    std::ostringstream os;
+    os << "KokkosSparse::spgemm_chunked: A is " << A.numRows() << " x " << A.numCols() << " and B is " << B.numRows()
+       << " x " << B.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+// Calls f(firstRow, Cchunk) with the rows [firstRow, firstRow + Cchunk.numRows())
+// of C = A*B, one chunk at a time
+template <typename CMatrix, typename KernelHandle, typename AMatrix, typename BMatrix, typename ChunkFunctor>
+void spgemm_chunked_for_each_impl(KernelHandle& kh, const AMatrix& A, const BMatrix& B, ChunkFunctor&& f) {
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+
+  spgemm_chunked_check(A, B);
+  auto sh                                = kh.get_spgemm_handle();
+  const std::vector<ordinal_type> chunks = spgemm_chunk_rows<CMatrix>(A, B, sh->get_chunk_memory_budget());
+  sh->set_num_chunks(chunks.size() - 1);
+  for (size_t c = 0; c + 1 < chunks.size(); c++) {
+    AMatrix Achunk = spgemm_chunk_matrix(A, chunks[c], chunks[c + 1]);
+    KernelHandle chunkHandle;
+    chunkHandle.create_spgemm_handle(sh->get_algorithm_type());
+    row_map_type rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk rowmap"), Achunk.numRows() + 1);
+    KokkosSparse::Experimental::spgemm_symbolic(&chunkHandle, Achunk.numRows(), B.numRows(), B.numCols(),
+                                                Achunk.graph.row_map, Achunk.graph.entries, false, B.graph.row_map,
+                                                B.graph.entries, false, rowmap);
+    const size_t nnz = chunkHandle.get_spgemm_handle()->get_c_nnz();
+    entries_type entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk entries"), nnz);
+    values_type values(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk values"), nnz);
+    KokkosSparse::Experimental::spgemm_numeric(&chunkHandle, Achunk.numRows(), B.numRows(), B.numCols(),
+                                               Achunk.graph.row_map, Achunk.graph.entries, Achunk.values, false,
+                                               B.graph.row_map, B.graph.entries, B.values, false, rowmap, entries,
+                                               values);
+    chunkHandle.destroy_spgemm_handle();
+    f(chunks[c], CMatrix("C chunk", Achunk.numRows(), B.numCols(), nnz, values, rowmap, entries));
+  }
+  sh->set_call_symbolic();
+  sh->set_call_numeric();
+}
+
+// Assembles C = A*B chunk by chunk. The first pass runs the symbolic phase of
+// each chunk to count its entries, so that C is allocated once at its final
+// size; the second pass reruns the symbolic phase of each chunk and then its
+// numeric phase directly into its rows of C. Each chunk handle is destroyed
+// before the next is created, so the work memory of spgemm never covers more
+// than one chunk.
+template <typename KernelHandle, typename AMatrix, typename BMatrix, typename CMatrix>
+void spgemm_chunked_impl(KernelHandle& kh, const AMatrix& A, const BMatrix& B, CMatrix& C) {
+  using size_type      = typename CMatrix::size_type;
+  using ordinal_type   = typename CMatrix::ordinal_type;
+  using row_map_type   = typename CMatrix::row_map_type::non_const_type;
+  using entries_type   = typename CMatrix::index_type::non_const_type;
+  using values_type    = typename CMatrix::values_type::non_const_type;
+  using exec_space     = typename CMatrix::execution_space;
+  using rowmap_functor = SpgemmChunkRowmapFunctor<ordinal_type, row_map_type, row_map_type>;
+
+  spgemm_chunked_check(A, B);
+  auto sh                                = kh.get_spgemm_handle();
+  const std::vector<ordinal_type> chunks = spgemm_chunk_rows<CMatrix>(A, B, sh->get_chunk_memory_budget());
+  const size_t numChunks                 = chunks.size() - 1;
+  sh->set_num_chunks(numChunks);
+  const ordinal_type nrows = A.numRows();
+
+  // the chunk handles alive at once, which must never exceed one
+  int liveHandles = 0, maxLiveHandles = 0;
+  auto createChunkHandle = [&](KernelHandle& chunkHandle) {
+    chunkHandle.create_spgemm_handle(sh->get_algorithm_type());
+    maxLiveHandles = std::max(maxLiveHandles, ++liveHandles);
+  };
+  auto destroyChunkHandle = [&](KernelHandle& chunkHandle) {
+    chunkHandle.destroy_spgemm_handle();
+    liveHandles--;
+  };
+
+  // the rowmap of C, one chunk at a time
+  row_map_type c_rowmap("C rowmap", nrows + 1);
+  std::vector<size_type> chunkOffsets(1, 0);
+  for (size_t c = 0; c < numChunks; c++) {
+    AMatrix Achunk = spgemm_chunk_matrix(A, chunks[c], chunks[c + 1]);
+    KernelHandle chunkHandle;
+    createChunkHandle(chunkHandle);
+    row_map_type rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk rowmap"), Achunk.numRows() + 1);
+    KokkosSparse::Experimental::spgemm_symbolic(&chunkHandle, Achunk.numRows(), B.numRows(), B.numCols(),
+                                                Achunk.graph.row_map, Achunk.graph.entries, false, B.graph.row_map,
+                                                B.graph.entries, false, rowmap);
+    const size_type offset      = chunkOffsets.back();
+    row_map_type c_rowmap_chunk = Kokkos::subview(c_rowmap, Kokkos::make_pair(chunks[c], chunks[c + 1] + 1));
+    Kokkos::parallel_for("KokkosSparse::SpGEMM:Chunked::AssembleRowmap",
+                         Kokkos::RangePolicy<exec_space, ordinal_type>(0, Achunk.numRows() + 1),
+                         rowmap_functor(rowmap, c_rowmap_chunk, 0, offset));
+    chunkOffsets.push_back(offset + chunkHandle.get_spgemm_handle()->get_c_nnz());
+    destroyChunkHandle(chunkHandle);
+  }
+  const size_type c_nnz = chunkOffsets.back();
+  entries_type c_entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C entries"), c_nnz);
+  values_type c_values(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C values"), c_nnz);
+
+  // the entries and values of C, one chunk at a time
+  for (size_t c = 0; c < numChunks; c++) {
+    AMatrix Achunk = spgemm_chunk_matrix(A, chunks[c], chunks[c + 1]);
+    KernelHandle chunkHandle;
+    createChunkHandle(chunkHandle);
+    row_map_type rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C chunk rowmap"), Achunk.numRows() + 1);
+    KokkosSparse::Experimental::spgemm_symbolic(&chunkHandle, Achunk.numRows(), B.numRows(), B.numCols(),
+                                                Achunk.graph.row_map, Achunk.graph.entries, false, B.graph.row_map,
+                                                B.graph.entries, false, rowmap);
+    const auto range     = Kokkos::make_pair(chunkOffsets[c], chunkOffsets[c + 1]);
+    entries_type entries = Kokkos::subview(c_entries, range);
+    values_type values   = Kokkos::subview(c_values, range);
+    KokkosSparse::Experimental::spgemm_numeric(&chunkHandle, Achunk.numRows(), B.numRows(), B.numCols(),
+                                               Achunk.graph.row_map, Achunk.graph.entries, Achunk.values, false,
+                                               B.graph.row_map, B.graph.entries, B.values, false, rowmap, entries,
+                                               values);
+    destroyChunkHandle(chunkHandle);
+  }
+  sh->set_max_live_chunk_handles(maxLiveHandles);
+  sh->set_c_nnz(c_nnz);
+  sh->set_call_symbolic();
+  sh->set_call_numeric();
+  C = CMatrix("C=AB", nrows, B.numCols(), c_nnz, c_values, c_rowmap, c_entries);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
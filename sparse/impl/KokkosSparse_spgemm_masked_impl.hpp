@@ -0,0 +1,444 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOS_SPGEMM_MASKED_IMPL_HPP
+#define _KOKKOS_SPGEMM_MASKED_IMPL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_HashmapAccumulator.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+// Masked product C<M> = A*B: only the entries of A*B in the pattern of the mask
+// M (or, for a complemented mask, outside of it) are computed. Each row of C is
+// handled by one thread, with a hashmap accumulator in thread scratch memory
+// that is seeded with the mask columns of the row before the products of the
+// row are accumulated. For a plain mask the hashmap never holds more than the
+// mask row, and products that miss it are dropped without being stored. For a
+// complemented mask it can hold up to ncols keys, so when it does not fit in
+// scratch memory the threads take chunks of a memory pool instead.
+//
+// Symbolic counts and then fills the columns of C, and sorts them. Numeric
+// seeds the hashmap with the columns of the row of C, so it only needs the
+// pattern of C and can be called again whenever the values of A and B change.
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Flags of the keys of the symbolic hashmap
+enum : int { SPGEMM_MASKED_OUT = 0, SPGEMM_MASKED_HIT = 1 };
+
+// Position of key in the hashmap hm of size hashSize (a power of 2), or -1
+template <typename ordinal_type, typename hashmap_t>
+KOKKOS_INLINE_FUNCTION ordinal_type spgemm_masked_find(const hashmap_t& hm, const ordinal_type hashSize,
+                                                       const ordinal_type key) {
+  for (ordinal_type i = hm.hash_begins[key & (hashSize - 1)]; i != -1; i = hm.hash_nexts[i]) {
+    if (hm.keys[i] == key) return i;
+  }
+  return -1;
+}
+
+// Number of keys the hashmap of row i must hold: the mask columns, plus for a
+// complemented mask a bound on the number of columns of row i of A*B
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename BrowptrsT,
+          typename MrowptrsT>
+KOKKOS_INLINE_FUNCTION ordinal_type spgemm_masked_capacity(const ordinal_type i, const ArowptrsT& Arowptrs,
+                                                           const AcolindsT& Acolinds, const BrowptrsT& Browptrs,
+                                                           const MrowptrsT& Mrowptrs, const ordinal_type ncols,
+                                                           const bool complement) {
+  ordinal_type capacity = Mrowptrs(i + 1) - Mrowptrs(i);
+  if (complement) {
+    size_type flops = 0;
+    for (size_type ka = Arowptrs(i); ka < Arowptrs(i + 1); ka++) {
+      const ordinal_type k = Acolinds(ka);
+      flops += Browptrs(k + 1) - Browptrs(k);
+    }
+    capacity += flops < size_type(ncols) ? ordinal_type(flops) : ncols;
+  }
+  return capacity;
+}
+
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename BrowptrsT,
+          typename MrowptrsT>
+struct SpgemmMaskedCapacityFunctor {
+  SpgemmMaskedCapacityFunctor(const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_, const BrowptrsT& Browptrs_,
+                              const MrowptrsT& Mrowptrs_, const ordinal_type ncols_, const bool complement_)
+      : Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Browptrs(Browptrs_),
+        Mrowptrs(Mrowptrs_),
+        ncols(ncols_),
+        complement(complement_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i, ordinal_type& lmax) const {
+    const ordinal_type capacity = spgemm_masked_capacity<size_type>(i, Arowptrs, Acolinds, Browptrs, Mrowptrs, ncols,
+                                                                    complement);
+    if (capacity > lmax) lmax = capacity;
+  }
+
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const BrowptrsT Browptrs;
+  const MrowptrsT Mrowptrs;
+  const ordinal_type ncols;
+  const bool complement;
+};
+
+// Thread scratch of the masked kernels: hash begins, then hash nexts, keys,
+// values and used hashes for up to maxCapacity keys
+template <typename ordinal_type>
+KOKKOS_INLINE_FUNCTION size_t spgemm_masked_scratch_size(const ordinal_type maxCapacity,
+                                                         const ordinal_type maxHashSize) {
+  return (maxHashSize + 4 * size_t(maxCapacity)) * sizeof(ordinal_type);
+}
+
+template <typename ordinal_type>
+KOKKOS_INLINE_FUNCTION ordinal_type spgemm_masked_hash_size(const ordinal_type capacity) {
+  ordinal_type hashSize = 1;
+  while (hashSize < capacity) hashSize *= 2;
+  return hashSize;
+}
+
+// Hashmap memory of the thread of a row, extraBytes followed by the hashmap
+// for up to maxCapacity keys: thread scratch of the given level, or with level
+// -1 a chunk of the pool. spgemm_masked_policy picks the level.
+template <typename ExecSpace, typename ordinal_type>
+struct SpgemmMaskedWork {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using pool_type   = KokkosKernels::Impl::UniformMemoryPool<ExecSpace, uint64_t>;
+
+  explicit SpgemmMaskedWork(const ordinal_type maxCapacity_, const size_t extraBytes = 0)
+      : maxCapacity(maxCapacity_),
+        maxHashSize(spgemm_masked_hash_size(maxCapacity_)),
+        bytes((extraBytes + spgemm_masked_scratch_size(maxCapacity_, maxHashSize) + 7) / 8 * 8),
+        level(1) {}
+
+  KOKKOS_INLINE_FUNCTION char* acquire(const member_type& t, const ordinal_type i) const {
+    if (level >= 0) return (char*)t.thread_scratch(level).get_shmem(bytes);
+    uint64_t* chunk = nullptr;
+    while (!chunk) chunk = pool.allocate_chunk(i);
+    return (char*)chunk;
+  }
+
+  KOKKOS_INLINE_FUNCTION void release(const char* chunk) const {
+    if (level < 0) pool.release_chunk((const uint64_t*)chunk);
+  }
+
+  ordinal_type maxCapacity;
+  ordinal_type maxHashSize;
+  size_t bytes;
+  int level;
+  pool_type pool;
+};
+
+// Counts (into Crowptrs) or fills (into Ccolinds) the entries of C<M> = A*B
+template <typename ExecSpace, typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT,
+          typename BrowptrsT, typename BcolindsT, typename MrowptrsT, typename McolindsT, typename CrowptrsT,
+          typename CcolindsT>
+struct SpgemmMaskedSymbolicFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using hashmap_t   = KokkosKernels::Experimental::HashmapAccumulator<
+      ordinal_type, ordinal_type, ordinal_type, KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  SpgemmMaskedSymbolicFunctor(const ordinal_type nrows_, const ordinal_type ncols_, const ArowptrsT& Arowptrs_,
+                              const AcolindsT& Acolinds_, const BrowptrsT& Browptrs_, const BcolindsT& Bcolinds_,
+                              const MrowptrsT& Mrowptrs_, const McolindsT& Mcolinds_, const CrowptrsT& Crowptrs_,
+                              const CcolindsT& Ccolinds_, const bool complement_, const bool count_,
+                              const ordinal_type maxCapacity_)
+      : nrows(nrows_),
+        ncols(ncols_),
+        Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Browptrs(Browptrs_),
+        Bcolinds(Bcolinds_),
+        Mrowptrs(Mrowptrs_),
+        Mcolinds(Mcolinds_),
+        Crowptrs(Crowptrs_),
+        Ccolinds(Ccolinds_),
+        complement(complement_),
+        count(count_),
+        work(maxCapacity_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    const ordinal_type i = t.league_rank() * t.team_size() + t.team_rank();
+    if (i >= nrows) return;
+    const ordinal_type capacity =
+        spgemm_masked_capacity<size_type>(i, Arowptrs, Acolinds, Browptrs, Mrowptrs, ncols, complement);
+    ordinal_type numHits = 0;
+    if (capacity) {
+      const ordinal_type maxCapacity = work.maxCapacity;
+      const ordinal_type hashSize    = spgemm_masked_hash_size(capacity);
+      ordinal_type* begins           = (ordinal_type*)work.acquire(t, i);
+      ordinal_type* nexts            = begins + work.maxHashSize;
+      ordinal_type* keys             = nexts + maxCapacity;
+      ordinal_type* flags            = keys + maxCapacity;
+      ordinal_type* usedHashes       = flags + maxCapacity;
+      for (ordinal_type h = 0; h < hashSize; h++) begins[h] = -1;
+      hashmap_t hm(capacity, hashSize, begins, nexts, keys, flags);
+      ordinal_type used = 0, usedHashCount = 0;
+      // seed with the mask columns
+      for (size_type j = Mrowptrs(i); j < Mrowptrs(i + 1); j++) {
+        hm.sequential_insert_into_hash_TrackHashes(Mcolinds(j), &used, &usedHashCount, usedHashes);
+      }
+      for (ordinal_type s = 0; s < used; s++) flags[s] = SPGEMM_MASKED_OUT;
+      for (size_type ka = Arowptrs(i); ka < Arowptrs(i + 1); ka++) {
+        const ordinal_type k = Acolinds(ka);
+        for (size_type kb = Browptrs(k); kb < Browptrs(k + 1); kb++) {
+          const ordinal_type col = Bcolinds(kb);
+          const ordinal_type pos = spgemm_masked_find(hm, hashSize, col);
+          if (!complement) {
+            if (pos != -1) flags[pos] = SPGEMM_MASKED_HIT;
+          } else if (pos == -1) {
+            hm.sequential_insert_into_hash_TrackHashes(col, &used, &usedHashCount, usedHashes);
+            flags[used - 1] = SPGEMM_MASKED_HIT;
+          }
+        }
+      }
+      size_type Coffset = count ? 0 : Crowptrs(i);
+      for (ordinal_type s = 0; s < used; s++) {
+        if (flags[s] != SPGEMM_MASKED_HIT) continue;
+        if (!count) Ccolinds(Coffset + numHits) = keys[s];
+        numHits++;
+      }
+      work.release((char*)begins);
+    }
+    if (count) Crowptrs(i) = numHits;
+  }
+
+  const ordinal_type nrows;
+  const ordinal_type ncols;
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const BrowptrsT Browptrs;
+  const BcolindsT Bcolinds;
+  const MrowptrsT Mrowptrs;
+  const McolindsT Mcolinds;
+  CrowptrsT Crowptrs;
+  CcolindsT Ccolinds;
+  const bool complement;
+  const bool count;
+  SpgemmMaskedWork<ExecSpace, ordinal_type> work;
+};
+
+// Computes the values of A*B at the existing entries of C, whose columns must
+// be unique within each row. Products outside the pattern of C are dropped.
+template <typename ExecSpace, typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT,
+          typename AvaluesT, typename BrowptrsT, typename BcolindsT, typename BvaluesT, typename CrowptrsT,
+          typename CcolindsT, typename CvaluesT>
+struct SpgemmMaskedNumericFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scalar_type = typename CvaluesT::non_const_value_type;
+  using hashmap_t   = KokkosKernels::Experimental::HashmapAccumulator<
+      ordinal_type, ordinal_type, ordinal_type, KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  SpgemmMaskedNumericFunctor(const ordinal_type nrows_, const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_,
+                             const AvaluesT& Avalues_, const BrowptrsT& Browptrs_, const BcolindsT& Bcolinds_,
+                             const BvaluesT& Bvalues_, const CrowptrsT& Crowptrs_, const CcolindsT& Ccolinds_,
+                             const CvaluesT& Cvalues_, const ordinal_type maxCapacity_)
+      : nrows(nrows_),
+        Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Avalues(Avalues_),
+        Browptrs(Browptrs_),
+        Bcolinds(Bcolinds_),
+        Bvalues(Bvalues_),
+        Crowptrs(Crowptrs_),
+        Ccolinds(Ccolinds_),
+        Cvalues(Cvalues_),
+        work(maxCapacity_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    const ordinal_type i = t.league_rank() * t.team_size() + t.team_rank();
+    if (i >= nrows) return;
+    const size_type CrowStart   = Crowptrs(i);
+    const ordinal_type capacity = Crowptrs(i + 1) - CrowStart;
+    if (!capacity) return;
+    const ordinal_type hashSize = spgemm_masked_hash_size(capacity);
+    ordinal_type* begins        = (ordinal_type*)work.acquire(t, i);
+    ordinal_type* nexts         = begins + work.maxHashSize;
+    ordinal_type* keys          = nexts + work.maxCapacity;
+    ordinal_type* usedHashes    = keys + 2 * work.maxCapacity;
+    for (ordinal_type h = 0; h < hashSize; h++) begins[h] = -1;
+    hashmap_t hm(capacity, hashSize, begins, nexts, keys, nullptr);
+    // seed with the columns of C, so that the position of a key in the
+    // hashmap is its position in the row of C
+    ordinal_type used = 0, usedHashCount = 0;
+    for (ordinal_type s = 0; s < capacity; s++) {
+      hm.sequential_insert_into_hash_TrackHashes(Ccolinds(CrowStart + s), &used, &usedHashCount, usedHashes);
+      Cvalues(CrowStart + s) = Kokkos::ArithTraits<scalar_type>::zero();
+    }
+    for (size_type ka = Arowptrs(i); ka < Arowptrs(i + 1); ka++) {
+      const ordinal_type k  = Acolinds(ka);
+      const scalar_type Aik = Avalues(ka);
+      for (size_type kb = Browptrs(k); kb < Browptrs(k + 1); kb++) {
+        const ordinal_type pos = spgemm_masked_find(hm, hashSize, ordinal_type(Bcolinds(kb)));
+        if (pos != -1) Cvalues(CrowStart + pos) += Aik * Bvalues(kb);
+      }
+    }
+    work.release((char*)begins);
+  }
+
+  const ordinal_type nrows;
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const AvaluesT Avalues;
+  const BrowptrsT Browptrs;
+  const BcolindsT Bcolinds;
+  const BvaluesT Bvalues;
+  const CrowptrsT Crowptrs;
+  const CcolindsT Ccolinds;
+  CvaluesT Cvalues;
+  SpgemmMaskedWork<ExecSpace, ordinal_type> work;
+};
+
+// One row per thread, with f.work.bytes of hashmap memory per thread: in level
+// 0 scratch if it fits, else in level 1 scratch with the team size bounded by
+// scratch_size_max(1), else in a pool with at most one chunk per thread, that
+// takes at most half of the free memory of GPUs.
+template <typename ExecSpace, typename ordinal_type, typename Functor>
+Kokkos::TeamPolicy<ExecSpace> spgemm_masked_policy(const ExecSpace& exec, Functor& f, const ordinal_type nrows) {
+  using TeamPol        = Kokkos::TeamPolicy<ExecSpace>;
+  using pool_type      = typename decltype(f.work)::pool_type;
+  const size_t scratch = f.work.bytes;
+  for (int level = 0; level < 2; level++) {
+    TeamPol testPolicy(exec, 1, 1);
+    testPolicy.set_scratch_size(level, Kokkos::PerThread(scratch));
+    const size_t maxTeamSize = testPolicy.scratch_size_max(level) / scratch;
+    int team_size            = testPolicy.team_size_recommended(f, Kokkos::ParallelForTag());
+    if (size_t(team_size) > maxTeamSize) team_size = maxTeamSize;
+    if (team_size < 1) continue;
+    f.work.level    = level;
+    int league_size = (nrows + team_size - 1) / team_size;
+    TeamPol policy(exec, league_size, team_size);
+    policy.set_scratch_size(level, Kokkos::PerThread(scratch));
+    return policy;
+  }
+  size_t numChunks = exec.concurrency();
+  if (KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace>) {
+    size_t freeBytes = 0, totalBytes = 0;
+    KokkosKernels::Impl::kk_get_free_total_memory<typename ExecSpace::memory_space>(freeBytes, totalBytes);
+    numChunks = std::max(size_t(1), std::min(numChunks, freeBytes / 2 / scratch));
+  }
+  f.work.level = -1;
+  f.work.pool  =
+      pool_type(numChunks, scratch / sizeof(uint64_t), 0, KokkosKernels::Impl::ManyThread2OneChunk, false);
+
+  int team_size   = TeamPol(exec, 1, 1).team_size_recommended(f, Kokkos::ParallelForTag());
+  int league_size = (nrows + team_size - 1) / team_size;
+  return TeamPol(exec, league_size, team_size);
+}
+
+template <typename AMatrix, typename BMatrix>
+void spgemm_masked_check(const char name[], const AMatrix& A, const BMatrix& B, const size_t maskRows) {
+  if (A.numCols() != B.numRows() || size_t(A.numRows()) != maskRows) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": incompatible dimensions: A is " << A.numRows() << " x " << A.numCols()
+       << ", B is " << B.numRows() << " x " << B.numCols() << " and the mask has " << maskRows << " rows";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename BMatrix, typename MGraph,
+          typename CMatrix>
+void spgemm_masked_symbolic_impl(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const BMatrix& B,
+                                 const MGraph& M, const bool complement, CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  using functor_type = SpgemmMaskedSymbolicFunctor<ExecSpace, size_type, ordinal_type, typename AMatrix::row_map_type,
+                                                   typename AMatrix::index_type, typename BMatrix::row_map_type,
+                                                   typename BMatrix::index_type, typename MGraph::row_map_type,
+                                                   typename MGraph::entries_type, row_map_type, entries_type>;
+
+  const size_t maskRows = M.row_map.extent(0) ? M.row_map.extent(0) - 1 : 0;
+  spgemm_masked_check("spgemm_masked_symbolic", A, B, maskRows);
+  const ordinal_type nrows = A.numRows();
+  const ordinal_type ncols = B.numCols();
+
+  ordinal_type maxCapacity = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::SpGEMM:Masked::Symbolic::Capacity", Kokkos::RangePolicy<ExecSpace, ordinal_type>(exec, 0, nrows),
+      SpgemmMaskedCapacityFunctor<size_type, ordinal_type, typename AMatrix::row_map_type, typename AMatrix::index_type,
+                                  typename BMatrix::row_map_type, typename MGraph::row_map_type>(
+          A.graph.row_map, A.graph.entries, B.graph.row_map, M.row_map, ncols, complement),
+      Kokkos::Max<ordinal_type>(maxCapacity));
+
+  row_map_type c_rowmap(Kokkos::view_alloc(exec, "row map"), nrows + 1);
+  entries_type c_entries;
+  functor_type countFunctor(nrows, ncols, A.graph.row_map, A.graph.entries, B.graph.row_map, B.graph.entries,
+                            M.row_map, M.entries, c_rowmap, c_entries, complement, true, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:Masked::Symbolic::Count",
+                       spgemm_masked_policy(exec, countFunctor, nrows), countFunctor);
+  size_type c_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, nrows + 1, c_rowmap, c_nnz);
+  c_entries = entries_type(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "entries"), c_nnz);
+  functor_type fillFunctor(nrows, ncols, A.graph.row_map, A.graph.entries, B.graph.row_map, B.graph.entries,
+                           M.row_map, M.entries, c_rowmap, c_entries, complement, false, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:Masked::Symbolic::Fill", spgemm_masked_policy(exec, fillFunctor, nrows),
+                       fillFunctor);
+  KokkosSparse::sort_crs_graph(exec, c_rowmap, c_entries, ncols);
+
+  auto sh = handle->get_spgemm_handle();
+  sh->set_c_nnz(c_nnz);
+  sh->set_max_result_nnz(KokkosSparse::Impl::graph_max_degree(exec, c_rowmap));
+  sh->set_call_symbolic();
+  sh->set_call_numeric(false);
+
+  values_type c_values(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), c_nnz);
+  C = CMatrix("C<M>=AB", nrows, ncols, c_nnz, c_values, c_rowmap, c_entries);
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename BMatrix, typename CMatrix>
+void spgemm_masked_numeric_impl(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const BMatrix& B,
+                                CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using functor_type =
+      SpgemmMaskedNumericFunctor<ExecSpace, size_type, ordinal_type, typename AMatrix::row_map_type,
+                                 typename AMatrix::index_type, typename AMatrix::values_type,
+                                 typename BMatrix::row_map_type, typename BMatrix::index_type,
+                                 typename BMatrix::values_type, typename CMatrix::row_map_type,
+                                 typename CMatrix::index_type, typename CMatrix::values_type>;
+
+  spgemm_masked_check("spgemm_masked_numeric", A, B, C.numRows());
+  if (C.numCols() != B.numCols()) {
+    std::ostringstream os;
+    os << "KokkosSparse::spgemm_masked_numeric: C has " << C.numCols() << " columns but B has " << B.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  const ordinal_type nrows       = C.numRows();
+  const ordinal_type maxCapacity = KokkosSparse::Impl::graph_max_degree(exec, C.graph.row_map);
+  functor_type numericFunctor(nrows, A.graph.row_map, A.graph.entries, A.values, B.graph.row_map, B.graph.entries,
+                              B.values, C.graph.row_map, C.graph.entries, C.values, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:Masked::Numeric", spgemm_masked_policy(exec, numericFunctor, nrows),
+                       numericFunctor);
+  handle->get_spgemm_handle()->set_call_numeric();
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
@@ -0,0 +1,444 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOS_SPGEMM_RAP_IMPL_HPP
+#define _KOKKOS_SPGEMM_RAP_IMPL_HPP
+
+#include <sstream>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_spgemm_masked_impl.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+// Fused triple product Ac = R*A*P, without storing A*P. Each coarse row i of Ac
+// is accumulated by one thread in a hashmap in thread scratch (as in the masked
+// spgemm), directly from the rows of R, A and P:
+//   Ac(i, :) = sum_j R(i, j) sum_k A(j, k) P(k, :)
+// Symbolic collects the columns of each row and sorts them. Numeric seeds the
+// hashmap with the columns of Ac, so that it can be repeated for new values.
+//
+// For Ac = P^T*A*P, numeric instead goes over the fine rows j: the row j of
+// A*P is accumulated in a hashmap and added to the rows of Ac given by row j of
+// P, with atomics (so the order of the sums, and the rounding of Ac, is not
+// deterministic). This needs no transpose of P. Symbolic uses the graph of
+// P^T (without values) as the graph of R, and frees it afterwards.
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Bound on the columns of row i of R*A*P: its flops, at most ncols
+template <typename size_type, typename ordinal_type, typename RrowptrsT, typename RcolindsT, typename ArowptrsT,
+          typename AcolindsT, typename ProwptrsT>
+KOKKOS_INLINE_FUNCTION ordinal_type spgemm_rap_row_bound(const ordinal_type i, const RrowptrsT& Rrowptrs,
+                                                         const RcolindsT& Rcolinds, const ArowptrsT& Arowptrs,
+                                                         const AcolindsT& Acolinds, const ProwptrsT& Prowptrs,
+                                                         const ordinal_type ncols) {
+  size_type flops = 0;
+  for (size_type jr = Rrowptrs(i); jr < Rrowptrs(i + 1) && flops < size_type(ncols); jr++) {
+    const ordinal_type j = Rcolinds(jr);
+    for (size_type ka = Arowptrs(j); ka < Arowptrs(j + 1); ka++) {
+      const ordinal_type k = Acolinds(ka);
+      flops += Prowptrs(k + 1) - Prowptrs(k);
+    }
+  }
+  return flops < size_type(ncols) ? ordinal_type(flops) : ncols;
+}
+
+// Bound on the columns of row j of A*P: its flops, at most ncols
+template <typename size_type, typename ordinal_type, typename ArowptrsT, typename AcolindsT, typename ProwptrsT>
+KOKKOS_INLINE_FUNCTION ordinal_type spgemm_ap_row_bound(const ordinal_type j, const ArowptrsT& Arowptrs,
+                                                        const AcolindsT& Acolinds, const ProwptrsT& Prowptrs,
+                                                        const ordinal_type ncols) {
+  size_type flops = 0;
+  for (size_type ka = Arowptrs(j); ka < Arowptrs(j + 1); ka++) {
+    const ordinal_type k = Acolinds(ka);
+    flops += Prowptrs(k + 1) - Prowptrs(k);
+  }
+  return flops < size_type(ncols) ? ordinal_type(flops) : ncols;
+}
+
+// Max of the row bounds of R*A*P (or, without R, of A*P)
+template <typename size_type, typename ordinal_type, typename RrowptrsT, typename RcolindsT, typename ArowptrsT,
+          typename AcolindsT, typename ProwptrsT>
+struct SpgemmRapCapacityFunctor {
+  SpgemmRapCapacityFunctor(const RrowptrsT& Rrowptrs_, const RcolindsT& Rcolinds_, const ArowptrsT& Arowptrs_,
+                           const AcolindsT& Acolinds_, const ProwptrsT& Prowptrs_, const ordinal_type ncols_,
+                           const bool withR_)
+      : Rrowptrs(Rrowptrs_),
+        Rcolinds(Rcolinds_),
+        Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Prowptrs(Prowptrs_),
+        ncols(ncols_),
+        withR(withR_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i, ordinal_type& lmax) const {
+    const ordinal_type capacity =
+        withR ? spgemm_rap_row_bound<size_type>(i, Rrowptrs, Rcolinds, Arowptrs, Acolinds, Prowptrs, ncols)
+              : spgemm_ap_row_bound<size_type>(i, Arowptrs, Acolinds, Prowptrs, ncols);
+    if (capacity > lmax) lmax = capacity;
+  }
+
+  const RrowptrsT Rrowptrs;
+  const RcolindsT Rcolinds;
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const ProwptrsT Prowptrs;
+  const ordinal_type ncols;
+  const bool withR;
+};
+
+// Counts (into Crowptrs) or fills (into Ccolinds) the entries of R*A*P
+template <typename ExecSpace, typename size_type, typename ordinal_type, typename RrowptrsT, typename RcolindsT,
+          typename ArowptrsT, typename AcolindsT, typename ProwptrsT, typename PcolindsT, typename CrowptrsT,
+          typename CcolindsT>
+struct SpgemmRapSymbolicFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using hashmap_t   = KokkosKernels::Experimental::HashmapAccumulator<
+      ordinal_type, ordinal_type, ordinal_type, KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  SpgemmRapSymbolicFunctor(const ordinal_type nrows_, const ordinal_type ncols_, const RrowptrsT& Rrowptrs_,
+                           const RcolindsT& Rcolinds_, const ArowptrsT& Arowptrs_, const AcolindsT& Acolinds_,
+                           const ProwptrsT& Prowptrs_, const PcolindsT& Pcolinds_, const CrowptrsT& Crowptrs_,
+                           const CcolindsT& Ccolinds_, const bool count_, const ordinal_type maxCapacity_)
+      : nrows(nrows_),
+        ncols(ncols_),
+        Rrowptrs(Rrowptrs_),
+        Rcolinds(Rcolinds_),
+        Arowptrs(Arowptrs_),
+        Acolinds(Acolinds_),
+        Prowptrs(Prowptrs_),
+        Pcolinds(Pcolinds_),
+        Crowptrs(Crowptrs_),
+        Ccolinds(Ccolinds_),
+        count(count_),
+        work(maxCapacity_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    const ordinal_type i = t.league_rank() * t.team_size() + t.team_rank();
+    if (i >= nrows) return;
+    const ordinal_type capacity =
+        spgemm_rap_row_bound<size_type>(i, Rrowptrs, Rcolinds, Arowptrs, Acolinds, Prowptrs, ncols);
+    ordinal_type used = 0;
+    if (capacity) {
+      const ordinal_type hashSize = spgemm_masked_hash_size(capacity);
+      ordinal_type* begins        = (ordinal_type*)work.acquire(t, i);
+      ordinal_type* nexts         = begins + work.maxHashSize;
+      ordinal_type* keys          = nexts + work.maxCapacity;
+      ordinal_type* usedHashes    = keys + work.maxCapacity;
+      for (ordinal_type h = 0; h < hashSize; h++) begins[h] = -1;
+      hashmap_t hm(capacity, hashSize, begins, nexts, keys, nullptr);
+      ordinal_type usedHashCount = 0;
+      for (size_type jr = Rrowptrs(i); jr < Rrowptrs(i + 1); jr++) {
+        const ordinal_type j = Rcolinds(jr);
+        for (size_type ka = Arowptrs(j); ka < Arowptrs(j + 1); ka++) {
+          const ordinal_type k = Acolinds(ka);
+          for (size_type kp = Prowptrs(k); kp < Prowptrs(k + 1); kp++) {
+            hm.sequential_insert_into_hash_TrackHashes(Pcolinds(kp), &used, &usedHashCount, usedHashes);
+          }
+        }
+      }
+      if (!count) {
+        const size_type CrowStart = Crowptrs(i);
+        for (ordinal_type s = 0; s < used; s++) Ccolinds(CrowStart + s) = keys[s];
+      }
+      work.release((char*)begins);
+    }
+    if (count) Crowptrs(i) = used;
+  }
+
+  const ordinal_type nrows;
+  const ordinal_type ncols;
+  const RrowptrsT Rrowptrs;
+  const RcolindsT Rcolinds;
+  const ArowptrsT Arowptrs;
+  const AcolindsT Acolinds;
+  const ProwptrsT Prowptrs;
+  const PcolindsT Pcolinds;
+  CrowptrsT Crowptrs;
+  CcolindsT Ccolinds;
+  const bool count;
+  SpgemmMaskedWork<ExecSpace, ordinal_type> work;
+};
+
+// Values of R*A*P at the entries of Ac, one coarse row per thread
+template <typename ExecSpace, typename size_type, typename ordinal_type, typename RMatrix, typename AMatrix,
+          typename PMatrix, typename CMatrix>
+struct SpgemmRapNumericFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scalar_type = typename CMatrix::non_const_value_type;
+  using hashmap_t   = KokkosKernels::Experimental::HashmapAccumulator<
+      ordinal_type, ordinal_type, ordinal_type, KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  SpgemmRapNumericFunctor(const RMatrix& R_, const AMatrix& A_, const PMatrix& P_, const CMatrix& C_,
+                          const ordinal_type maxCapacity_)
+      : R(R_), A(A_), P(P_), C(C_), work(maxCapacity_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    const ordinal_type i = t.league_rank() * t.team_size() + t.team_rank();
+    if (i >= C.numRows()) return;
+    const size_type CrowStart   = C.graph.row_map(i);
+    const ordinal_type capacity = C.graph.row_map(i + 1) - CrowStart;
+    if (!capacity) return;
+    const ordinal_type hashSize = spgemm_masked_hash_size(capacity);
+    ordinal_type* begins        = (ordinal_type*)work.acquire(t, i);
+    ordinal_type* nexts         = begins + work.maxHashSize;
+    ordinal_type* keys          = nexts + work.maxCapacity;
+    ordinal_type* usedHashes    = keys + work.maxCapacity;
+    for (ordinal_type h = 0; h < hashSize; h++) begins[h] = -1;
+    hashmap_t hm(capacity, hashSize, begins, nexts, keys, nullptr);
+    // seed with the columns of Ac, so that the position of a key in the
+    // hashmap is its position in the row of Ac
+    ordinal_type used = 0, usedHashCount = 0;
+    for (ordinal_type s = 0; s < capacity; s++) {
+      hm.sequential_insert_into_hash_TrackHashes(C.graph.entries(CrowStart + s), &used, &usedHashCount, usedHashes);
+      C.values(CrowStart + s) = Kokkos::ArithTraits<scalar_type>::zero();
+    }
+    for (size_type jr = R.graph.row_map(i); jr < R.graph.row_map(i + 1); jr++) {
+      const ordinal_type j  = R.graph.entries(jr);
+      const scalar_type Rij = R.values(jr);
+      for (size_type ka = A.graph.row_map(j); ka < A.graph.row_map(j + 1); ka++) {
+        const ordinal_type k = A.graph.entries(ka);
+        const scalar_type RA = Rij * A.values(ka);
+        for (size_type kp = P.graph.row_map(k); kp < P.graph.row_map(k + 1); kp++) {
+          const ordinal_type pos = spgemm_masked_find(hm, hashSize, ordinal_type(P.graph.entries(kp)));
+          if (pos != -1) C.values(CrowStart + pos) += RA * P.values(kp);
+        }
+      }
+    }
+    work.release((char*)begins);
+  }
+
+  const RMatrix R;
+  const AMatrix A;
+  const PMatrix P;
+  CMatrix C;
+  SpgemmMaskedWork<ExecSpace, ordinal_type> work;
+};
+
+// Adds P(j, :)^T * (A*P)(j, :) to Ac for each fine row j, one per thread. The
+// columns of each row of Ac must be sorted and Ac must start at zero.
+template <typename ExecSpace, typename size_type, typename ordinal_type, typename AMatrix, typename PMatrix,
+          typename CMatrix>
+struct SpgemmPtapNumericFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scalar_type = typename CMatrix::non_const_value_type;
+  using hashmap_t   = KokkosKernels::Experimental::HashmapAccumulator<
+      ordinal_type, ordinal_type, scalar_type, KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  SpgemmPtapNumericFunctor(const AMatrix& A_, const PMatrix& P_, const CMatrix& C_, const ordinal_type maxCapacity_)
+      : A(A_), P(P_), C(C_), work(maxCapacity_, values_size(maxCapacity_)) {}
+
+  // values of the hashmap first, padded to 8 bytes, then the keys
+  KOKKOS_INLINE_FUNCTION static size_t values_size(const ordinal_type maxCapacity) {
+    return (maxCapacity * sizeof(scalar_type) + 7) / 8 * 8;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    const ordinal_type j = t.league_rank() * t.team_size() + t.team_rank();
+    if (j >= A.numRows()) return;
+    const ordinal_type capacity =
+        spgemm_ap_row_bound<size_type>(j, A.graph.row_map, A.graph.entries, P.graph.row_map, C.numCols());
+    if (!capacity || P.graph.row_map(j) == P.graph.row_map(j + 1)) return;
+    const ordinal_type hashSize = spgemm_masked_hash_size(capacity);
+    char* scratch               = work.acquire(t, j);
+    scalar_type* values         = (scalar_type*)scratch;
+    ordinal_type* begins        = (ordinal_type*)(scratch + values_size(work.maxCapacity));
+    ordinal_type* nexts         = begins + work.maxHashSize;
+    ordinal_type* keys          = nexts + work.maxCapacity;
+    ordinal_type* usedHashes    = keys + work.maxCapacity;
+    for (ordinal_type h = 0; h < hashSize; h++) begins[h] = -1;
+    hashmap_t hm(capacity, hashSize, begins, nexts, keys, values);
+    // row j of A*P
+    ordinal_type used = 0, usedHashCount = 0;
+    for (size_type ka = A.graph.row_map(j); ka < A.graph.row_map(j + 1); ka++) {
+      const ordinal_type k  = A.graph.entries(ka);
+      const scalar_type Ajk = A.values(ka);
+      for (size_type kp = P.graph.row_map(k); kp < P.graph.row_map(k + 1); kp++) {
+        hm.sequential_insert_into_hash_mergeAdd_TrackHashes(P.graph.entries(kp), Ajk * P.values(kp), &used,
+                                                           &usedHashCount, usedHashes);
+      }
+    }
+    // scattered to the coarse rows i with P(j, i) != 0
+    for (size_type ip = P.graph.row_map(j); ip < P.graph.row_map(j + 1); ip++) {
+      const ordinal_type i      = P.graph.entries(ip);
+      const scalar_type Pji     = P.values(ip);
+      const size_type CrowStart = C.graph.row_map(i);
+      const size_type CrowEnd   = C.graph.row_map(i + 1);
+      for (ordinal_type s = 0; s < used; s++) {
+        size_type lo = CrowStart, hi = CrowEnd;
+        while (lo < hi) {
+          const size_type mid = lo + (hi - lo) / 2;
+          if (C.graph.entries(mid) < keys[s])
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        if (lo < CrowEnd && C.graph.entries(lo) == keys[s]) Kokkos::atomic_add(&C.values(lo), Pji * values[s]);
+      }
+    }
+    work.release(scratch);
+  }
+
+  const AMatrix A;
+  const PMatrix P;
+  CMatrix C;
+  SpgemmMaskedWork<ExecSpace, ordinal_type> work;
+};
+
+template <typename RMatrix, typename AMatrix, typename PMatrix>
+void spgemm_rap_check(const char name[], const RMatrix& R, const AMatrix& A, const PMatrix& P) {
+  if (R.numCols() != A.numRows() || A.numCols() != P.numRows()) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::" << name << ": incompatible dimensions: R is " << R.numRows() << " x "
+       << R.numCols() << ", A is " << A.numRows() << " x " << A.numCols() << " and P is " << P.numRows() << " x "
+       << P.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+template <typename AMatrix, typename PMatrix>
+void spgemm_ptap_check(const char name[], const AMatrix& A, const PMatrix& P) {
+  if (A.numRows() != P.numRows() || A.numCols() != P.numRows()) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::" << name << ": incompatible dimensions: A is " << A.numRows() << " x "
+       << A.numCols() << " and P is " << P.numRows() << " x " << P.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+// Symbolic phase of Ac = R*A*P, given the graph (Rrowmap, Rentries) of R with
+// nrows rows
+template <typename ExecSpace, typename KernelHandle, typename RrowmapT, typename RentriesT, typename AMatrix,
+          typename PMatrix, typename CMatrix>
+void spgemm_rap_symbolic_impl(const ExecSpace& exec, KernelHandle* handle, const typename CMatrix::ordinal_type nrows,
+                              const RrowmapT& Rrowmap, const RentriesT& Rentries, const AMatrix& A, const PMatrix& P,
+                              CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using row_map_type = typename CMatrix::row_map_type::non_const_type;
+  using entries_type = typename CMatrix::index_type::non_const_type;
+  using values_type  = typename CMatrix::values_type::non_const_type;
+  using functor_type = SpgemmRapSymbolicFunctor<ExecSpace, size_type, ordinal_type, RrowmapT, RentriesT,
+                                                typename AMatrix::row_map_type, typename AMatrix::index_type,
+                                                typename PMatrix::row_map_type, typename PMatrix::index_type,
+                                                row_map_type, entries_type>;
+
+  const ordinal_type ncols = P.numCols();
+  ordinal_type maxCapacity = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::SpGEMM:RAP::Symbolic::Capacity", Kokkos::RangePolicy<ExecSpace, ordinal_type>(exec, 0, nrows),
+      SpgemmRapCapacityFunctor<size_type, ordinal_type, RrowmapT, RentriesT, typename AMatrix::row_map_type,
+                               typename AMatrix::index_type, typename PMatrix::row_map_type>(
+          Rrowmap, Rentries, A.graph.row_map, A.graph.entries, P.graph.row_map, ncols, true),
+      Kokkos::Max<ordinal_type>(maxCapacity));
+
+  row_map_type c_rowmap(Kokkos::view_alloc(exec, "row map"), nrows + 1);
+  entries_type c_entries;
+  functor_type countFunctor(nrows, ncols, Rrowmap, Rentries, A.graph.row_map, A.graph.entries, P.graph.row_map,
+                            P.graph.entries, c_rowmap, c_entries, true, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:RAP::Symbolic::Count", spgemm_masked_policy(exec, countFunctor, nrows),
+                       countFunctor);
+  size_type c_nnz = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<ExecSpace>(exec, nrows + 1, c_rowmap, c_nnz);
+  c_entries = entries_type(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "entries"), c_nnz);
+  functor_type fillFunctor(nrows, ncols, Rrowmap, Rentries, A.graph.row_map, A.graph.entries, P.graph.row_map,
+                           P.graph.entries, c_rowmap, c_entries, false, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:RAP::Symbolic::Fill", spgemm_masked_policy(exec, fillFunctor, nrows),
+                       fillFunctor);
+  KokkosSparse::sort_crs_graph(exec, c_rowmap, c_entries, ncols);
+
+  auto sh = handle->get_spgemm_handle();
+  sh->set_c_nnz(c_nnz);
+  sh->set_max_result_nnz(KokkosSparse::Impl::graph_max_degree(exec, c_rowmap));
+  sh->set_call_symbolic();
+  sh->set_call_numeric(false);
+
+  values_type c_values(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), c_nnz);
+  C = CMatrix("Ac=RAP", nrows, ncols, c_nnz, c_values, c_rowmap, c_entries);
+}
+
+template <typename ExecSpace, typename KernelHandle, typename RMatrix, typename AMatrix, typename PMatrix,
+          typename CMatrix>
+void spgemm_rap_symbolic_impl(const ExecSpace& exec, KernelHandle* handle, const RMatrix& R, const AMatrix& A,
+                              const PMatrix& P, CMatrix& C) {
+  spgemm_rap_check("spgemm_rap_symbolic", R, A, P);
+  spgemm_rap_symbolic_impl(exec, handle, R.numRows(), R.graph.row_map, R.graph.entries, A, P, C);
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename PMatrix, typename CMatrix>
+void spgemm_ptap_symbolic_impl(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const PMatrix& P,
+                               CMatrix& C) {
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using row_map_type = typename PMatrix::row_map_type::non_const_type;
+  using entries_type = typename PMatrix::index_type::non_const_type;
+
+  spgemm_ptap_check("spgemm_ptap_symbolic", A, P);
+  // the graph of P^T, only for symbolic
+  row_map_type Ptrowmap(Kokkos::view_alloc(exec, "P^T rowmap"), P.numCols() + 1);
+  entries_type Ptentries(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "P^T entries"), P.nnz());
+  KokkosSparse::Impl::transpose_graph<typename PMatrix::row_map_type, typename PMatrix::index_type, row_map_type,
+                                      entries_type, row_map_type, ExecSpace>(
+      exec, P.numRows(), P.numCols(), P.graph.row_map, P.graph.entries, Ptrowmap, Ptentries);
+  spgemm_rap_symbolic_impl(exec, handle, ordinal_type(P.numCols()), Ptrowmap, Ptentries, A, P, C);
+}
+
+template <typename ExecSpace, typename KernelHandle, typename RMatrix, typename AMatrix, typename PMatrix,
+          typename CMatrix>
+void spgemm_rap_numeric_impl(const ExecSpace& exec, KernelHandle* handle, const RMatrix& R, const AMatrix& A,
+                             const PMatrix& P, CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using functor_type = SpgemmRapNumericFunctor<ExecSpace, size_type, ordinal_type, RMatrix, AMatrix, PMatrix, CMatrix>;
+
+  spgemm_rap_check("spgemm_rap_numeric", R, A, P);
+  const ordinal_type maxCapacity = KokkosSparse::Impl::graph_max_degree(exec, C.graph.row_map);
+  functor_type numericFunctor(R, A, P, C, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:RAP::Numeric", spgemm_masked_policy(exec, numericFunctor, C.numRows()),
+                       numericFunctor);
+  handle->get_spgemm_handle()->set_call_numeric();
+}
+
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename PMatrix, typename CMatrix>
+void spgemm_ptap_numeric_impl(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const PMatrix& P,
+                              CMatrix& C) {
+  using size_type    = typename CMatrix::size_type;
+  using ordinal_type = typename CMatrix::ordinal_type;
+  using functor_type = SpgemmPtapNumericFunctor<ExecSpace, size_type, ordinal_type, AMatrix, PMatrix, CMatrix>;
+
+  spgemm_ptap_check("spgemm_ptap_numeric", A, P);
+  const ordinal_type nrows = A.numRows();
+  ordinal_type maxCapacity = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::SpGEMM:PtAP::Numeric::Capacity", Kokkos::RangePolicy<ExecSpace, ordinal_type>(exec, 0, nrows),
+      SpgemmRapCapacityFunctor<size_type, ordinal_type, typename AMatrix::row_map_type, typename AMatrix::index_type,
+                               typename AMatrix::row_map_type, typename AMatrix::index_type,
+                               typename PMatrix::row_map_type>(A.graph.row_map, A.graph.entries, A.graph.row_map,
+                                                               A.graph.entries, P.graph.row_map, P.numCols(), false),
+      Kokkos::Max<ordinal_type>(maxCapacity));
+  Kokkos::deep_copy(exec, C.values, Kokkos::ArithTraits<typename CMatrix::non_const_value_type>::zero());
+  functor_type numericFunctor(A, P, C, maxCapacity);
+  Kokkos::parallel_for("KokkosSparse::SpGEMM:PtAP::Numeric", spgemm_masked_policy(exec, numericFunctor, nrows),
+                       numericFunctor);
+  handle->get_spgemm_handle()->set_call_numeric();
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
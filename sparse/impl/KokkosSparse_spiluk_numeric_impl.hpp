@@ -437,17 +437,23 @@ struct IlukWrap {
 
     KOKKOS_INLINE_FUNCTION
     void operator()(const member_type &team) const {
-      // Thread-local buffers. Use for Serial (non-team) work
-      scalar_t buff1[Base::BUFF_SIZE];
-      scalar_t buff2[Base::BUFF_SIZE];
-      scalar_t buff3[Base::BUFF_SIZE];
-
       // Team-shared buffer. Use for team work.
       const auto bs = Base::get_block_size();
       typename Base::SBlock shared_buff(team.team_shmem(), bs, bs);
 
       const auto my_team = team.league_rank();
       const auto rowid   = Base::level_idx(my_team + Base::lev_start);  // map to rowid
+      factorize_row(team, my_team, rowid, shared_buff.data());
+    }
+
+    // Factorize row rowid, using row my_team of iw to map its columns to
+    // entries of L and U. iw is left as it was found.
+    KOKKOS_INLINE_FUNCTION
+    void factorize_row(const member_type &team, const lno_t my_team, const lno_t rowid, scalar_t *shared_buff) const {
+      // Thread-local buffers. Use for Serial (non-team) work
+      scalar_t buff1[Base::BUFF_SIZE];
+      scalar_t buff2[Base::BUFF_SIZE];
+      scalar_t buff3[Base::BUFF_SIZE];
 
       // Set active entries in L to zero, store active cols in iw
       // Set L diagonal for this row to identity
@@ -497,8 +503,7 @@ struct IlukWrap {
         typename Base::valtype fact;
         if (BlockEnabled) {
           fact = Base::lcopy(k, &buff1[0]);  // fact = copy(Lval(k))
-          Base::divide(team, Base::lget(k), udiag,
-                       shared_buff.data());  // Lval(k) *= udiag^-1
+          Base::divide(team, Base::lget(k), udiag, shared_buff);  // Lval(k) *= udiag^-1
         } else {
           Base::divide(team, Base::lget(k), udiag, nullptr);
           fact = Base::lget(k);  // fact = Lval(k) / udiag
@@ -551,10 +556,69 @@ struct IlukWrap {
     }
   };
 
+  /**
+   * Factorizes rows [lev_start, lev_start + lev_nrows) of level_idx, with
+   * rows_per_team consecutive ones per team. Used for long levels, and, with a
+   * single team and all the rows of a chain of levels, to factorize the chain
+   * in one launch: level_idx lists the rows level by level, so a team going
+   * through them in order only meets rows whose dependencies are done.
+   */
+  template <class ARowMapType, class AEntriesType, class AValuesType, class LRowMapType, class LEntriesType,
+            class LValuesType, class URowMapType, class UEntriesType, class UValuesType, bool BlockEnabled>
+  struct ILUKLvlSchedTP1RowBlockNumericFunctor
+      : public ILUKLvlSchedTP1NumericFunctor<ARowMapType, AEntriesType, AValuesType, LRowMapType, LEntriesType,
+                                             LValuesType, URowMapType, UEntriesType, UValuesType, BlockEnabled> {
+    using Base = ILUKLvlSchedTP1NumericFunctor<ARowMapType, AEntriesType, AValuesType, LRowMapType, LEntriesType,
+                                               LValuesType, URowMapType, UEntriesType, UValuesType, BlockEnabled>;
+
+    lno_t lev_nrows;
+    lno_t rows_per_team;
+
+    ILUKLvlSchedTP1RowBlockNumericFunctor(const ARowMapType &A_row_map_, const AEntriesType &A_entries_,
+                                          const AValuesType &A_values_, const LRowMapType &L_row_map_,
+                                          const LEntriesType &L_entries_, LValuesType &L_values_,
+                                          const URowMapType &U_row_map_, const UEntriesType &U_entries_,
+                                          UValuesType &U_values_, const LevelViewType &level_idx_, WorkViewType &iw_,
+                                          const lno_t &lev_start_, const lno_t &lev_nrows_,
+                                          const lno_t &rows_per_team_, const size_type &block_size_ = 0)
+        : Base(A_row_map_, A_entries_, A_values_, L_row_map_, L_entries_, L_values_, U_row_map_, U_entries_, U_values_,
+               level_idx_, iw_, lev_start_, block_size_),
+          lev_nrows(lev_nrows_),
+          rows_per_team(rows_per_team_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type &team) const {
+      // Team-shared buffer. Use for team work.
+      const auto bs = Base::get_block_size();
+      typename Base::SBlock shared_buff(team.team_shmem(), bs, bs);
+
+      const lno_t my_team = team.league_rank();
+      const lno_t first   = my_team * rows_per_team;
+      const lno_t last    = Kokkos::min(first + rows_per_team, lev_nrows);
+      for (lno_t i = first; i < last; ++i) {
+        Base::factorize_row(team, my_team, Base::level_idx(Base::lev_start + i), shared_buff.data());
+        // iw must be reset by all threads before it is filled for the next row
+        team.team_barrier();
+      }
+    }
+  };
+
 #define FunctorTypeMacro(Functor, BlockEnabled)                                                                      \
   Functor<ARowMapType, AEntriesType, AValuesType, LRowMapType, LEntriesType, LValuesType, URowMapType, UEntriesType, \
           UValuesType, BlockEnabled>
 
+#define RowBlockKernelLaunchMacro(arow, aent, aval, lrow, lent, lval, urow, uent, uval, polc, name, lidx, iwv, lstrt, \
+                                  lnrows, rpt, ftf, ftb, be, bs)                                                      \
+  if (be) {                                                                                                           \
+    ftb functor(arow, aent, aval, lrow, lent, lval, urow, uent, uval, lidx, iwv, lstrt, lnrows, rpt, bs);             \
+    const int scratch_size = ftb::SBlock::shmem_size(bs, bs);                                                         \
+    polc                   = polc.set_scratch_size(0, Kokkos::PerTeam(scratch_size));                                 \
+    Kokkos::parallel_for(name, polc, functor);                                                                        \
+  } else {                                                                                                            \
+    ftf functor(arow, aent, aval, lrow, lent, lval, urow, uent, uval, lidx, iwv, lstrt, lnrows, rpt);                 \
+    Kokkos::parallel_for(name, polc, functor);                                                                        \
+  }
+
 #define KernelLaunchMacro(arow, aent, aval, lrow, lent, lval, urow, uent, uval, polc, name, lidx, iwv, lstrt, ftf, \
                           ftb, be, bs)                                                                             \
   if (be) {                                                                                                        \
@@ -575,11 +639,16 @@ struct IlukWrap {
                            UValuesType &U_values) {
     using TPF = FunctorTypeMacro(ILUKLvlSchedTP1NumericFunctor, false);
     using TPB = FunctorTypeMacro(ILUKLvlSchedTP1NumericFunctor, true);
+    using RBF = FunctorTypeMacro(ILUKLvlSchedTP1RowBlockNumericFunctor, false);
+    using RBB = FunctorTypeMacro(ILUKLvlSchedTP1RowBlockNumericFunctor, true);
 
-    size_type nlevels        = thandle.get_num_levels();
-    int team_size            = thandle.get_team_size();
-    const auto block_size    = thandle.get_block_size();
-    const auto block_enabled = thandle.is_block_enabled();
+    size_type nlevels         = thandle.get_num_levels();
+    int team_size             = thandle.get_team_size();
+    const auto block_size     = thandle.get_block_size();
+    const auto block_enabled  = thandle.is_block_enabled();
+    const lno_t rows_per_team = thandle.get_rows_per_team();
+
+    const bool chained = thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN;
 
     LevelHostViewType level_ptr_h = thandle.get_host_level_ptr();
     LevelViewType level_idx       = thandle.get_level_idx();
@@ -591,9 +660,28 @@ struct IlukWrap {
     level_nrowsperchunk_h = thandle.get_level_nrowsperchunk();
     iw                    = thandle.get_iw();
 
-    // Main loop must be performed sequential. Question: Try out Cuda's graph
-    // stuff to reduce kernel launch overhead
-    for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+    // With SEQLVLSCHD_TP1CHAIN, chain c covers levels
+    // [h_chain_ptr(c), h_chain_ptr(c+1)); otherwise each level is its own chain
+    LevelHostViewType h_chain_ptr = thandle.get_host_chain_ptr();
+    const size_type nchains       = chained ? thandle.get_num_chain_entries() : nlevels;
+
+    // Main loop must be performed sequential. Launches go to the same
+    // execution space instance, so they need no fence in between.
+    for (size_type chain = 0; chain < nchains; ++chain) {
+      const size_type lvl           = chained ? h_chain_ptr(chain) : chain;
+      const size_type lvl_chain_end = chained ? h_chain_ptr(chain + 1) : chain + 1;
+
+      if (lvl_chain_end - lvl > 1) {
+        // Chain of small levels: one team factorizes all of their rows
+        const lno_t chain_start = level_ptr_h(lvl);
+        const lno_t chain_nrows = level_ptr_h(lvl_chain_end) - chain_start;
+        team_policy tpolicy     = get_team_policy(1, team_size);
+        RowBlockKernelLaunchMacro(A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
+                                  U_values, tpolicy, "parfor_tp1_chain", level_idx, iw, chain_start, chain_nrows,
+                                  chain_nrows, RBF, RBB, block_enabled, block_size);
+        continue;
+      }
+
       lno_t lev_start = level_ptr_h(lvl);
       lno_t lev_end   = level_ptr_h(lvl + 1);
 
@@ -606,15 +694,24 @@ struct IlukWrap {
           else
             lvl_nrows_chunk = level_nrowsperchunk_h(lvl);
 
-          team_policy tpolicy = get_team_policy(lvl_nrows_chunk, team_size);
-          KernelLaunchMacro(A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
-                            U_values, tpolicy, "parfor_tp1", level_idx, iw, lev_start + lvl_rowid_start, TPF, TPB,
-                            block_enabled, block_size);
-          Kokkos::fence();
+          if (rows_per_team > 1 && lvl_nrows_chunk > rows_per_team) {
+            const lno_t nteams  = (lvl_nrows_chunk + rows_per_team - 1) / rows_per_team;
+            team_policy tpolicy = get_team_policy(nteams, team_size);
+            RowBlockKernelLaunchMacro(A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map,
+                                      U_entries, U_values, tpolicy, "parfor_tp1_rowblock", level_idx, iw,
+                                      lev_start + lvl_rowid_start, lvl_nrows_chunk, rows_per_team, RBF, RBB,
+                                      block_enabled, block_size);
+          } else {
+            team_policy tpolicy = get_team_policy(lvl_nrows_chunk, team_size);
+            KernelLaunchMacro(A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
+                              U_values, tpolicy, "parfor_tp1", level_idx, iw, lev_start + lvl_rowid_start, TPF, TPB,
+                              block_enabled, block_size);
+          }
           lvl_rowid_start += lvl_nrows_chunk;
         }
       }  // end if
-    }    // end for lvl
+    }    // end for chain
+    Kokkos::fence();
 
 // Output check
 #ifdef NUMERIC_OUTPUT_INFO
@@ -768,5 +865,6 @@ struct IlukWrap {
 
 #undef FunctorTypeMacro
 #undef KernelLaunchMacro
+#undef RowBlockKernelLaunchMacro
 
 #endif
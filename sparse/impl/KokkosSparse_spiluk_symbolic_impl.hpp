@@ -180,6 +180,31 @@ void level_sched_tp(IlukHandle& thandle, const RowMapType row_map, const Entries
   thandle.set_level_maxrowsperchunk(maxrowsperchunk);
 }
 
+// SEQLVLSCHD_TP1CHAIN: group consecutive levels with at most chain_threshold
+// rows each into chains, so the numeric phase launches one kernel per chain.
+// Chain c covers levels [h_chain_ptr(c), h_chain_ptr(c+1)).
+template <class IlukHandle, class LevelType, class size_type>
+void level_chain(IlukHandle& thandle, const LevelType& level_ptr, const size_type nlevels) {
+  using nnz_lno_t = typename IlukHandle::nnz_lno_t;
+
+  const nnz_lno_t threshold = thandle.get_chain_threshold();
+  thandle.alloc_host_chain_ptr(nlevels);
+  auto h_chain_ptr = thandle.get_host_chain_ptr();
+
+  size_type nchains = 0;
+  bool prev_small   = false;
+  h_chain_ptr(0)    = 0;
+  for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+    const bool small = static_cast<nnz_lno_t>(level_ptr(lvl + 1) - level_ptr(lvl)) <= threshold;
+    // A level joins the current chain only if both are small
+    if (!(small && prev_small)) nchains++;
+    h_chain_ptr(nchains) = lvl + 1;
+    prev_small           = small;
+  }
+
+  thandle.set_num_chain_entries(nchains);
+}
+
 // Linear Search for the smallest row index
 template <class size_type, class nnz_lno_t, class ViewType>
 size_type search_col_index(nnz_lno_t j, size_type lenl, ViewType h_iL, ViewType h_llev, ViewType h_iw) {
@@ -214,7 +239,8 @@ template <class IlukHandle, class ARowMapType, class AEntriesType, class LRowMap
 void iluk_symbolic(IlukHandle& thandle, const typename IlukHandle::const_nnz_lno_t& fill_lev,
                    const ARowMapType& A_row_map_d, const AEntriesType& A_entries_d, LRowMapType& L_row_map_d,
                    LEntriesType& L_entries_d, URowMapType& U_row_map_d, UEntriesType& U_entries_d, int nstreams = 1) {
-  if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1)
+  if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1 ||
+      thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN)
   /*   || thandle.get_algorithm() ==
      KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHED_TP2 )*/
   {
@@ -398,9 +424,12 @@ void iluk_symbolic(IlukHandle& thandle, const typename IlukHandle::const_nnz_lno
         U_row_map, U_entries);
 
     // Level scheduling on L
-    if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1) {
+    if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1 ||
+        thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN) {
       level_sched_tp(thandle, L_row_map, L_entries, level_list, level_ptr, level_idx, nlev, nstreams);
       thandle.alloc_iw(thandle.get_level_maxrowsperchunk(), nrows);
+      if (thandle.get_algorithm() == KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN)
+        level_chain(thandle, level_ptr, nlev);
     } else {
       level_sched(thandle, L_row_map, L_entries, level_list, level_ptr, level_idx, nlev);
       thandle.alloc_iw(thandle.get_level_maxrows(), nrows);
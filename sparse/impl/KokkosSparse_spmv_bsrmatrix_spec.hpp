@@ -125,7 +125,7 @@ struct SPMV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, false,
     const bool modeIsTrans          = (mode[0] == Transpose[0]);
 
     // use V41 if requested
-    if (handle->algo == SPMV_BSR_V41) {
+    if (handle->get_algorithm() == SPMV_BSR_V41) {
       if (modeIsNoTrans || modeIsConjugate) {
         return Bsr::spMatVec_no_transpose(space, handle, alpha, A, X, beta, Y, modeIsConjugate);
       } else if (modeIsTrans || modeIsConjugateTrans) {
@@ -134,7 +134,7 @@ struct SPMV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, false,
     }
 
     // use V42 if possible
-    if (KokkosKernels::Impl::is_gpu_exec_space_v<ExecutionSpace> || handle->algo == SPMV_BSR_V42) {
+    if (KokkosKernels::Impl::is_gpu_exec_space_v<ExecutionSpace> || handle->get_algorithm() == SPMV_BSR_V42) {
       if (modeIsNoTrans) {
         ::KokkosSparse::Impl::apply_v42(space, alpha, A, X, beta, Y);
         return;
@@ -174,7 +174,7 @@ struct SPMV_MV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, fals
     Method method = Method::Fallback;
     {
       // try to use tensor cores if requested
-      if (handle->algo == SPMV_BSR_TC) method = Method::TensorCores;
+      if (handle->get_algorithm() == SPMV_BSR_TC) method = Method::TensorCores;
       if (!KokkosSparse::Impl::TensorCoresAvailable<ExecutionSpace, AMatrix, XVector, YVector>::value) {
         method = Method::Fallback;
       }
@@ -249,7 +249,7 @@ struct SPMV_MV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, fals
     const bool modeIsTrans          = (mode[0] == Transpose[0]);
 
     // use V41 if requested
-    if (handle->algo == SPMV_BSR_V41) {
+    if (handle->get_algorithm() == SPMV_BSR_V41) {
       if (modeIsNoTrans || modeIsConjugate) {
         return Bsr::spMatMultiVec_no_transpose(space, handle, alpha, A, X, beta, Y, modeIsConjugate);
       } else if (modeIsTrans || modeIsConjugateTrans) {
@@ -258,7 +258,7 @@ struct SPMV_MV_BSRMATRIX<ExecutionSpace, Handle, AMatrix, XVector, YVector, fals
     }
 
     // use V42 if possible
-    if (KokkosKernels::Impl::is_gpu_exec_space_v<ExecutionSpace> || handle->algo == SPMV_BSR_V42) {
+    if (KokkosKernels::Impl::is_gpu_exec_space_v<ExecutionSpace> || handle->get_algorithm() == SPMV_BSR_V42) {
       if (modeIsNoTrans) {
         ::KokkosSparse::Impl::apply_v42(space, alpha, A, X, beta, Y);
         return;
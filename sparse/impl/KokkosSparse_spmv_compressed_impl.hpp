@@ -0,0 +1,239 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_COMPRESSED_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_COMPRESSED_IMPL_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_handle.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Fill the compressed copy of A for one block of rows per work item: the
+// smallest column of the block is its base, and each entry stores its offset
+// from the base in 16 bits unless the block spans more than 2^16 columns.
+// The values are rounded to StorageView's type. Counts the wide blocks.
+template <class AMatrix, class StorageView, class Data>
+struct SPMV_Compressed_Build_Functor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using storage_type = typename StorageView::non_const_value_type;
+
+  static constexpr int block_rows = Data::block_rows;
+
+  AMatrix A;
+  StorageView values;
+  decltype(Data::col_offsets) col_offsets;
+  decltype(Data::block_base) block_base;
+  decltype(Data::block_wide) block_wide;
+
+  SPMV_Compressed_Build_Functor(const AMatrix& A_, const StorageView& values_, const Data& data_)
+      : A(A_),
+        values(values_),
+        col_offsets(data_.col_offsets),
+        block_base(data_.block_base),
+        block_wide(data_.block_wide) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type b, ordinal_type& numWide) const {
+    const ordinal_type rowBegin = b * block_rows;
+    const ordinal_type rowEnd   = Kokkos::min(rowBegin + block_rows, A.numRows());
+    const size_type begin       = A.graph.row_map(rowBegin);
+    const size_type end         = A.graph.row_map(rowEnd);
+    ordinal_type minCol = 0, maxCol = 0;
+    if (begin < end) minCol = maxCol = A.graph.entries(begin);
+    for (size_type k = begin; k < end; k++) {
+      minCol = Kokkos::min(minCol, A.graph.entries(k));
+      maxCol = Kokkos::max(maxCol, A.graph.entries(k));
+    }
+    const bool wide = int64_t(maxCol) - int64_t(minCol) > int64_t(UINT16_MAX);
+    block_base(b)   = minCol;
+    block_wide(b)   = wide;
+    if (wide) numWide++;
+    for (size_type k = begin; k < end; k++) {
+      col_offsets(k) = wide ? uint16_t(0) : uint16_t(A.graph.entries(k) - minCol);
+      values(k)      = storage_type(A.values(k));
+    }
+  }
+};
+
+// y := beta*y + alpha*A*x with the compressed copy of A. Products and row sums
+// are computed in double, whatever the storage type of the values.
+template <class execution_space, class AMatrix, class StorageView, class Data, class XVector, class YVector>
+struct SPMV_Compressed_Functor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using accum_type   = double;
+  using team_member  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+
+  static constexpr int block_rows = Data::block_rows;
+
+  const y_value_type alpha;
+  AMatrix m_A;
+  StorageView values;
+  decltype(Data::col_offsets) col_offsets;
+  decltype(Data::block_base) block_base;
+  decltype(Data::block_wide) block_wide;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+  const int64_t rows_per_team;
+
+  SPMV_Compressed_Functor(const y_value_type alpha_, const AMatrix& m_A_, const StorageView& values_,
+                          const Data& data_, const XVector& m_x_, const y_value_type beta_, const YVector& m_y_,
+                          const int64_t rows_per_team_)
+      : alpha(alpha_),
+        m_A(m_A_),
+        values(values_),
+        col_offsets(data_.col_offsets),
+        block_base(data_.block_base),
+        block_wide(data_.block_wide),
+        m_x(m_x_),
+        beta(beta_),
+        m_y(m_y_),
+        rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION accum_type product(const size_type k, const ordinal_type base, const bool wide) const {
+    const ordinal_type col = wide ? m_A.graph.entries(k) : ordinal_type(base + col_offsets(k));
+    return static_cast<accum_type>(values(k)) * static_cast<accum_type>(m_x(col));
+  }
+
+  KOKKOS_INLINE_FUNCTION void update(const ordinal_type iRow, const accum_type sum) const {
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      m_y(iRow) = y_value_type(alpha * sum);
+    else
+      m_y(iRow) = y_value_type(beta * m_y(iRow) + alpha * sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type iRow) const {
+    const ordinal_type b    = iRow / block_rows;
+    const ordinal_type base = block_base(b);
+    const bool wide         = block_wide(b);
+    const size_type end     = m_A.graph.row_map(iRow + 1);
+    accum_type sum          = 0;
+    for (size_type k = m_A.graph.row_map(iRow); k < end; k++) sum += product(k, base, wide);
+    update(iRow, sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const int64_t loop) {
+      const int64_t iRow = static_cast<int64_t>(dev.league_rank()) * rows_per_team + loop;
+      if (iRow >= m_A.numRows()) return;
+      const ordinal_type b    = iRow / block_rows;
+      const ordinal_type base = block_base(b);
+      const bool wide         = block_wide(b);
+      accum_type sum          = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(dev, m_A.graph.row_map(iRow), m_A.graph.row_map(iRow + 1)),
+          [&](const size_type k, accum_type& lsum) { lsum += product(k, base, wide); }, sum);
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { update(iRow, sum); });
+    });
+  }
+};
+
+/// Whether the nonzero values of A are within the range of half_t: none is
+/// larger than the largest finite half_t, and none rounds to zero.
+template <class execution_space, class AMatrix>
+bool spmv_compressed_fits_fp16(const execution_space& exec, const AMatrix& A) {
+  using size_type = typename AMatrix::non_const_size_type;
+  // 65504 is the largest finite half_t, and values below half of the smallest
+  // subnormal half_t (2^-24) round to zero
+  const double maxHalf = 65504.0, minHalf = 0x1p-25;
+  auto values          = A.values;
+  Kokkos::MinMaxScalar<double> range;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::spmv_compressed::range", Kokkos::RangePolicy<execution_space, size_type>(exec, 0, A.nnz()),
+      KOKKOS_LAMBDA(const size_type k, Kokkos::MinMaxScalar<double>& lrange) {
+        const double a = Kokkos::abs(static_cast<double>(values(k)));
+        if (a == 0.0) return;
+        if (a < lrange.min_val) lrange.min_val = a;
+        if (a > lrange.max_val) lrange.max_val = a;
+      },
+      Kokkos::MinMax<double>(range));
+  return range.max_val <= maxHalf && range.min_val >= minHalf;
+}
+
+/// Build the compressed copy of A in the handle (values rounded to
+/// StorageType), unless it was already built.
+template <class StorageType, class execution_space, class HandleImpl, class AMatrix>
+void spmv_compressed_build(const execution_space& exec, HandleImpl* handle, const AMatrix& A) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  auto& data         = handle->compressed;
+  if (data.built) return;
+  using data_type              = std::remove_reference_t<decltype(data)>;
+  const ordinal_type numBlocks = (A.numRows() + data_type::block_rows - 1) / data_type::block_rows;
+  const auto nnz               = A.nnz();
+  auto alloc = [&](const std::string& label) { return Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, label); };
+
+  data.col_offsets     = decltype(data.col_offsets)(alloc("SPMV compressed col offsets"), nnz);
+  data.block_base      = decltype(data.block_base)(alloc("SPMV compressed block base"), numBlocks);
+  data.block_wide      = decltype(data.block_wide)(alloc("SPMV compressed block wide"), numBlocks);
+  ordinal_type numWide = 0;
+  if constexpr (std::is_same_v<StorageType, float>) {
+    data.values_fp32 = decltype(data.values_fp32)(alloc("SPMV compressed values"), nnz);
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spmv_compressed::build<float>", Kokkos::RangePolicy<execution_space>(exec, 0, numBlocks),
+        SPMV_Compressed_Build_Functor<AMatrix, decltype(data.values_fp32), data_type>(A, data.values_fp32, data),
+        numWide);
+  } else {
+    data.values_fp16 = decltype(data.values_fp16)(alloc("SPMV compressed values"), nnz);
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spmv_compressed::build<half>", Kokkos::RangePolicy<execution_space>(exec, 0, numBlocks),
+        SPMV_Compressed_Build_Functor<AMatrix, decltype(data.values_fp16), data_type>(A, data.values_fp16, data),
+        numWide);
+  }
+  data.num_wide_blocks = numWide;
+  data.built           = true;
+}
+
+/// y := beta*y + alpha*A*x for SPMV_COMPRESSED_FP32 or SPMV_COMPRESSED_FP16,
+/// with rank-1 x and y. The compressed copy of A is built on the first call.
+template <class execution_space, class HandleImpl, class AMatrix, class XVector, class YVector>
+void spmv_compressed(const execution_space& exec, HandleImpl* handle, typename YVector::const_value_type& alpha,
+                     const AMatrix& A, const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  using data_type = decltype(handle->compressed);
+  data_type& data = handle->compressed;
+  if (!data.built)
+    data.use_fp32 = handle->get_algorithm() == SPMV_COMPRESSED_FP32 || !spmv_compressed_fits_fp16(exec, A);
+  const bool fp32 = data.use_fp32;
+  if (fp32)
+    spmv_compressed_build<float>(exec, handle, A);
+  else
+    spmv_compressed_build<Kokkos::Experimental::half_t>(exec, handle, A);
+
+  auto launch = [&](const auto& values, const char* label) {
+    using functor_type =
+        SPMV_Compressed_Functor<execution_space, AMatrix, std::decay_t<decltype(values)>, data_type, XVector, YVector>;
+    spmv_fused_launch(exec, label, A, [&](const int64_t rows_per_team) {
+      return functor_type(alpha, A, values, data, x, beta, y, rows_per_team);
+    });
+  };
+  if (fp32)
+    launch(data.values_fp32, "KokkosSparse::spmv_compressed<float>");
+  else
+    launch(data.values_fp16, "KokkosSparse::spmv_compressed<half>");
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_COMPRESSED_IMPL_HPP_
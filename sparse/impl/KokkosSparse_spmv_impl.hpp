@@ -164,6 +164,154 @@ struct SPMV_Functor {
   }
 };
 
+// y := alpha*Op(A)*x, fused with the reduction dots = [<x, y>, <y, y>], where
+// <a, b> = sum_i conj(a_i)*b_i and Op(A) = A or conj(A) is square. Each entry
+// of y is reduced while it is still in registers, and x(iRow) was just loaded
+// with the row, which saves the two passes over x and y of KokkosBlas::dot.
+template <class execution_space, class AMatrix, class XVector, class YVector, bool conjugate>
+struct SPMV_Dot_Functor : public SPMV_Functor<execution_space, AMatrix, XVector, YVector, 0, conjugate> {
+  typedef SPMV_Functor<execution_space, AMatrix, XVector, YVector, 0, conjugate> base_type;
+  typedef typename base_type::ordinal_type ordinal_type;
+  typedef typename base_type::team_member team_member;
+  typedef typename base_type::ATV ATV;
+  typedef typename YVector::non_const_value_type y_value_type;
+  typedef Kokkos::ArithTraits<y_value_type> ATY;
+
+  typedef y_value_type value_type[];
+  ordinal_type value_count;  // Kokkos needs this for reductions w/ array results
+
+  SPMV_Dot_Functor(const y_value_type alpha_, const AMatrix m_A_, const XVector m_x_, const YVector m_y_,
+                   const int rows_per_team_)
+      : base_type(alpha_, m_A_, m_x_, ATY::zero(), m_y_, rows_per_team_), value_count(2) {}
+
+  KOKKOS_INLINE_FUNCTION void init(value_type dots) const {
+    for (ordinal_type j = 0; j < value_count; ++j) dots[j] = ATY::zero();
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+    for (ordinal_type j = 0; j < value_count; ++j) dst[j] += src[j];
+  }
+
+  KOKKOS_INLINE_FUNCTION void update(const ordinal_type iRow, const y_value_type& sum, value_type dots) const {
+    const y_value_type yi = this->alpha * sum;
+    this->m_y(iRow)       = yi;
+    dots[0] += ATY::conj(this->m_x(iRow)) * yi;
+    dots[1] += ATY::conj(yi) * yi;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iRow, value_type dots) const {
+    if (iRow >= this->m_A.numRows()) {
+      return;
+    }
+    const KokkosSparse::SparseRowViewConst<AMatrix> row = this->m_A.rowConst(iRow);
+    const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
+    y_value_type sum                                    = 0;
+
+    for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
+      const auto val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+      sum += val * this->m_x(row.colidx(iEntry));
+    }
+    update(iRow, sum, dots);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev, value_type dots) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, this->rows_per_team), [&](const ordinal_type& loop) {
+      const ordinal_type iRow = static_cast<ordinal_type>(dev.league_rank()) * this->rows_per_team + loop;
+      if (iRow >= this->m_A.numRows()) {
+        return;
+      }
+      const KokkosSparse::SparseRowViewConst<AMatrix> row = this->m_A.rowConst(iRow);
+      const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
+      y_value_type sum                                    = 0;
+
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(dev, row_length),
+          [&](const ordinal_type& iEntry, y_value_type& lsum) {
+            const auto val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+            lsum += val * this->m_x(row.colidx(iEntry));
+          },
+          sum);
+
+      // Each thread contributes once to the team's reduction
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { update(iRow, sum, dots); });
+    });
+  }
+};
+
+// y := alpha*Op(A)*x, followed by z := b*z + a*y in the same pass, while the
+// entry of y is still in registers. b == 0 overwrites z, even if it contains
+// NaN.
+template <class execution_space, class AMatrix, class XVector, class YVector, class ZVector, bool conjugate>
+struct SPMV_Axpby_Functor : public SPMV_Functor<execution_space, AMatrix, XVector, YVector, 0, conjugate> {
+  typedef SPMV_Functor<execution_space, AMatrix, XVector, YVector, 0, conjugate> base_type;
+  typedef typename base_type::ordinal_type ordinal_type;
+  typedef typename base_type::team_member team_member;
+  typedef typename base_type::ATV ATV;
+  typedef typename YVector::non_const_value_type y_value_type;
+  typedef typename ZVector::non_const_value_type z_value_type;
+
+  const z_value_type a;
+  const z_value_type b;
+  ZVector m_z;
+
+  SPMV_Axpby_Functor(const y_value_type alpha_, const AMatrix m_A_, const XVector m_x_, const YVector m_y_,
+                     const z_value_type a_, const z_value_type b_, const ZVector m_z_, const int rows_per_team_)
+      : base_type(alpha_, m_A_, m_x_, Kokkos::ArithTraits<y_value_type>::zero(), m_y_, rows_per_team_),
+        a(a_),
+        b(b_),
+        m_z(m_z_) {}
+
+  KOKKOS_INLINE_FUNCTION void update(const ordinal_type iRow, const y_value_type& sum) const {
+    const y_value_type yi = this->alpha * sum;
+    this->m_y(iRow)       = yi;
+    if (b == Kokkos::ArithTraits<z_value_type>::zero())
+      m_z(iRow) = a * yi;
+    else
+      m_z(iRow) = b * m_z(iRow) + a * yi;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iRow) const {
+    if (iRow >= this->m_A.numRows()) {
+      return;
+    }
+    const KokkosSparse::SparseRowViewConst<AMatrix> row = this->m_A.rowConst(iRow);
+    const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
+    y_value_type sum                                    = 0;
+
+    for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
+      const auto val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+      sum += val * this->m_x(row.colidx(iEntry));
+    }
+    update(iRow, sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, this->rows_per_team), [&](const ordinal_type& loop) {
+      const ordinal_type iRow = static_cast<ordinal_type>(dev.league_rank()) * this->rows_per_team + loop;
+      if (iRow >= this->m_A.numRows()) {
+        return;
+      }
+      const KokkosSparse::SparseRowViewConst<AMatrix> row = this->m_A.rowConst(iRow);
+      const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
+      y_value_type sum                                    = 0;
+
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(dev, row_length),
+          [&](const ordinal_type& iEntry, y_value_type& lsum) {
+            const auto val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+            lsum += val * this->m_x(row.colidx(iEntry));
+          },
+          sum);
+
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { update(iRow, sum); });
+    });
+  }
+};
+
 template <class execution_space>
 int64_t spmv_launch_parameters(int64_t numRows, int64_t nnz, int64_t rows_per_thread, int& team_size,
                                int& vector_length) {
@@ -217,6 +365,83 @@ int64_t spmv_launch_parameters(int64_t numRows, int64_t nnz, int64_t rows_per_th
   return rows_per_team;
 }
 
+// Launch a functor derived from SPMV_Functor over the rows of A, with the
+// same policies as spmv_beta_no_transpose: a parallel_for, or a
+// parallel_reduce into result if one is given. makeFunctor(rows_per_team)
+// builds the functor.
+template <class execution_space, class AMatrix, class MakeFunctor, class... Result>
+void spmv_fused_launch(const execution_space& exec, const std::string& label, const AMatrix& A,
+                       const MakeFunctor& makeFunctor, const Result&... result) {
+  if constexpr (KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+    int team_size         = -1;
+    int vector_length     = -1;
+    int64_t rows_per_team = spmv_launch_parameters<execution_space>(A.numRows(), A.nnz(), -1, team_size, vector_length);
+    int64_t worksets      = (A.numRows() + rows_per_team - 1) / rows_per_team;
+    Kokkos::TeamPolicy<execution_space> policy(exec, worksets, team_size, vector_length);
+    if constexpr (sizeof...(Result) == 0)
+      Kokkos::parallel_for(label, policy, makeFunctor(rows_per_team));
+    else
+      Kokkos::parallel_reduce(label, policy, makeFunctor(rows_per_team), result...);
+  } else {
+    const auto func = makeFunctor(1);
+    if (A.nnz() > 10000000) {
+      Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>> policy(exec, 0, A.numRows());
+      if constexpr (sizeof...(Result) == 0)
+        Kokkos::parallel_for(label + "<Dynamic>", policy, func);
+      else
+        Kokkos::parallel_reduce(label + "<Dynamic>", policy, func, result...);
+    } else {
+      Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Static>> policy(exec, 0, A.numRows());
+      if constexpr (sizeof...(Result) == 0)
+        Kokkos::parallel_for(label + "<Static>", policy, func);
+      else
+        Kokkos::parallel_reduce(label + "<Static>", policy, func, result...);
+    }
+  }
+}
+
+/// y := alpha*Op(A)*x and dots := [<x, y>, <y, y>] in one pass, Op(A) = A or
+/// conj(A). dots is a rank-1 view of length 2; if it is not host accessible
+/// the call does not block.
+template <class execution_space, class AMatrix, class XVector, class YVector, class DotsView>
+void spmv_dot(const execution_space& exec, const char mode[], typename YVector::const_value_type& alpha,
+              const AMatrix& A, const XVector& x, const YVector& y, const DotsView& dots) {
+  if (A.numRows() == 0) {
+    Kokkos::deep_copy(exec, dots, Kokkos::ArithTraits<typename DotsView::non_const_value_type>::zero());
+    return;
+  }
+  if (mode[0] == NoTranspose[0]) {
+    using functor_type = SPMV_Dot_Functor<execution_space, AMatrix, XVector, YVector, false>;
+    spmv_fused_launch(
+        exec, "KokkosSparse::spmv_dot<NoTranspose>", A,
+        [&](const int64_t rows_per_team) { return functor_type(alpha, A, x, y, rows_per_team); }, dots);
+  } else {
+    using functor_type = SPMV_Dot_Functor<execution_space, AMatrix, XVector, YVector, true>;
+    spmv_fused_launch(
+        exec, "KokkosSparse::spmv_dot<Conjugate>", A,
+        [&](const int64_t rows_per_team) { return functor_type(alpha, A, x, y, rows_per_team); }, dots);
+  }
+}
+
+/// y := alpha*Op(A)*x and z := b*z + a*y in one pass, Op(A) = A or conj(A).
+template <class execution_space, class AMatrix, class XVector, class YVector, class ZVector>
+void spmv_axpby(const execution_space& exec, const char mode[], typename YVector::const_value_type& alpha,
+                const AMatrix& A, const XVector& x, const YVector& y, typename ZVector::const_value_type& a,
+                typename ZVector::const_value_type& b, const ZVector& z) {
+  if (A.numRows() == 0) return;
+  if (mode[0] == NoTranspose[0]) {
+    using functor_type = SPMV_Axpby_Functor<execution_space, AMatrix, XVector, YVector, ZVector, false>;
+    spmv_fused_launch(exec, "KokkosSparse::spmv_axpby<NoTranspose>", A, [&](const int64_t rows_per_team) {
+      return functor_type(alpha, A, x, y, a, b, z, rows_per_team);
+    });
+  } else {
+    using functor_type = SPMV_Axpby_Functor<execution_space, AMatrix, XVector, YVector, ZVector, true>;
+    spmv_fused_launch(exec, "KokkosSparse::spmv_axpby<Conjugate>", A, [&](const int64_t rows_per_team) {
+      return functor_type(alpha, A, x, y, a, b, z, rows_per_team);
+    });
+  }
+}
+
 // spmv_beta_no_transpose: version for CPU execution spaces (RangePolicy or
 // trivial serial impl used)
 template <class execution_space, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate,
@@ -516,14 +741,14 @@ static void spmv_beta(const execution_space& exec, Handle* handle, const char mo
                       typename YVector::const_value_type& alpha, const AMatrix& A, const XVector& x,
                       typename YVector::const_value_type& beta, const YVector& y) {
   if (mode[0] == NoTranspose[0]) {
-    if (handle->algo == SPMV_MERGE_PATH || handle->algo == SPMV_NATIVE_MERGE_PATH) {
+    if (handle->get_algorithm() == SPMV_MERGE_PATH || handle->get_algorithm() == SPMV_NATIVE_MERGE_PATH) {
       SpmvMergeHierarchical<execution_space, AMatrix, XVector, YVector>::spmv(exec, mode, alpha, A, x, beta, y);
     } else {
       spmv_beta_no_transpose<execution_space, Handle, AMatrix, XVector, YVector, dobeta, false>(exec, handle, alpha, A,
                                                                                                 x, beta, y);
     }
   } else if (mode[0] == Conjugate[0]) {
-    if (handle->algo == SPMV_MERGE_PATH || handle->algo == SPMV_NATIVE_MERGE_PATH) {
+    if (handle->get_algorithm() == SPMV_MERGE_PATH || handle->get_algorithm() == SPMV_NATIVE_MERGE_PATH) {
       SpmvMergeHierarchical<execution_space, AMatrix, XVector, YVector>::spmv(exec, mode, alpha, A, x, beta, y);
     } else {
       spmv_beta_no_transpose<execution_space, Handle, AMatrix, XVector, YVector, dobeta, true>(exec, handle, alpha, A,
@@ -0,0 +1,202 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_IMPL_SPMV_MATRIX_FREE_HPP_
+#define KOKKOSSPARSE_IMPL_SPMV_MATRIX_FREE_HPP_
+
+#include "KokkosSparse_spmv_struct_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// y = beta*y + alpha*A*x for a stencil operator A on a structured grid, with
+// the coefficients of each row computed on the fly by the stencil. As in
+// SPMV_Struct_Functor, the interior points (whose whole stencil is in the
+// grid) are done without bounds checks, and the exterior points (within the
+// halo of the boundary) check each neighbor and skip those outside the grid.
+// Each thread of a team takes rows, and the stencil entries of a row are
+// reduced over the vector lanes.
+template <class execution_space, class Stencil, class ordinal_type, class XVector, class YVector>
+struct SPMV_MatrixFree_Functor {
+  using value_type   = typename Stencil::value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using team_member  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+
+  struct interiorTag {};
+  struct exteriorTag {};
+
+  const y_value_type alpha;
+  Stencil m_stencil;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+
+  // Grid dimensions, halo widths of the stencil and sizes of the interior
+  const ordinal_type ni, nj, nk;
+  const ordinal_type hi, hj, hk;
+  const ordinal_type ii, ij, ik;
+  const int64_t numInterior, numExterior;
+  // Exterior points are enumerated as the bottom hkExt planes, then the
+  // boundary of each middle plane, then the top hkExt planes
+  const ordinal_type hkExt;
+  const int64_t rows_per_team;
+
+  SPMV_MatrixFree_Functor(const y_value_type alpha_, const Stencil& stencil_, const XVector& x_,
+                          const y_value_type beta_, const YVector& y_, const ordinal_type ni_, const ordinal_type nj_,
+                          const ordinal_type nk_, const ordinal_type hi_, const ordinal_type hj_,
+                          const ordinal_type hk_, const int64_t rows_per_team_)
+      : alpha(alpha_),
+        m_stencil(stencil_),
+        m_x(x_),
+        beta(beta_),
+        m_y(y_),
+        ni(ni_),
+        nj(nj_),
+        nk(nk_),
+        hi(hi_),
+        hj(hj_),
+        hk(hk_),
+        ii(ni_ > 2 * hi_ ? ni_ - 2 * hi_ : 0),
+        ij(nj_ > 2 * hj_ ? nj_ - 2 * hj_ : 0),
+        ik(nk_ > 2 * hk_ ? nk_ - 2 * hk_ : 0),
+        numInterior(int64_t(ii) * ij * ik),
+        numExterior(int64_t(ni_) * nj_ * nk_ - numInterior),
+        hkExt(numInterior ? hk_ : nk_),
+        rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION void apply_row(const team_member& dev, const ordinal_type i, const ordinal_type j,
+                                        const ordinal_type k, const bool checkBounds) const {
+    const int64_t rowIdx = i + int64_t(ni) * (j + int64_t(nj) * k);
+    y_value_type sum     = Kokkos::ArithTraits<y_value_type>::zero();
+    Kokkos::parallel_reduce(
+        Kokkos::ThreadVectorRange(dev, Stencil::num_entries),
+        [&](const int e, y_value_type& lclSum) {
+          int di = 0, dj = 0, dk = 0;
+          m_stencil.offset(e, di, dj, dk);
+          if (checkBounds && (i + di < 0 || i + di >= ni || j + dj < 0 || j + dj >= nj || k + dk < 0 || k + dk >= nk))
+            return;
+          lclSum += m_stencil.coefficient(i, j, k, e) * m_x(rowIdx + di + int64_t(ni) * (dj + int64_t(nj) * dk));
+        },
+        sum);
+    Kokkos::single(Kokkos::PerThread(dev), [&]() {
+      const y_value_type scaled =
+          beta == Kokkos::ArithTraits<y_value_type>::zero() ? beta : y_value_type(beta * m_y(rowIdx));
+      m_y(rowIdx) = scaled + alpha * sum;
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const interiorTag&, const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const int64_t loop) {
+      const int64_t interiorIdx = static_cast<int64_t>(dev.league_rank()) * rows_per_team + loop;
+      if (interiorIdx >= numInterior) return;
+      const ordinal_type i = hi + interiorIdx % ii;
+      const ordinal_type j = hj + (interiorIdx / ii) % ij;
+      const ordinal_type k = hk + interiorIdx / (int64_t(ii) * ij);
+      apply_row(dev, i, j, k, false);
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const exteriorTag&, const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const int64_t loop) {
+      int64_t e = static_cast<int64_t>(dev.league_rank()) * rows_per_team + loop;
+      if (e >= numExterior) return;
+      const int64_t plane = int64_t(ni) * nj;
+      ordinal_type i, j, k;
+      if (e < hkExt * plane) {
+        // bottom planes
+        k = e / plane;
+        j = (e % plane) / ni;
+        i = e % ni;
+      } else if ((e -= hkExt * plane) < ik * (2 * int64_t(hj) * ni + 2 * int64_t(ij) * hi)) {
+        // boundary of a middle plane: hj full rows, ij rows with hi points on
+        // each side, then hj full rows
+        const int64_t perPlane = 2 * int64_t(hj) * ni + 2 * int64_t(ij) * hi;
+        int64_t r              = e % perPlane;
+        k                      = hk + e / perPlane;
+        if (r < int64_t(hj) * ni) {
+          j = r / ni;
+          i = r % ni;
+        } else if ((r -= int64_t(hj) * ni) < 2 * int64_t(ij) * hi) {
+          j                    = hj + r / (2 * hi);
+          const ordinal_type c = r % (2 * hi);
+          i                    = c < hi ? c : ni - 2 * hi + c;
+        } else {
+          r -= 2 * int64_t(ij) * hi;
+          j = nj - hj + r / ni;
+          i = r % ni;
+        }
+      } else {
+        // top planes
+        e -= ik * (2 * int64_t(hj) * ni + 2 * int64_t(ij) * hi);
+        k = nk - hkExt + e / plane;
+        j = (e % plane) / ni;
+        i = e % ni;
+      }
+      apply_row(dev, i, j, k, true);
+    });
+  }
+};
+
+template <class execution_space, class Stencil, class ordinal_type, class XVector, class YVector>
+void spmv_matrix_free(const execution_space& exec, typename YVector::const_value_type& alpha, const Stencil& stencil,
+                      const ordinal_type ni, const ordinal_type nj, const ordinal_type nk, const ordinal_type hi,
+                      const ordinal_type hj, const ordinal_type hk, const XVector& x,
+                      typename YVector::const_value_type& beta, const YVector& y) {
+  using functor_type = SPMV_MatrixFree_Functor<execution_space, Stencil, ordinal_type, XVector, YVector>;
+  const int64_t numRows = int64_t(ni) * nj * nk;
+  if (numRows <= 0) return;
+
+  // Vector lanes for the stencil entries: 2 for 5 or 7 points, 8 for 27, as
+  // in spmv_struct
+  int vector_length = 1;
+  if (KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+    while (vector_length < 8 && 4 * vector_length < Stencil::num_entries) vector_length *= 2;
+  }
+  const int64_t nnz = numRows * Stencil::num_entries;
+  int team_size_int = -1, team_size_ext = -1;
+
+  functor_type probe(alpha, stencil, x, beta, y, ni, nj, nk, hi, hj, hk, 1);
+  const int64_t numInterior = probe.numInterior;
+  const int64_t numExterior = probe.numExterior;
+
+  if (numInterior > 0) {
+    const int64_t rows_per_team = spmv_struct_launch_parameters<execution_space>(
+        numInterior, nnz, Stencil::num_entries, -1, team_size_int, vector_length);
+    const int64_t worksets = (numInterior + rows_per_team - 1) / rows_per_team;
+    functor_type f(alpha, stencil, x, beta, y, ni, nj, nk, hi, hj, hk, rows_per_team);
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_matrix_free<NoTranspose,Static>: interior",
+        Kokkos::TeamPolicy<typename functor_type::interiorTag, execution_space, Kokkos::Schedule<Kokkos::Static> >(
+            exec, worksets, team_size_int, vector_length),
+        f);
+  }
+  if (numExterior > 0) {
+    const int64_t rows_per_team = spmv_struct_launch_parameters<execution_space>(
+        numExterior, nnz, Stencil::num_entries, -1, team_size_ext, vector_length);
+    const int64_t worksets = (numExterior + rows_per_team - 1) / rows_per_team;
+    functor_type f(alpha, stencil, x, beta, y, ni, nj, nk, hi, hj, hk, rows_per_team);
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_matrix_free<NoTranspose,Static>: exterior",
+        Kokkos::TeamPolicy<typename functor_type::exteriorTag, execution_space, Kokkos::Schedule<Kokkos::Static> >(
+            exec, worksets, team_size_ext, vector_length),
+        f);
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_SPMV_MATRIX_FREE_HPP_
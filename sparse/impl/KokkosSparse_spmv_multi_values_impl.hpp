@@ -0,0 +1,236 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_MULTI_VALUES_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_MULTI_VALUES_IMPL_HPP_
+
+#include <algorithm>
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Y(:,l) := beta*Y(:,l) + alpha*Op(A_l)*X(:,l) for l = 0, ..., N-1, where the
+// N matrices A_l share one graph and the values of entry k of A_l are
+// values(k, l). Op(A_l) = A_l or conj(A_l).
+//
+// On CPUs each work item is a row. The row's column indices are read once and
+// the N products of each entry are accumulated in blocks of BlockSize members,
+// contiguous in values, X and Y when they are LayoutRight.
+//
+// On GPUs each thread handles a row and the vector lanes handle the members,
+// so that the lanes share the loads of rowmap and entries.
+template <class execution_space, class RowMap, class Entries, class Values, class XVector, class YVector,
+          bool conjugate>
+struct SPMV_MultiValues_Functor {
+  using ordinal_type = typename Entries::non_const_value_type;
+  using size_type    = typename RowMap::non_const_value_type;
+  using value_type   = typename Values::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+  using team_member  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+
+  static constexpr int BlockSize = 16;
+
+  const y_value_type alpha;
+  RowMap m_rowmap;
+  Entries m_entries;
+  Values m_values;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+  ordinal_type rows_per_team;
+
+  SPMV_MultiValues_Functor(const y_value_type alpha_, const RowMap& m_rowmap_, const Entries& m_entries_,
+                           const Values& m_values_, const XVector& m_x_, const y_value_type beta_, const YVector& m_y_,
+                           const ordinal_type rows_per_team_)
+      : alpha(alpha_),
+        m_rowmap(m_rowmap_),
+        m_entries(m_entries_),
+        m_values(m_values_),
+        m_x(m_x_),
+        beta(beta_),
+        m_y(m_y_),
+        rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION void update(const ordinal_type row, const ordinal_type l, const y_value_type& sum) const {
+    // beta == 0 overwrites y, even if it contains NaN
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      m_y(row, l) = alpha * sum;
+    else
+      m_y(row, l) = beta * m_y(row, l) + alpha * sum;
+  }
+
+  // Host version: one row per work item
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type row) const {
+    const ordinal_type numMembers = m_values.extent(1);
+    const size_type rowBegin      = m_rowmap(row);
+    const size_type rowEnd        = m_rowmap(row + 1);
+    for (ordinal_type l0 = 0; l0 < numMembers; l0 += BlockSize) {
+      const ordinal_type nl = numMembers - l0 < BlockSize ? numMembers - l0 : BlockSize;
+      y_value_type sum[BlockSize];
+      for (ordinal_type l = 0; l < BlockSize; l++) sum[l] = Kokkos::ArithTraits<y_value_type>::zero();
+      for (size_type k = rowBegin; k < rowEnd; k++) {
+        const ordinal_type col = m_entries(k);
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+        for (ordinal_type l = 0; l < nl; l++) {
+          const value_type val = conjugate ? ATV::conj(m_values(k, l0 + l)) : m_values(k, l0 + l);
+          sum[l] += val * m_x(col, l0 + l);
+        }
+      }
+      for (ordinal_type l = 0; l < nl; l++) update(row, l0 + l, sum[l]);
+    }
+  }
+
+  // GPU version: one row per thread, one member per vector lane
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    const ordinal_type numRows    = m_rowmap.extent(0) - 1;
+    const ordinal_type numMembers = m_values.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const ordinal_type loop) {
+      const ordinal_type row = static_cast<ordinal_type>(dev.league_rank()) * rows_per_team + loop;
+      if (row >= numRows) return;
+      const size_type rowBegin = m_rowmap(row);
+      const size_type rowEnd   = m_rowmap(row + 1);
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(dev, numMembers), [&](const ordinal_type l) {
+        y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+        for (size_type k = rowBegin; k < rowEnd; k++) {
+          const value_type val = conjugate ? ATV::conj(m_values(k, l)) : m_values(k, l);
+          sum += val * m_x(m_entries(k), l);
+        }
+        update(row, l, sum);
+      });
+    });
+  }
+};
+
+// Y(:,l) := alpha*Op(A_l)*X(:,l) (accumulated into the already scaled Y),
+// Op(A_l) = A_l^T or A_l^H.
+template <class RowMap, class Entries, class Values, class XVector, class YVector, bool conjugate>
+struct SPMV_MultiValues_Transpose_Functor {
+  using ordinal_type = typename Entries::non_const_value_type;
+  using size_type    = typename RowMap::non_const_value_type;
+  using value_type   = typename Values::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  const y_value_type alpha;
+  RowMap m_rowmap;
+  Entries m_entries;
+  Values m_values;
+  XVector m_x;
+  YVector m_y;
+
+  SPMV_MultiValues_Transpose_Functor(const y_value_type alpha_, const RowMap& m_rowmap_, const Entries& m_entries_,
+                                     const Values& m_values_, const XVector& m_x_, const YVector& m_y_)
+      : alpha(alpha_), m_rowmap(m_rowmap_), m_entries(m_entries_), m_values(m_values_), m_x(m_x_), m_y(m_y_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type row) const {
+    const ordinal_type numMembers = m_values.extent(1);
+    for (size_type k = m_rowmap(row); k < m_rowmap(row + 1); k++) {
+      const ordinal_type col = m_entries(k);
+      for (ordinal_type l = 0; l < numMembers; l++) {
+        const value_type val = conjugate ? ATV::conj(m_values(k, l)) : m_values(k, l);
+        Kokkos::atomic_add(&m_y(col, l), static_cast<y_value_type>(alpha * val * m_x(row, l)));
+      }
+    }
+  }
+};
+
+template <class execution_space, class RowMap, class Entries, class Values, class XVector, class YVector,
+          bool conjugate>
+void spmv_multi_values_no_transpose(const execution_space& exec, typename YVector::const_value_type& alpha,
+                                    const RowMap& rowmap, const Entries& entries, const Values& values,
+                                    const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  using functor_type = SPMV_MultiValues_Functor<execution_space, RowMap, Entries, Values, XVector, YVector, conjugate>;
+  using ordinal_type = typename functor_type::ordinal_type;
+
+  const ordinal_type nrows = rowmap.extent(0) - 1;
+  if constexpr (KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+    using policy_type = Kokkos::TeamPolicy<execution_space>;
+    // Lanes for the members (a power of two, at most the hardware limit) and
+    // enough threads for 256 lanes per team, within the team size recommended
+    // for the functor
+    int vectorLength     = 1;
+    const int maxVector  = policy_type::vector_length_max();
+    const int numMembers = values.extent(1);
+    while (vectorLength < numMembers && vectorLength < maxVector) vectorLength *= 2;
+    functor_type op(alpha, rowmap, entries, values, x, beta, y, 1);
+    const int teamSize   = std::min(256 / vectorLength, policy_type(exec, 1, Kokkos::AUTO, vectorLength)
+                                                            .team_size_recommended(op, Kokkos::ParallelForTag()));
+    const int leagueSize = (nrows + teamSize - 1) / teamSize;
+    op.rows_per_team     = teamSize;
+    Kokkos::parallel_for("KokkosSparse::spmv<MultiValues,NoTranspose>",
+                         policy_type(exec, leagueSize, teamSize, vectorLength), op);
+  } else {
+    Kokkos::parallel_for("KokkosSparse::spmv<MultiValues,NoTranspose>",
+                         Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, nrows),
+                         functor_type(alpha, rowmap, entries, values, x, beta, y, 1));
+  }
+}
+
+template <class execution_space, class RowMap, class Entries, class Values, class XVector, class YVector,
+          bool conjugate>
+void spmv_multi_values_transpose(const execution_space& exec, typename YVector::const_value_type& alpha,
+                                 const RowMap& rowmap, const Entries& entries, const Values& values, const XVector& x,
+                                 typename YVector::const_value_type& beta, const YVector& y) {
+  using y_scalar_type = typename YVector::non_const_value_type;
+  // The functor atomically adds into y, so scale it first
+  if (beta == Kokkos::ArithTraits<y_scalar_type>::zero())
+    Kokkos::deep_copy(exec, y, Kokkos::ArithTraits<y_scalar_type>::zero());
+  else if (beta != Kokkos::ArithTraits<y_scalar_type>::one())
+    KokkosBlas::scal(exec, y, beta, y);
+  Kokkos::parallel_for(
+      "KokkosSparse::spmv<MultiValues,Transpose>", Kokkos::RangePolicy<execution_space>(exec, 0, rowmap.extent(0) - 1),
+      SPMV_MultiValues_Transpose_Functor<RowMap, Entries, Values, XVector, YVector, conjugate>(alpha, rowmap, entries,
+                                                                                                values, x, y));
+}
+
+/// spmv for N matrices sharing one graph: Y(:,l) := beta*Y(:,l) + alpha*Op(A_l)*X(:,l)
+template <class execution_space, class RowMap, class Entries, class Values, class XVector, class YVector>
+void spmv_multi_values(const execution_space& exec, const char mode[], typename YVector::const_value_type& alpha,
+                       const RowMap& rowmap, const Entries& entries, const Values& values, const XVector& x,
+                       typename YVector::const_value_type& beta, const YVector& y) {
+  if (mode[0] == NoTranspose[0]) {
+    spmv_multi_values_no_transpose<execution_space, RowMap, Entries, Values, XVector, YVector, false>(
+        exec, alpha, rowmap, entries, values, x, beta, y);
+  } else if (mode[0] == Conjugate[0]) {
+    spmv_multi_values_no_transpose<execution_space, RowMap, Entries, Values, XVector, YVector, true>(
+        exec, alpha, rowmap, entries, values, x, beta, y);
+  } else if (mode[0] == Transpose[0]) {
+    spmv_multi_values_transpose<execution_space, RowMap, Entries, Values, XVector, YVector, false>(
+        exec, alpha, rowmap, entries, values, x, beta, y);
+  } else if (mode[0] == ConjugateTranspose[0]) {
+    spmv_multi_values_transpose<execution_space, RowMap, Entries, Values, XVector, YVector, true>(
+        exec, alpha, rowmap, entries, values, x, beta, y);
+  } else {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode << " for KokkosSparse::spmv()";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_MULTI_VALUES_IMPL_HPP_
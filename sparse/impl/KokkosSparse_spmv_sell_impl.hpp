@@ -0,0 +1,226 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+
+#include <sstream>
+
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// y := beta*y + alpha*Op(A)*x for a SellMatrix, Op(A) = A or conj(A).
+//
+// On CPUs each work item is a chunk: the C row sums are kept in an array and
+// updated with one contiguous (SIMD) sweep over the chunk's columns. With a
+// compile-time chunk size (ChunkSize > 0) the compiler fully vectorizes that
+// sweep; ChunkSize == 0 handles any other chunk size.
+//
+// On GPUs each work item is a single row (slot). Neighboring threads read
+// neighboring entries of the chunk, so all loads are coalesced.
+template <class execution_space, class AMatrix, class XVector, class YVector, bool conjugate, int ChunkSize>
+struct SPMV_Sell_Functor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  const y_value_type alpha;
+  AMatrix m_A;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+
+  SPMV_Sell_Functor(const y_value_type alpha_, const AMatrix& m_A_, const XVector& m_x_, const y_value_type beta_,
+                    const YVector& m_y_)
+      : alpha(alpha_), m_A(m_A_), m_x(m_x_), beta(beta_), m_y(m_y_) {}
+
+  KOKKOS_INLINE_FUNCTION void update(const ordinal_type slot, const y_value_type& sum) const {
+    const ordinal_type row = m_A.row_perm(slot);
+    // beta == 0 overwrites y, even if it contains NaN
+    if (beta == Kokkos::ArithTraits<y_value_type>::zero())
+      m_y(row) = alpha * sum;
+    else
+      m_y(row) = beta * m_y(row) + alpha * sum;
+  }
+
+  // Host version: one chunk per work item
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type chunk) const {
+    constexpr bool fixedChunk = ChunkSize > 0;
+    // Size of the accumulator array; with a runtime chunk size, rows are
+    // processed in groups of 16
+    constexpr ordinal_type accSize = fixedChunk ? ChunkSize : 16;
+    const ordinal_type C           = fixedChunk ? ChunkSize : m_A.chunkSize();
+    const size_type base           = m_A.chunk_offsets(chunk);
+    const ordinal_type width       = m_A.chunkWidth(chunk);
+    const ordinal_type slot0       = chunk * C;
+
+    const value_type* KOKKOS_RESTRICT values     = m_A.values.data();
+    const ordinal_type* KOKKOS_RESTRICT entries  = m_A.entries.data();
+    const typename XVector::value_type* x        = m_x.data();
+    const size_t x_stride                        = m_x.stride(0);
+
+    for (ordinal_type r0 = 0; r0 < C; r0 += accSize) {
+      const ordinal_type nr = fixedChunk ? accSize : (C - r0 < accSize ? C - r0 : accSize);
+      y_value_type sum[accSize];
+      for (ordinal_type r = 0; r < accSize; r++) sum[r] = Kokkos::ArithTraits<y_value_type>::zero();
+      for (ordinal_type j = 0; j < width; j++) {
+        const size_type k = base + size_type(j) * C + r0;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+        for (ordinal_type r = 0; r < nr; r++) {
+          const value_type val = conjugate ? ATV::conj(values[k + r]) : values[k + r];
+          sum[r] += val * x[entries[k + r] * x_stride];
+        }
+      }
+      for (ordinal_type r = 0; r < nr; r++) {
+        const ordinal_type slot = slot0 + r0 + r;
+        if (slot < m_A.numRows()) update(slot, sum[r]);
+      }
+    }
+  }
+
+  // GPU version: one row per work item
+  struct RowTag {};
+  KOKKOS_INLINE_FUNCTION void operator()(const RowTag&, const ordinal_type slot) const {
+    const ordinal_type C     = m_A.chunkSize();
+    const ordinal_type chunk = slot / C;
+    const size_type base     = m_A.chunk_offsets(chunk) + slot % C;
+    const ordinal_type width = m_A.chunkWidth(chunk);
+    y_value_type sum         = Kokkos::ArithTraits<y_value_type>::zero();
+    for (ordinal_type j = 0; j < width; j++) {
+      const size_type k    = base + size_type(j) * C;
+      const value_type val = conjugate ? ATV::conj(m_A.values(k)) : m_A.values(k);
+      sum += val * m_x(m_A.entries(k));
+    }
+    update(slot, sum);
+  }
+};
+
+// y := alpha*Op(A)*x (accumulated into the already scaled y) for a
+// SellMatrix, Op(A) = A^T or A^H.
+template <class AMatrix, class XVector, class YVector, bool conjugate>
+struct SPMV_Sell_Transpose_Functor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  const y_value_type alpha;
+  AMatrix m_A;
+  XVector m_x;
+  YVector m_y;
+
+  SPMV_Sell_Transpose_Functor(const y_value_type alpha_, const AMatrix& m_A_, const XVector& m_x_,
+                              const YVector& m_y_)
+      : alpha(alpha_), m_A(m_A_), m_x(m_x_), m_y(m_y_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type slot) const {
+    const ordinal_type C     = m_A.chunkSize();
+    const ordinal_type chunk = slot / C;
+    const size_type base     = m_A.chunk_offsets(chunk) + slot % C;
+    const ordinal_type width = m_A.chunkWidth(chunk);
+    const y_value_type ax    = alpha * m_x(m_A.row_perm(slot));
+    for (ordinal_type j = 0; j < width; j++) {
+      const size_type k    = base + size_type(j) * C;
+      const value_type val = conjugate ? ATV::conj(m_A.values(k)) : m_A.values(k);
+      // Skip padding (and explicit zeros): nothing to add
+      if (val == ATV::zero()) continue;
+      Kokkos::atomic_add(&m_y(m_A.entries(k)), static_cast<y_value_type>(val * ax));
+    }
+  }
+};
+
+template <class execution_space, class AMatrix, class XVector, class YVector, bool conjugate>
+void spmv_sell_no_transpose(const execution_space& exec, typename YVector::const_value_type& alpha, const AMatrix& A,
+                            const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  if constexpr (KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+    using functor_type = SPMV_Sell_Functor<execution_space, AMatrix, XVector, YVector, conjugate, 0>;
+    Kokkos::parallel_for("KokkosSparse::spmv<SELL,NoTranspose>",
+                         Kokkos::RangePolicy<execution_space, typename functor_type::RowTag>(exec, 0, A.numRows()),
+                         functor_type(alpha, A, x, beta, y));
+  } else {
+    Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Static>> policy(exec, 0, A.numChunks());
+    // Compile-time chunk sizes cover the common SIMD widths
+    switch (A.chunkSize()) {
+#define KOKKOSSPARSE_IMPL_SPMV_SELL_CASE(C)                                                                    \
+  case C:                                                                                                      \
+    Kokkos::parallel_for("KokkosSparse::spmv<SELL,NoTranspose>", policy,                                       \
+                         SPMV_Sell_Functor<execution_space, AMatrix, XVector, YVector, conjugate, C>(alpha, A, x, \
+                                                                                                     beta, y)); \
+    break;
+      KOKKOSSPARSE_IMPL_SPMV_SELL_CASE(4)
+      KOKKOSSPARSE_IMPL_SPMV_SELL_CASE(8)
+      KOKKOSSPARSE_IMPL_SPMV_SELL_CASE(16)
+      KOKKOSSPARSE_IMPL_SPMV_SELL_CASE(32)
+#undef KOKKOSSPARSE_IMPL_SPMV_SELL_CASE
+      default:
+        Kokkos::parallel_for("KokkosSparse::spmv<SELL,NoTranspose>", policy,
+                             SPMV_Sell_Functor<execution_space, AMatrix, XVector, YVector, conjugate, 0>(alpha, A, x,
+                                                                                                          beta, y));
+    }
+  }
+}
+
+template <class execution_space, class AMatrix, class XVector, class YVector, bool conjugate>
+void spmv_sell_transpose(const execution_space& exec, typename YVector::const_value_type& alpha, const AMatrix& A,
+                         const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  using y_scalar_type = typename YVector::non_const_value_type;
+  // The functor atomically adds into y, so scale it first
+  if (beta == Kokkos::ArithTraits<y_scalar_type>::zero())
+    Kokkos::deep_copy(exec, y, Kokkos::ArithTraits<y_scalar_type>::zero());
+  else if (beta != Kokkos::ArithTraits<y_scalar_type>::one())
+    KokkosBlas::scal(exec, y, beta, y);
+  Kokkos::parallel_for("KokkosSparse::spmv<SELL,Transpose>", Kokkos::RangePolicy<execution_space>(exec, 0, A.numRows()),
+                       SPMV_Sell_Transpose_Functor<AMatrix, XVector, YVector, conjugate>(alpha, A, x, y));
+}
+
+/// Rank-1 spmv for a SellMatrix: y := beta*y + alpha*Op(A)*x
+template <class execution_space, class AMatrix, class XVector, class YVector>
+void spmv_sell(const execution_space& exec, const char mode[], typename YVector::const_value_type& alpha,
+               const AMatrix& A, const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  if (mode[0] == NoTranspose[0]) {
+    spmv_sell_no_transpose<execution_space, AMatrix, XVector, YVector, false>(exec, alpha, A, x, beta, y);
+  } else if (mode[0] == Conjugate[0]) {
+    spmv_sell_no_transpose<execution_space, AMatrix, XVector, YVector, true>(exec, alpha, A, x, beta, y);
+  } else if (mode[0] == Transpose[0]) {
+    spmv_sell_transpose<execution_space, AMatrix, XVector, YVector, false>(exec, alpha, A, x, beta, y);
+  } else if (mode[0] == ConjugateTranspose[0]) {
+    spmv_sell_transpose<execution_space, AMatrix, XVector, YVector, true>(exec, alpha, A, x, beta, y);
+  } else {
+    std::stringstream ss;
+    ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode << " for KokkosSparse::spmv()";
+    KokkosKernels::Impl::throw_runtime_exception(ss.str());
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
@@ -20,6 +20,20 @@
 #include "KokkosSparse_CrsMatrix.hpp"
 
 #include <regex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
 
 namespace KokkosSparse {
 namespace Impl {
@@ -737,6 +751,380 @@ void read_graph_crs(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj, sca
   myFile.close();
 }
 
+/// \brief Read-only contents of a file, memory-mapped on POSIX systems and
+/// read into a (64-byte aligned) host buffer elsewhere.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &filename) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("MappedFile: cannot open " + filename);
+    // Size of the file that was opened (off_t, so files over 2 GB are fine)
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) != 0) {
+      close(fd);
+      throw std::runtime_error("MappedFile: cannot stat " + filename);
+    }
+    size_ = size_t(off_t(stat_buf.st_size));
+    if (size_) {
+      void *mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (mapped == MAP_FAILED) throw std::runtime_error("MappedFile: cannot map " + filename);
+      mapping_ = mapped;
+      data_    = static_cast<const char *>(mapped);
+    } else {
+      close(fd);
+    }
+#else
+    std::ifstream in(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!in) throw std::runtime_error("MappedFile: cannot open " + filename);
+    size_ = size_t(in.tellg());
+    in.seekg(0);
+    buffer_ = Kokkos::View<char *, Kokkos::HostSpace>(Kokkos::view_alloc(Kokkos::WithoutInitializing, filename), size_);
+    in.read(buffer_.data(), std::streamsize(size_));
+    data_ = buffer_.data();
+#endif
+  }
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (mapping_) munmap(mapping_, size_);
+#endif
+  }
+
+  MappedFile(const MappedFile &)            = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const char *data_ = nullptr;
+  size_t size_      = 0;
+#ifndef _WIN32
+  void *mapping_ = nullptr;
+#else
+  Kokkos::View<char *, Kokkos::HostSpace> buffer_;
+#endif
+};
+
+// Binary CRS container (.kkb)
+//
+// A versioned binary format for caching matrices, so that large matrices do
+// not need to be parsed from text again. The file is a fixed size header
+// followed by the row map, entries and values arrays, each starting at a
+// 64-byte aligned offset. All data is stored in the byte order of the host
+// that wrote it. The arrays can be memory-mapped and used in place (see
+// CrsBinaryMapping).
+namespace Binary {
+
+inline constexpr char magic[8]           = {'K', 'K', 'S', 'P', 'C', 'R', 'S', '\0'};
+inline constexpr uint32_t version        = 1;
+inline constexpr uint32_t byteOrderMark  = 0x01020304;
+inline constexpr size_t sectionAlignment = 64;
+inline constexpr uint32_t signedIntTag   = 0x100;
+inline constexpr uint32_t unsignedIntTag = 0x200;
+inline constexpr uint32_t floatTag       = 0x300;
+inline constexpr uint32_t complexTag     = 0x400;
+inline constexpr uint64_t checksumBasis  = 14695981039346656037ULL;
+inline constexpr uint64_t checksumPrime  = 1099511628211ULL;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t headerSize;
+  uint32_t byteOrder;
+  // Type tags: kind (signedIntTag, floatTag, ...) | sizeof(type)
+  uint32_t offsetType;
+  uint32_t ordinalType;
+  uint32_t scalarType;
+  uint64_t numRows;
+  uint64_t numCols;
+  uint64_t nnz;
+  // Byte offsets of the arrays from the start of the file
+  uint64_t rowMapOffset;
+  uint64_t entriesOffset;
+  uint64_t valuesOffset;
+  uint64_t rowMapChecksum;
+  uint64_t entriesChecksum;
+  uint64_t valuesChecksum;
+  // Size and modification time of the file this one was converted from,
+  // or 0 if unknown. Used to detect stale caches.
+  uint64_t sourceSize;
+  uint64_t sourceMTime;
+  // Checksum of all the bytes above
+  uint64_t headerChecksum;
+};
+static_assert(sizeof(Header) == 128, "Binary::Header must not contain padding");
+
+template <typename T>
+constexpr uint32_t type_tag() {
+  if constexpr (std::is_integral_v<T>)
+    return (std::is_signed_v<T> ? signedIntTag : unsignedIntTag) | uint32_t(sizeof(T));
+  else if constexpr (std::is_floating_point_v<T>)
+    return floatTag | uint32_t(sizeof(T));
+  else if constexpr (std::is_same_v<T, Kokkos::complex<float>> || std::is_same_v<T, Kokkos::complex<double>>)
+    return complexTag | uint32_t(sizeof(T));
+  else
+    return 0;
+}
+
+inline std::string type_name(uint32_t tag) {
+  std::string kind;
+  switch (tag & ~uint32_t(0xff)) {
+    case signedIntTag: kind = "i"; break;
+    case unsignedIntTag: kind = "u"; break;
+    case floatTag: kind = "f"; break;
+    case complexTag: kind = "c"; break;
+    default: return "unknown";
+  }
+  return kind + std::to_string(8 * (tag & 0xff));
+}
+
+// 64-bit FNV-1a over 8-byte words (and then the remaining bytes). Fast
+// enough to run on every load.
+inline uint64_t checksum(const void *data, size_t bytes) {
+  const unsigned char *p = static_cast<const unsigned char *>(data);
+  uint64_t h             = checksumBasis;
+  size_t numWords        = bytes / sizeof(uint64_t);
+  for (size_t i = 0; i < numWords; i++) {
+    uint64_t w;
+    std::memcpy(&w, p + i * sizeof(uint64_t), sizeof(uint64_t));
+    h = (h ^ w) * checksumPrime;
+  }
+  for (size_t i = numWords * sizeof(uint64_t); i < bytes; i++) h = (h ^ p[i]) * checksumPrime;
+  return h;
+}
+
+inline uint64_t header_checksum(const Header &h) { return checksum(&h, offsetof(Header, headerChecksum)); }
+
+inline uint64_t align_offset(uint64_t offset) {
+  return (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+}
+
+// Size and modification time of a file, or 0 if it can't be accessed
+inline void file_stamp(const char *filename, uint64_t &size, uint64_t &mtime) {
+  struct stat stat_buf;
+  if (stat(filename, &stat_buf) == 0) {
+    size  = uint64_t(stat_buf.st_size);
+    mtime = uint64_t(stat_buf.st_mtime);
+  } else {
+    size  = 0;
+    mtime = 0;
+  }
+}
+
+// Check the header and that the arrays it describes fit in fileSize bytes.
+inline Header validate_header(const char *data, size_t fileSize, const std::string &filename) {
+  auto fail = [&](const std::string &what) {
+    throw std::runtime_error("Binary CRS file " + filename + ": " + what);
+  };
+  Header h;
+  if (fileSize < sizeof(Header)) fail("too small to contain a header");
+  std::memcpy(&h, data, sizeof(Header));
+  if (std::memcmp(h.magic, magic, sizeof(magic))) fail("not a Kokkos Kernels binary CRS file");
+  if (h.version != version)
+    fail("unsupported version " + std::to_string(h.version) + " (expected " + std::to_string(version) + ")");
+  if (h.byteOrder != byteOrderMark) fail("written on a host with a different byte order");
+  if (h.headerSize != sizeof(Header) || h.headerChecksum != header_checksum(h)) fail("corrupted header");
+  // Each array must fit between its offset and the end of the file. The
+  // sizes are compared without adding to the offsets, so that corrupted
+  // values can't wrap around.
+  auto fits = [&](uint64_t offset, uint64_t count, uint32_t tag) {
+    const uint64_t elemSize = tag & 0xff;
+    return offset % sectionAlignment == 0 && offset >= sizeof(Header) && offset <= fileSize &&
+           (elemSize == 0 || count <= (uint64_t(fileSize) - offset) / elemSize);
+  };
+  if (h.numRows == std::numeric_limits<uint64_t>::max() || !fits(h.rowMapOffset, h.numRows + 1, h.offsetType) ||
+      !fits(h.entriesOffset, h.nnz, h.ordinalType) || !fits(h.valuesOffset, h.nnz, h.scalarType))
+    fail("truncated or corrupted array offsets");
+  return h;
+}
+
+// Create an empty file with a unique name next to filename and return its
+// name (mkstemp, so that concurrent writers never get the same name).
+inline std::string create_temp_file(const char *filename) {
+  std::string name = std::string(filename) + ".tmp.XXXXXX";
+#ifndef _WIN32
+  int fd = mkstemp(&name[0]);
+  if (fd < 0)
+    throw std::runtime_error(std::string("write_matrix_binary: cannot create a temporary file for ") + filename);
+  // mkstemp creates the file readable by the owner only: give it the mode of
+  // the file it replaces, or the one a new file would get under the umask
+  struct stat stat_buf;
+  mode_t mode;
+  if (stat(filename, &stat_buf) == 0) {
+    mode = stat_buf.st_mode & 07777;
+  } else {
+    const mode_t mask = umask(0);
+    umask(mask);
+    mode = 0666 & ~mask;
+  }
+  fchmod(fd, mode);
+  close(fd);
+#else
+  if (_mktemp_s(&name[0], name.size() + 1) != 0)
+    throw std::runtime_error(std::string("write_matrix_binary: cannot create a temporary file for ") + filename);
+#endif
+  return name;
+}
+
+}  // namespace Binary
+
+// Write a CRS matrix in the binary (.kkb) format. The file is written under a
+// unique temporary name and then renamed, so that readers never see a partial
+// file and concurrent writers of the same file don't share a temporary file.
+// sourceFile (optional) is the file the matrix was read from; its size and
+// modification time are recorded to detect stale caches.
+template <typename lno_t, typename size_type, typename scalar_t>
+void write_matrix_binary(lno_t nrows, lno_t ncols, size_type nentries, const size_type *xadj, const lno_t *adj,
+                         const scalar_t *vals, const char *filename, const char *sourceFile = nullptr) {
+  if (!Binary::type_tag<scalar_t>() || !Binary::type_tag<lno_t>() || !Binary::type_tag<size_type>())
+    throw std::runtime_error("write_matrix_binary: unsupported scalar, ordinal or offset type");
+  Binary::Header h;
+  std::memset(&h, 0, sizeof(Binary::Header));
+  std::memcpy(h.magic, Binary::magic, sizeof(Binary::magic));
+  h.version           = Binary::version;
+  h.headerSize        = sizeof(Binary::Header);
+  h.byteOrder         = Binary::byteOrderMark;
+  h.offsetType        = Binary::type_tag<size_type>();
+  h.ordinalType       = Binary::type_tag<lno_t>();
+  h.scalarType        = Binary::type_tag<scalar_t>();
+  h.numRows           = nrows;
+  h.numCols           = ncols;
+  h.nnz               = nentries;
+  size_t rowMapBytes  = sizeof(size_type) * (size_t(nrows) + 1);
+  size_t entriesBytes = sizeof(lno_t) * size_t(nentries);
+  size_t valuesBytes  = sizeof(scalar_t) * size_t(nentries);
+  h.rowMapOffset      = Binary::align_offset(sizeof(Binary::Header));
+  h.entriesOffset     = Binary::align_offset(h.rowMapOffset + rowMapBytes);
+  h.valuesOffset      = Binary::align_offset(h.entriesOffset + entriesBytes);
+  h.rowMapChecksum    = Binary::checksum(xadj, rowMapBytes);
+  h.entriesChecksum   = Binary::checksum(adj, entriesBytes);
+  h.valuesChecksum    = Binary::checksum(vals, valuesBytes);
+  if (sourceFile) Binary::file_stamp(sourceFile, h.sourceSize, h.sourceMTime);
+  h.headerChecksum = Binary::header_checksum(h);
+
+  std::string tmpName = Binary::create_temp_file(filename);
+  {
+    std::ofstream out(tmpName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+      std::remove(tmpName.c_str());
+      throw std::runtime_error(std::string("write_matrix_binary: cannot open ") + tmpName);
+    }
+    const char zeros[Binary::sectionAlignment] = {};
+    size_t position                            = 0;
+
+    auto writeBytes = [&](const void *data, size_t bytes) {
+      out.write(static_cast<const char *>(data), std::streamsize(bytes));
+      position += bytes;
+    };
+    auto writeSection = [&](uint64_t offset, const void *data, size_t bytes) {
+      writeBytes(zeros, size_t(offset) - position);
+      writeBytes(data, bytes);
+    };
+    writeBytes(&h, sizeof(Binary::Header));
+    writeSection(h.rowMapOffset, xadj, rowMapBytes);
+    writeSection(h.entriesOffset, adj, entriesBytes);
+    writeSection(h.valuesOffset, vals, valuesBytes);
+    if (!out) {
+      out.close();
+      std::remove(tmpName.c_str());
+      throw std::runtime_error(std::string("write_matrix_binary: failed writing ") + tmpName);
+    }
+  }
+  if (std::rename(tmpName.c_str(), filename)) {
+    std::remove(tmpName.c_str());
+    throw std::runtime_error(std::string("write_matrix_binary: cannot rename ") + tmpName + " to " + filename);
+  }
+}
+
+/// \brief Read-only view of a binary (.kkb) CRS file, without copies.
+///
+/// The file is memory-mapped (see MappedFile) and row_map(), entries() and
+/// values() are unmanaged host views
+/// pointing directly into it. They are valid as long as this object lives.
+/// The types stored in the file must be exactly lno_t, size_type and
+/// scalar_t.
+template <typename lno_t, typename size_type, typename scalar_t>
+class CrsBinaryMapping {
+ public:
+  using unmanaged_t  = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using row_map_type = Kokkos::View<const size_type *, Kokkos::HostSpace, unmanaged_t>;
+  using entries_type = Kokkos::View<const lno_t *, Kokkos::HostSpace, unmanaged_t>;
+  using values_type  = Kokkos::View<const scalar_t *, Kokkos::HostSpace, unmanaged_t>;
+
+  /// \param filename [in] The .kkb file.
+  /// \param verifyChecksums [in] Check the arrays against the checksums in
+  ///   the header (this reads the whole file once).
+  explicit CrsBinaryMapping(const std::string &filename, bool verifyChecksums = true)
+      : file_(filename), filename_(filename) {
+    data_   = file_.data();
+    header_ = Binary::validate_header(data_, file_.size(), filename);
+    if (header_.offsetType != Binary::type_tag<size_type>() || header_.ordinalType != Binary::type_tag<lno_t>() ||
+        header_.scalarType != Binary::type_tag<scalar_t>()) {
+      throw std::runtime_error("Binary CRS file " + filename + " stores (scalar, ordinal, offset) = (" +
+                               Binary::type_name(header_.scalarType) + ", " +
+                               Binary::type_name(header_.ordinalType) + ", " +
+                               Binary::type_name(header_.offsetType) + "), but (" +
+                               Binary::type_name(Binary::type_tag<scalar_t>()) + ", " +
+                               Binary::type_name(Binary::type_tag<lno_t>()) + ", " +
+                               Binary::type_name(Binary::type_tag<size_type>()) + ") was requested");
+    }
+    if (verifyChecksums) verify_checksums();
+  }
+
+  /// Check the arrays against the checksums in the header (this reads the
+  /// whole file once). Throws if they don't match.
+  void verify_checksums() const {
+    if (Binary::checksum(data_ + header_.rowMapOffset, row_map().span() * sizeof(size_type)) !=
+            header_.rowMapChecksum ||
+        Binary::checksum(data_ + header_.entriesOffset, entries().span() * sizeof(lno_t)) !=
+            header_.entriesChecksum ||
+        Binary::checksum(data_ + header_.valuesOffset, values().span() * sizeof(scalar_t)) != header_.valuesChecksum) {
+      throw std::runtime_error("Binary CRS file " + filename_ + ": checksum mismatch, the file is corrupted");
+    }
+  }
+
+  const Binary::Header &header() const { return header_; }
+  lno_t numRows() const { return header_.numRows; }
+  lno_t numCols() const { return header_.numCols; }
+  size_type nnz() const { return header_.nnz; }
+
+  row_map_type row_map() const {
+    return row_map_type(reinterpret_cast<const size_type *>(data_ + header_.rowMapOffset), header_.numRows + 1);
+  }
+  entries_type entries() const {
+    return entries_type(reinterpret_cast<const lno_t *>(data_ + header_.entriesOffset), header_.nnz);
+  }
+  values_type values() const {
+    return values_type(reinterpret_cast<const scalar_t *>(data_ + header_.valuesOffset), header_.nnz);
+  }
+
+ private:
+  MappedFile file_;
+  std::string filename_;
+  Binary::Header header_;
+  const char *data_;
+};
+
+// Copy the arrays of a mapped binary (.kkb) file into a new matrix
+template <typename crsMat_t, typename lno_t, typename size_type, typename scalar_t>
+crsMat_t crs_matrix_from_binary(const CrsBinaryMapping<lno_t, size_type, scalar_t> &file) {
+  using graph_t        = typename crsMat_t::StaticCrsGraphType;
+  using row_map_view_t = typename graph_t::row_map_type::non_const_type;
+  using cols_view_t    = typename graph_t::entries_type::non_const_type;
+  using values_view_t  = typename crsMat_t::values_type::non_const_type;
+  row_map_view_t rowmap_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rowmap_view"), file.numRows() + 1);
+  cols_view_t columns_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "colsmap_view"), file.nnz());
+  values_view_t values_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "values_view"), file.nnz());
+  Kokkos::deep_copy(rowmap_view, file.row_map());
+  Kokkos::deep_copy(columns_view, file.entries());
+  Kokkos::deep_copy(values_view, file.values());
+  graph_t static_graph(columns_view, rowmap_view);
+  return crsMat_t("CrsMatrix", file.numCols(), values_view, static_graph);
+}
+
 template <typename crs_matrix_t>
 void write_kokkos_crst_matrix(crs_matrix_t a_crsmat, const char *filename) {
   typedef typename crs_matrix_t::StaticCrsGraphType graph_t;
@@ -763,6 +1151,10 @@ void write_kokkos_crst_matrix(crs_matrix_t a_crsmat, const char *filename) {
     write_matrix_mtx<lno_t, offset_t, scalar_t>(a_crsmat.numRows(), a_crsmat.numCols(), a_crsmat.nnz(), a_rowmap,
                                                 a_entries, a_values, filename);
     return;
+  } else if (KokkosKernels::Impl::endswith(strfilename, ".kkb")) {
+    write_matrix_binary<lno_t, offset_t, scalar_t>(a_crsmat.numRows(), a_crsmat.numCols(), a_crsmat.nnz(), a_rowmap,
+                                                   a_entries, a_values, filename);
+    return;
   } else if (a_crsmat.numRows() != a_crsmat.numCols()) {
     throw std::runtime_error(
         "For formats other than MatrixMarket (suffix .mm or .mtx),\n"
@@ -781,9 +1173,309 @@ void write_kokkos_crst_matrix(crs_matrix_t a_crsmat, const char *filename) {
   }
 }
 
+namespace MM {
+
+// Fast parsing of MatrixMarket tokens from memory. Each function skips blanks,
+// parses the token at p without reading at or past end, and returns the
+// position after it (nullptr if there is no valid token).
+
+inline const char *skip_blanks(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+  return p;
+}
+
+template <typename int_t>
+const char *parse_int(const char *p, const char *end, int_t &val) {
+  p        = skip_blanks(p, end);
+  bool neg = false;
+  if (p < end && (*p == '-' || *p == '+')) neg = *p++ == '-';
+  const char *digits = p;
+  int64_t v          = 0;
+  while (p < end && unsigned(*p - '0') < 10u) v = 10 * v + (*p++ - '0');
+  if (p == digits) return nullptr;
+  val = static_cast<int_t>(neg ? -v : v);
+  return p;
+}
+
+// Correctly rounded, like operator>>: when the significand and the power of
+// ten are both exactly representable, one multiplication or division gives
+// the correctly rounded result (Clinger's fast path). Other tokens (more
+// digits, large exponents, inf, nan) go through strtod/strtof.
+template <typename real_t>
+const char *parse_real(const char *p, const char *end, real_t &val) {
+  static_assert(std::is_same_v<real_t, float> || std::is_same_v<real_t, double>,
+                "parse_real only supports float and double");
+  constexpr double powersOf10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr int maxExactPow10     = std::is_same_v<real_t, float> ? 10 : 22;
+  constexpr uint64_t maxExactMant = uint64_t(1) << std::numeric_limits<real_t>::digits;
+  p                               = skip_blanks(p, end);
+  const char *token               = p;
+  bool neg                        = false;
+  if (p < end && (*p == '-' || *p == '+')) neg = *p++ == '-';
+  uint64_t mantissa = 0;
+  int numDigits     = 0;
+  int exp10         = 0;
+  bool anyDigit     = false;
+  bool exact        = true;
+  auto addDigit     = [&](char c, bool fraction) {
+    anyDigit = true;
+    if (numDigits < 19) {
+      mantissa = 10 * mantissa + (c - '0');
+      if (mantissa) numDigits++;
+      if (fraction) exp10--;
+    } else {
+      // digits past the 19th don't fit in the mantissa
+      exact = false;
+      if (!fraction) exp10++;
+    }
+  };
+  while (p < end && unsigned(*p - '0') < 10u) addDigit(*p++, false);
+  if (p < end && *p == '.') {
+    p++;
+    while (p < end && unsigned(*p - '0') < 10u) addDigit(*p++, true);
+  }
+  if (anyDigit && p < end && (*p == 'e' || *p == 'E')) {
+    const char *q = p + 1;
+    int expSign   = 1;
+    if (q < end && (*q == '-' || *q == '+')) expSign = *q++ == '-' ? -1 : 1;
+    if (q < end && unsigned(*q - '0') < 10u) {
+      int e = 0;
+      while (q < end && unsigned(*q - '0') < 10u) {
+        if (e < 100000) e = 10 * e + (*q - '0');
+        q++;
+      }
+      exp10 += expSign * e;
+      p = q;
+    }
+  }
+  if (anyDigit && exact && mantissa <= maxExactMant && exp10 >= -maxExactPow10 && exp10 <= maxExactPow10) {
+    real_t m = real_t(mantissa);
+    if (exp10 >= 0)
+      m *= real_t(powersOf10[exp10]);
+    else
+      m /= real_t(powersOf10[-exp10]);
+    val = neg ? -m : m;
+    return p;
+  }
+  // Slow path on a null-terminated copy of the token
+  if (!anyDigit) {
+    p = token;
+    while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') p++;
+  }
+  std::string copy(token, p);
+  char *parsedEnd = nullptr;
+  if constexpr (std::is_same_v<real_t, float>)
+    val = std::strtof(copy.c_str(), &parsedEnd);
+  else
+    val = std::strtod(copy.c_str(), &parsedEnd);
+  if (parsedEnd == copy.c_str()) return nullptr;
+  return token + (parsedEnd - copy.c_str());
+}
+
+// Scalar types that parse_scalar supports (others use the serial reader)
+template <typename scalar_t>
+constexpr bool parallel_parse_supported() {
+  return std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double> || std::is_integral_v<scalar_t> ||
+         std::is_same_v<scalar_t, Kokkos::complex<float>> || std::is_same_v<scalar_t, Kokkos::complex<double>>;
+}
+
+template <typename scalar_t>
+const char *parse_scalar(const char *p, const char *end, scalar_t &val) {
+  if constexpr (std::is_integral_v<scalar_t>) {
+    return parse_int(p, end, val);
+  } else if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+    return parse_real(p, end, val);
+  } else {
+    // complex appears as "real imag"
+    typename scalar_t::value_type re, im;
+    p = parse_real(p, end, re);
+    if (p) p = parse_real(p, end, im);
+    val = scalar_t(re, im);
+    return p;
+  }
+}
+
+// First non-blank character of the line starting at p is a digit or sign,
+// i.e. the line is not blank and not a comment
+inline bool is_entry_line(const char *p, const char *lineEnd) {
+  p = skip_blanks(p, lineEnd);
+  return p < lineEnd && *p != '%';
+}
+
+inline const char *line_end(const char *p, const char *end) {
+  const char *nl = static_cast<const char *>(std::memchr(p, '\n', end - p));
+  return nl ? nl : end;
+}
+
+}  // namespace MM
+
+// Parallel version of the entry-reading part of read_mtx, for coordinate
+// files. The file is mapped in memory and split in chunks at line boundaries;
+// the chunks are parsed concurrently, and the CRS arrays are built with a
+// counting sort by row (atomic counts, then a sort of each row by column and
+// then by position in the file). The result is the same as the serial reader:
+// rows sorted by column, duplicates kept except when symmetrizing (where the
+// first occurrence in the file is kept).
+//
+// dataBegin is the offset in the file of the first line after the size line.
+template <typename lno_t, typename size_type, typename scalar_t>
+void read_mtx_coordinate_parallel(const char *fileName, size_t dataBegin, lno_t nr, lno_t nc, size_type nnz,
+                                  MM::MtxField mtx_field, MM::MtxSym mtx_sym, bool symmetrize, bool remove_diagonal,
+                                  bool transpose, lno_t *nrows, lno_t *ncols, size_type *ne, size_type **xadj,
+                                  lno_t **adj, scalar_t **ew) {
+  using host_exec   = Kokkos::DefaultHostExecutionSpace;
+  using range_pol   = Kokkos::RangePolicy<host_exec>;
+  using dynamic_pol = Kokkos::RangePolicy<host_exec, Kokkos::Schedule<Kokkos::Dynamic>>;
+  MappedFile file(fileName);
+  const char *begin = file.data() + std::min(dataBegin, file.size());
+  const char *end   = file.data() + file.size();
+
+  // Split the data into chunks that end at a newline
+  const size_t bytes    = end - begin;
+  const size_t minChunk = size_t(1) << 16;
+  size_t numChunks      = std::max<size_t>(1, std::min<size_t>(bytes / minChunk, 8 * host_exec().concurrency()));
+  std::vector<const char *> chunkBegin(numChunks + 1);
+  chunkBegin[0]         = begin;
+  chunkBegin[numChunks] = end;
+  for (size_t c = 1; c < numChunks; c++) {
+    const char *p = std::max(begin + c * (bytes / numChunks), chunkBegin[c - 1]);
+    p             = MM::line_end(p, end);
+    chunkBegin[c] = p == end ? end : p + 1;
+  }
+
+  // Count the entry lines of each chunk, then parse them in place
+  Kokkos::View<size_type *, Kokkos::HostSpace> chunkOffsets("MTX chunk offsets", numChunks + 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx::CountLines", range_pol(0, numChunks), [&](size_t c) {
+    size_type count = 0;
+    for (const char *p = chunkBegin[c]; p < chunkBegin[c + 1];) {
+      const char *lineEnd = MM::line_end(p, chunkBegin[c + 1]);
+      if (MM::is_entry_line(p, lineEnd)) count++;
+      p = lineEnd + 1;
+    }
+    chunkOffsets(c) = count;
+  });
+  size_type numLines = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(host_exec(), numChunks + 1, chunkOffsets, numLines);
+  if (numLines < nnz)
+    throw std::runtime_error(std::string("MatrixMarket file ") + fileName + " has " + std::to_string(numLines) +
+                             " entries, but its header says " + std::to_string(nnz));
+
+  Kokkos::View<lno_t *, Kokkos::HostSpace> rows(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MTX rows"), nnz);
+  Kokkos::View<lno_t *, Kokkos::HostSpace> cols(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MTX cols"), nnz);
+  Kokkos::View<scalar_t *, Kokkos::HostSpace> vals(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MTX vals"), nnz);
+  // Number of parse errors and out of range indices
+  size_type numBadLines = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::read_mtx::Parse", dynamic_pol(0, numChunks),
+      [&](size_t c, size_type &lbad) {
+        size_type k = chunkOffsets(c);
+        for (const char *p = chunkBegin[c]; p < chunkBegin[c + 1] && k < nnz;) {
+          const char *lineEnd = MM::line_end(p, chunkBegin[c + 1]);
+          if (MM::is_entry_line(p, lineEnd)) {
+            int64_t s = 0, d = 0;
+            scalar_t w = Kokkos::ArithTraits<scalar_t>::one();
+            const char *q = MM::parse_int(p, lineEnd, s);
+            if (q) q = MM::parse_int(q, lineEnd, d);
+            if (q && mtx_field != MM::PATTERN) q = MM::parse_scalar(q, lineEnd, w);
+            if (!q || s < 1 || s > nr || d < 1 || d > nc) {
+              lbad++;
+              s = d = 1;
+            }
+            rows(k) = transpose ? d - 1 : s - 1;
+            cols(k) = transpose ? s - 1 : d - 1;
+            vals(k) = w;
+            k++;
+          }
+          p = lineEnd + 1;
+        }
+      },
+      numBadLines);
+  if (numBadLines)
+    throw std::runtime_error(std::string("MatrixMarket file ") + fileName + " has " + std::to_string(numBadLines) +
+                             " invalid entries");
+  if (transpose) std::swap(nr, nc);
+
+  // Each entry (i, j) is stored in row i, and its mirror in row j.
+  // Keys of the stored edges: 2 * entry + (1 if mirror). They are 64-bit
+  // unsigned, so that they can't overflow for any number of entries.
+  using key_type  = uint64_t;
+  auto keepEntry  = [=](size_type k) { return rows(k) != cols(k) || !remove_diagonal; };
+  auto keepMirror = [=](size_type k) { return symmetrize && rows(k) != cols(k); };
+  Kokkos::View<size_type *, Kokkos::HostSpace> rowStart("MTX row counts", nr + 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx::CountRows", range_pol(0, nnz), [&](size_type k) {
+    if (keepEntry(k)) Kokkos::atomic_inc(&rowStart(rows(k)));
+    if (keepMirror(k)) Kokkos::atomic_inc(&rowStart(cols(k)));
+  });
+  size_type numEdges = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(host_exec(), nr + 1, rowStart, numEdges);
+  Kokkos::View<size_type *, Kokkos::HostSpace> cursor(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MTX cursor"),
+                                                      nr);
+  Kokkos::deep_copy(cursor, Kokkos::subview(rowStart, Kokkos::make_pair(lno_t(0), nr)));
+  Kokkos::View<key_type *, Kokkos::HostSpace> keys(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MTX keys"),
+                                                   numEdges);
+  Kokkos::parallel_for("KokkosSparse::read_mtx::FillRows", range_pol(0, nnz), [&](size_type k) {
+    if (keepEntry(k)) keys(Kokkos::atomic_fetch_add(&cursor(rows(k)), size_type(1))) = 2 * key_type(k);
+    if (keepMirror(k)) keys(Kokkos::atomic_fetch_add(&cursor(cols(k)), size_type(1))) = 2 * key_type(k) + 1;
+  });
+
+  // Sort each row by column, then file order; count what is kept
+  auto keyColumn         = [=](key_type key) { return (key & 1) ? rows(key / 2) : cols(key / 2); };
+  const key_type removed = ~key_type(0);
+  Kokkos::View<size_type *, Kokkos::HostSpace> rowKept("MTX kept counts", nr + 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx::SortRows", dynamic_pol(0, nr), [&](lno_t i) {
+    key_type *rowBegin = keys.data() + rowStart(i);
+    key_type *rowEnd   = keys.data() + rowStart(i + 1);
+    std::sort(rowBegin, rowEnd, [&](key_type a, key_type b) {
+      lno_t ca = keyColumn(a), cb = keyColumn(b);
+      return ca < cb || (ca == cb && a < b);
+    });
+    size_type kept = 0;
+    lno_t prevCol  = -1;
+    for (key_type *e = rowBegin; e < rowEnd; e++) {
+      lno_t col = keyColumn(*e);
+      // When symmetrizing, duplicates are dropped
+      if (symmetrize && col == prevCol)
+        *e = removed;
+      else
+        kept++;
+      prevCol = col;
+    }
+    rowKept(i) = kept;
+  });
+  size_type numKept = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(host_exec(), nr + 1, rowKept, numKept);
+
+  KokkosKernels::Impl::md_malloc<size_type>(xadj, nr + 1);
+  KokkosKernels::Impl::md_malloc<lno_t>(adj, numKept);
+  KokkosKernels::Impl::md_malloc<scalar_t>(ew, numKept);
+  size_type *outRowmap = *xadj;
+  lno_t *outEntries    = *adj;
+  scalar_t *outValues  = *ew;
+  Kokkos::parallel_for("KokkosSparse::read_mtx::Compact", range_pol(0, nr + 1), [&](lno_t i) {
+    outRowmap[i] = rowKept(i);
+    if (i == nr) return;
+    size_type out = rowKept(i);
+    for (size_type e = rowStart(i); e < rowStart(i + 1); e++) {
+      key_type key = keys(e);
+      if (key == removed) continue;
+      outEntries[out] = keyColumn(key);
+      outValues[out]  = (key & 1) ? MM::symmetryFlip<scalar_t>(vals(key / 2), mtx_sym) : vals(key / 2);
+      out++;
+    }
+  });
+  *nrows = nr;
+  *ncols = nc;
+  *ne    = numKept;
+}
+
+// Read a MatrixMarket file into CRS arrays (allocated with new[]).
+// Coordinate files are parsed in parallel on the default host execution space
+// if Kokkos is initialized, unless parallel_parse is false.
 template <typename lno_t, typename size_type, typename scalar_t>
 int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne, size_type **xadj, lno_t **adj,
-             scalar_t **ew, bool symmetrize = false, bool remove_diagonal = true, bool transpose = false) {
+             scalar_t **ew, bool symmetrize = false, bool remove_diagonal = true, bool transpose = false,
+             bool parallel_parse = true) {
   using namespace MM;
   std::ifstream mmf(fileName, std::ifstream::in);
   if (!mmf.is_open()) {
@@ -900,6 +1592,15 @@ int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne, si
     if (mtx_field == PATTERN)
       throw std::runtime_error("array format MatrixMarket file can't have \"pattern\" field type.");
   }
+  if constexpr (MM::parallel_parse_supported<scalar_t>()) {
+    if (parallel_parse && mtx_format == COORDINATE && Kokkos::is_initialized()) {
+      size_t dataBegin = mmf.tellg();
+      mmf.close();
+      read_mtx_coordinate_parallel(fileName, dataBegin, nr, nc, nnz, mtx_field, mtx_sym, symmetrize, remove_diagonal,
+                                   transpose, nrows, ncols, ne, xadj, adj, ew);
+      return 0;
+    }
+  }
   if (symmetrize) {
     numEdges = 2 * nnz;
   }
@@ -1249,6 +1950,12 @@ crsMat_t read_kokkos_crst_matrix(const char *filename_) {
   typedef typename cols_view_t::value_type lno_t;
   typedef typename values_view_t::value_type scalar_t;
 
+  if (KokkosKernels::Impl::endswith(strfilename, ".kkb")) {
+    // Binary files are used in place, and copied once to the matrix views
+    CrsBinaryMapping<lno_t, size_type, scalar_t> file(strfilename);
+    return crs_matrix_from_binary<crsMat_t>(file);
+  }
+
   lno_t nr, nc, *adj;
   size_type *xadj, nnzA;
   scalar_t *values;
@@ -1290,6 +1997,61 @@ crsMat_t read_kokkos_crst_matrix(const char *filename_) {
   return crsmat;
 }
 
+// Name of the binary cache of a matrix file, for the given types. For
+// example, A.mtx read as CrsMatrix<double, int, ..., size_t> is cached in
+// A.mtx.f64-i32-u64.kkb, next to A.mtx.
+template <typename crsMat_t>
+std::string binary_cache_filename(const std::string &filename) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  return filename + "." + Binary::type_name(Binary::type_tag<scalar_t>()) + "-" +
+         Binary::type_name(Binary::type_tag<lno_t>()) + "-" + Binary::type_name(Binary::type_tag<size_type>()) +
+         ".kkb";
+}
+
+// Same as read_kokkos_crst_matrix, but keeps a binary (.kkb) copy of the
+// file next to it (see binary_cache_filename) and reads that copy instead,
+// as long as it is up to date. The first call on a file converts it; if the
+// cache can't be written (e.g. read-only directory), the matrix is still
+// returned.
+template <typename crsMat_t>
+crsMat_t read_kokkos_crst_matrix_cached(const char *filename_) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  std::string strfilename(filename_);
+  if (KokkosKernels::Impl::endswith(strfilename, ".kkb") || !Binary::type_tag<scalar_t>() ||
+      !Binary::type_tag<lno_t>() || !Binary::type_tag<size_type>())
+    return read_kokkos_crst_matrix<crsMat_t>(filename_);
+  std::string cacheName = binary_cache_filename<crsMat_t>(strfilename);
+  uint64_t sourceSize, sourceMTime;
+  Binary::file_stamp(filename_, sourceSize, sourceMTime);
+  if (KokkosKernels::Impl::kk_get_file_size(cacheName.c_str())) {
+    try {
+      // Map the cache once: check its stamp, then its checksums, then copy
+      CrsBinaryMapping<lno_t, size_type, scalar_t> cache(cacheName, false);
+      if (cache.header().sourceSize == sourceSize && cache.header().sourceMTime == sourceMTime) {
+        cache.verify_checksums();
+        return crs_matrix_from_binary<crsMat_t>(cache);
+      }
+    } catch (std::runtime_error &) {
+      // Invalid or stale cache: convert again
+    }
+  }
+  crsMat_t A = read_kokkos_crst_matrix<crsMat_t>(filename_);
+  try {
+    auto rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+    auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+    auto values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+    write_matrix_binary<lno_t, size_type, scalar_t>(A.numRows(), A.numCols(), A.nnz(), rowmap.data(),
+                                                    entries.data(), values.data(), cacheName.c_str(), filename_);
+  } catch (std::runtime_error &e) {
+    std::cerr << "Warning: could not cache " << strfilename << " in binary form: " << e.what() << std::endl;
+  }
+  return A;
+}
+
 template <typename crsGraph_t>
 crsGraph_t read_kokkos_crst_graph(const char *filename_) {
   typedef typename crsGraph_t::row_map_type::non_const_type row_map_view_t;
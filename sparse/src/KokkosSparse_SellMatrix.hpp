@@ -0,0 +1,216 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_SellMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::SellMatrix.  This
+/// implements a local (no MPI) sparse matrix stored in sliced ELLPACK
+/// ("SELL-C-sigma") format.
+
+#ifndef KOKKOSSPARSE_SELLMATRIX_HPP_
+#define KOKKOSSPARSE_SELLMATRIX_HPP_
+
+#include "Kokkos_Core.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_Macros.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class SellMatrix
+/// \brief Sliced ELLPACK (SELL-C-sigma) implementation of a sparse matrix.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of the chunk offsets.
+///
+/// The rows are grouped into chunks of C consecutive (permuted) rows. Each
+/// chunk is padded to the length of its longest row and stored column-major,
+/// so entry j of the r-th row of chunk c is at position
+/// <tt>chunk_offsets(c) + j * C + r</tt>. Consecutive entries of a chunk
+/// therefore belong to different rows and can be processed with packed SIMD
+/// loads (or coalesced loads on GPUs).
+///
+/// To reduce padding, rows are sorted by decreasing length inside windows
+/// of sigma rows before being split into chunks. <tt>row_perm(i)</tt> is the
+/// original row stored in slot i (it has numRows() entries); the slots past
+/// numRows() in the last chunk are padding. Padded entries have value zero
+/// and a column index that is valid for x, so kernels need no branches for
+/// them.
+template <class ScalarType, class OrdinalType, class Device, class MemoryTraits = void,
+          class SizeType = typename Kokkos::ViewTraits<OrdinalType*, Device, void, void>::size_type>
+class SellMatrix {
+  static_assert(std::is_signed<OrdinalType>::value, "SellMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each chunk offset.
+  typedef SizeType size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  //! Type of each (column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+
+  typedef typename std::remove_const<value_type>::type non_const_value_type;
+  typedef typename std::add_const<non_const_value_type>::type const_value_type;
+  typedef typename std::remove_const<ordinal_type>::type non_const_ordinal_type;
+  typedef typename std::add_const<non_const_ordinal_type>::type const_ordinal_type;
+  typedef typename std::remove_const<size_type>::type non_const_size_type;
+  typedef typename std::add_const<non_const_size_type>::type const_size_type;
+
+  //! Type of the chunk offsets (one more than the number of chunks).
+  typedef Kokkos::View<size_type*, device_type, MemoryTraits> chunk_offsets_type;
+  //! Type of the row permutation (one entry per row).
+  typedef Kokkos::View<ordinal_type*, device_type, MemoryTraits> row_perm_type;
+  //! Type of column indices in the sparse matrix.
+  typedef Kokkos::View<ordinal_type*, device_type, MemoryTraits> index_type;
+  //! Type of the values of the sparse matrix.
+  typedef Kokkos::View<value_type*, device_type, MemoryTraits> values_type;
+
+  /// \name Storage of the sliced ELLPACK structure and values.
+  //@{
+  //! Offset of each chunk into entries and values.
+  chunk_offsets_type chunk_offsets;
+  //! Original row index of each slot.
+  row_perm_type row_perm;
+  //! Column indices, including padding.
+  index_type entries;
+  //! Values, including (zero) padding.
+  values_type values;
+  //@}
+
+ private:
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+  size_type nnz_;
+  ordinal_type chunkSize_;
+  ordinal_type sigma_;
+
+ public:
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  SellMatrix() : numRows_(0), numCols_(0), nnz_(0), chunkSize_(1), sigma_(1) {}
+
+  // clang-format off
+  /// \brief Constructor that accepts the SELL-C-sigma arrays.
+  ///
+  /// The matrix will store and use the views directly (by view, not by deep
+  /// copy). Use crs2sell to build a SellMatrix from a CrsMatrix.
+  ///
+  /// \param nrows [in] The number of rows.
+  /// \param ncols [in] The number of columns.
+  /// \param annz [in] The number of structural nonzeros (not counting padding).
+  /// \param chunkSize [in] The number of rows per chunk (C).
+  /// \param sigma [in] The size of the row sorting window (sigma).
+  /// \param offsets [in] The chunk offsets.
+  /// \param perm [in] The original row stored in each slot.
+  /// \param cols [in] The column indices.
+  /// \param vals [in] The values.
+  // clang-format on
+  SellMatrix(const std::string& /* label */, const OrdinalType nrows, const OrdinalType ncols, const size_type annz,
+             const OrdinalType chunkSize, const OrdinalType sigma, const chunk_offsets_type& offsets,
+             const row_perm_type& perm, const index_type& cols, const values_type& vals)
+      : chunk_offsets(offsets),
+        row_perm(perm),
+        entries(cols),
+        values(vals),
+        numRows_(nrows),
+        numCols_(ncols),
+        nnz_(annz),
+        chunkSize_(chunkSize),
+        sigma_(sigma) {
+    if (chunkSize < 1) {
+      std::ostringstream os;
+      os << "SellMatrix: chunk size = " << chunkSize << " must be positive.";
+      throw std::invalid_argument(os.str());
+    }
+    if (size_t(numChunks()) + 1 != size_t(offsets.extent(0))) {
+      std::ostringstream os;
+      os << "SellMatrix: offsets has " << offsets.extent(0) << " entries, but " << numChunks()
+         << " chunks of size " << chunkSize << " need " << numChunks() + 1 << ".";
+      throw std::invalid_argument(os.str());
+    }
+    if (entries.extent(0) != values.extent(0)) {
+      std::ostringstream os;
+      os << "SellMatrix: entries (" << entries.extent(0) << ") and values (" << values.extent(0)
+         << ") must have the same length.";
+      throw std::invalid_argument(os.str());
+    }
+  }
+
+  //! The number of rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return numRows_; }
+
+  //! The number of columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The number of structural nonzeros in the sparse matrix (without padding).
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return nnz_; }
+
+  //! The number of stored entries, including padding.
+  KOKKOS_INLINE_FUNCTION size_type numStored() const { return entries.extent(0); }
+
+  //! The number of rows per chunk (C).
+  KOKKOS_INLINE_FUNCTION ordinal_type chunkSize() const { return chunkSize_; }
+
+  //! The size of the row sorting window (sigma).
+  KOKKOS_INLINE_FUNCTION ordinal_type sigma() const { return sigma_; }
+
+  //! The number of chunks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numChunks() const { return (numRows_ + chunkSize_ - 1) / chunkSize_; }
+
+  //! The padded length of all rows in chunk c.
+  KOKKOS_INLINE_FUNCTION ordinal_type chunkWidth(const ordinal_type c) const {
+    return static_cast<ordinal_type>((chunk_offsets(c + 1) - chunk_offsets(c)) / chunkSize_);
+  }
+};
+
+/// \class is_sell_matrix
+/// \brief is_sell_matrix<T>::value is true if T is a SellMatrix<...>, false
+/// otherwise
+template <typename>
+struct is_sell_matrix : public std::false_type {};
+template <typename... P>
+struct is_sell_matrix<SellMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_sell_matrix<const SellMatrix<P...>> : public std::true_type {};
+
+/// Equivalent to is_sell_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_sell_matrix_v = is_sell_matrix<T>::value;
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif  // KOKKOSSPARSE_SELLMATRIX_HPP_
@@ -64,10 +64,36 @@ void sort_crs_matrix(const execution_space& exec, const rowmap_t& rowmap, const
   }
   Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
   if constexpr (!KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
-    // On CPUs, use a sequential radix sort within each row.
-    Kokkos::parallel_for("sort_crs_matrix[CPU,radix]",
-                         Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, numRows),
-                         Impl::MatrixRadixSortFunctor<rowmap_t, entries_t, values_t>(rowmap, entries, values));
+    // On CPUs:
+    //   If a few long rows would serialize the per-row sort AND the dimensions
+    //   are not too large, sort all entries at once with a parallel radix sort
+    //   by (row, column). Otherwise, use a sequential radix sort within each row.
+    Ordinal maxDeg = KokkosSparse::Impl::graph_max_degree(exec, rowmap);
+    int keyBits    = -1;
+    if (KokkosSparse::Impl::useRadixBulkSortHeuristic(exec, entries.extent(0), maxDeg)) {
+      // Calculate the true number of columns if user didn't pass it in
+      if (numCols == Kokkos::ArithTraits<Ordinal>::max()) {
+        KokkosKernels::Impl::kk_view_reduce_max(exec, entries.extent(0), entries, numCols);
+        numCols++;
+      }
+      keyBits = KokkosSparse::Impl::bulkCrsKeyBits(numRows, numCols);
+    }
+    if (keyBits >= 0) {
+      auto permutation = KokkosSparse::Impl::computeEntryPermutationRadix(exec, rowmap, entries, numCols);
+      // Permutations cannot be done in-place
+      Kokkos::View<typename values_t::value_type*, execution_space> origValues(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "origValues"), values.extent(0));
+      Kokkos::View<typename entries_t::value_type*, execution_space> origEntries(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "origEntries"), entries.extent(0));
+      Kokkos::deep_copy(exec, origValues, values);
+      Kokkos::deep_copy(exec, origEntries, entries);
+      KokkosSparse::Impl::applyPermutation(exec, permutation, origEntries, entries);
+      KokkosSparse::Impl::applyPermutation(exec, permutation, origValues, values);
+    } else {
+      Kokkos::parallel_for("sort_crs_matrix[CPU,radix]",
+                           Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, numRows),
+                           Impl::MatrixRadixSortFunctor<rowmap_t, entries_t, values_t>(rowmap, entries, values));
+    }
   } else {
     // On GPUs:
     //   If the matrix is highly imbalanced, or has long rows AND the dimensions
@@ -241,11 +267,28 @@ void sort_crs_graph(const execution_space& exec, const rowmap_t& rowmap, const e
     return;
   }
   if constexpr (!KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
-    // If on CPU, sort each row independently. Don't need to know numCols for
-    // this.
-    Kokkos::parallel_for("sort_crs_graph[CPU,radix]",
-                         Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, numRows),
-                         Impl::GraphRadixSortFunctor<rowmap_t, entries_t>(rowmap, entries));
+    // On CPUs:
+    //   If a few long rows would serialize the per-row sort AND the dimensions
+    //   are not too large, sort all entries at once with a parallel radix sort
+    //   by (row, column). Otherwise, sort each row independently, which
+    //   doesn't need numCols.
+    Ordinal maxDeg = KokkosSparse::Impl::graph_max_degree(exec, rowmap);
+    int keyBits    = -1;
+    if (KokkosSparse::Impl::useRadixBulkSortHeuristic(exec, entries.extent(0), maxDeg)) {
+      // Calculate the true number of columns if user didn't pass it in
+      if (numCols == Kokkos::ArithTraits<Ordinal>::max()) {
+        KokkosKernels::Impl::kk_view_reduce_max(exec, entries.extent(0), entries, numCols);
+        numCols++;
+      }
+      keyBits = KokkosSparse::Impl::bulkCrsKeyBits(numRows, numCols);
+    }
+    if (keyBits >= 0) {
+      KokkosSparse::Impl::bulkRadixSortGraph(exec, rowmap, entries, numCols);
+    } else {
+      Kokkos::parallel_for("sort_crs_graph[CPU,radix]",
+                           Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, numRows),
+                           Impl::GraphRadixSortFunctor<rowmap_t, entries_t>(rowmap, entries));
+    }
   } else {
     // On GPUs:
     //   If the graph is highly imbalanced AND the dimensions are not too large
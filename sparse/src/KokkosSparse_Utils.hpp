@@ -397,13 +397,13 @@ crsMat_t transpose_matrix(const crsMat_t &A) {
 
 template <typename in_row_view_t, typename in_nnz_view_t, typename out_row_view_t, typename out_nnz_view_t,
           typename tempwork_row_view_t, typename MyExecSpace>
-void transpose_graph(typename in_nnz_view_t::non_const_value_type num_rows,
+void transpose_graph(const MyExecSpace &exec, typename in_nnz_view_t::non_const_value_type num_rows,
                      typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj, in_nnz_view_t adj,
                      out_row_view_t t_xadj,  // pre-allocated -- initialized with 0
                      out_nnz_view_t t_adj    // pre-allocated -- no need for initialize
 ) {
   // allocate some memory for work for row pointers
-  tempwork_row_view_t tmp_row_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "tmp_row_view"), num_cols + 1);
+  tempwork_row_view_t tmp_row_view(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "tmp_row_view"), num_cols + 1);
 
   in_nnz_view_t tmp1;
   out_nnz_view_t tmp2;
@@ -428,16 +428,27 @@ void transpose_graph(typename in_nnz_view_t::non_const_value_type num_rows,
   TransposeFunctor_t tm(num_rows, num_cols, xadj, adj, tmp1, t_xadj, t_adj, tmp2, tmp_row_view, false, team_size);
 
   Kokkos::parallel_for("KokkosKernels::Impl::transpose_graph::S0",
-                       count_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
+                       count_tp_t(exec, (num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
 
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(num_cols + 1, t_xadj);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(exec, num_cols + 1, t_xadj);
 
-  Kokkos::deep_copy(tmp_row_view, t_xadj);
+  Kokkos::deep_copy(exec, tmp_row_view, t_xadj);
 
   Kokkos::parallel_for("KokkosKernels::Impl::transpose_graph::S1",
-                       fill_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
+                       fill_tp_t(exec, (num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
 
-  MyExecSpace().fence();
+  exec.fence();
+}
+
+template <typename in_row_view_t, typename in_nnz_view_t, typename out_row_view_t, typename out_nnz_view_t,
+          typename tempwork_row_view_t, typename MyExecSpace>
+void transpose_graph(typename in_nnz_view_t::non_const_value_type num_rows,
+                     typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj, in_nnz_view_t adj,
+                     out_row_view_t t_xadj,  // pre-allocated -- initialized with 0
+                     out_nnz_view_t t_adj    // pre-allocated -- no need for initialize
+) {
+  transpose_graph<in_row_view_t, in_nnz_view_t, out_row_view_t, out_nnz_view_t, tempwork_row_view_t, MyExecSpace>(
+      MyExecSpace(), num_rows, num_cols, xadj, adj, t_xadj, t_adj);
 }
 
 template <typename in_row_view_t, typename in_nnz_view_t, typename in_scalar_view_t, typename out_row_view_t,
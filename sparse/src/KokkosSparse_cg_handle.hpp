@@ -0,0 +1,173 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include <iostream>
+#include <string>
+
+#ifndef _CGHANDLE_HPP
+#define _CGHANDLE_HPP
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/**
+ * The handle class for CG. Used to store some input parameters and
+ * results.
+ *
+ * For more info, see KokkosSparse_cg.hpp doxygen
+ */
+template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace, class TemporaryMemorySpace,
+          class PersistentMemorySpace>
+class CGHandle {
+ public:
+  using HandleExecSpace             = ExecutionSpace;
+  using HandleTempMemorySpace       = TemporaryMemorySpace;
+  using HandlePersistentMemorySpace = PersistentMemorySpace;
+
+  using execution_space = ExecutionSpace;
+  using memory_space    = HandlePersistentMemorySpace;
+  using device_t        = Kokkos::Device<execution_space, memory_space>;
+
+  using size_type       = typename std::remove_const<size_type_>::type;
+  using const_size_type = const size_type;
+
+  using nnz_lno_t       = typename std::remove_const<lno_t_>::type;
+  using const_nnz_lno_t = const nnz_lno_t;
+
+  using nnz_scalar_t       = typename std::remove_const<scalar_t_>::type;
+  using const_nnz_scalar_t = const nnz_scalar_t;
+
+  using float_t = typename Kokkos::ArithTraits<nnz_scalar_t>::mag_type;
+
+  using nnz_lno_view_t = typename Kokkos::View<nnz_lno_t *, device_t>;
+
+  using nnz_value_view_t = typename Kokkos::View<nnz_scalar_t *, device_t>;
+
+  /**
+   * The CG variant. All three compute the same iterates in exact arithmetic.
+   */
+  enum Algorithm {
+    CLASSICAL,          // Hestenes-Stiefel: two global reductions per iteration
+    CHRONOPOULOS_GEAR,  // One fused reduction per iteration
+    PIPELINED           // Ghysels-Vanroose: one fused reduction, overlapped with the spmv and preconditioner
+  };
+
+  /**
+   * The result of the run
+   */
+  enum Flag {
+    Conv,    // Converged
+    NoConv,  // Did not converge
+    LOA,     // Solver had loss of accuracy
+    NotRun
+  };  // CG was never run
+
+ private:
+  // Inputs
+
+  size_type max_iters;  /// Maximum number of iterations
+  float_t tol;          /// Relative residual convergence tolerance
+  Algorithm algo;       /// The CG variant
+  bool verbose;         /// Print extra info to stdout
+
+  // Outputs
+  int num_iters;        /// Number of iterations the sovler took
+  float_t end_rel_res;  /// Residual from solver
+  Flag conv_flag_val;   /// Denotes end result of the run
+
+ public:
+  // Use set methods to control algorithm, and verbose
+  CGHandle(const size_type max_iters_ = 1000, const float_t tol_ = 1e-8)
+      : max_iters(max_iters_),
+        tol(tol_),
+        algo(PIPELINED),
+        verbose(false),
+        num_iters(-1),
+        end_rel_res(-1),
+        conv_flag_val(NotRun) {}
+
+  void reset_handle(const size_type max_iters_ = 1000, const float_t tol_ = 1e-8) {
+    set_max_iters(max_iters_);
+    set_tol(tol_);
+    set_algorithm(PIPELINED);
+    set_verbose(false);
+    num_iters     = -1;
+    end_rel_res   = -1;
+    conv_flag_val = NotRun;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~CGHandle() {}
+
+  KOKKOS_INLINE_FUNCTION
+  size_type get_max_iters() const { return max_iters; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_max_iters(const size_type max_iters_) { this->max_iters = max_iters_; }
+
+  KOKKOS_INLINE_FUNCTION
+  float_t get_tol() const { return tol; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_tol(const float_t tol_) { this->tol = tol_; }
+
+  KOKKOS_INLINE_FUNCTION
+  Algorithm get_algorithm() const { return algo; }
+
+  /**
+   * CHRONOPOULOS_GEAR and PIPELINED need one global reduction per iteration
+   * instead of two, at the cost of one (CHRONOPOULOS_GEAR) or four
+   * (PIPELINED) extra vector updates and the memory of two or six extra
+   * vectors. PIPELINED starts the reduction before the spmv and
+   * preconditioner apply of the iteration and only waits for it afterwards.
+   * Their recurrences are less stable: the true residual is checked before
+   * reporting convergence, and the iteration is restarted from it if needed.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void set_algorithm(const Algorithm algo_) { this->algo = algo_; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool get_verbose() const { return verbose; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_verbose(const bool verbose_) { this->verbose = verbose_; }
+
+  int get_num_iters() const {
+    assert(get_conv_flag_val() != NotRun);
+    return num_iters;
+  }
+  float_t get_end_rel_res() const {
+    assert(get_conv_flag_val() != NotRun);
+    return end_rel_res;
+  }
+  Flag get_conv_flag_val() const { return conv_flag_val; }
+
+  void set_stats(int num_iters_, float_t end_rel_res_, Flag conv_flag_val_) {
+    assert(conv_flag_val_ != NotRun);
+    num_iters     = num_iters_;
+    end_rel_res   = end_rel_res_;
+    conv_flag_val = conv_flag_val_;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif
@@ -81,5 +81,76 @@ template <typename ScalarType, typename OrdinalType, class DeviceType, class Mem
 auto coo2crs(KokkosSparse::CooMatrix<ScalarType, OrdinalType, DeviceType, MemoryTraitsType, SizeType> &cooMatrix) {
   return coo2crs(cooMatrix.numRows(), cooMatrix.numCols(), cooMatrix.row(), cooMatrix.col(), cooMatrix.data());
 }
+
+// clang-format off
+///
+/// \brief Symbolic phase of a two-phase conversion of a CooMatrix into a CrsMatrix.
+/// Builds the pattern of the CrsMatrix, with sorted columns in each row, and a map from
+/// each tuple to the CRS entry it is summed into (-1 for tuples with a negative index,
+/// which are skipped). The values of the returned matrix are zero; coo2crs_numeric fills
+/// them, as many times as needed for new data with the same row and col arrays.
+/// \tparam CrsType The KokkosSparse::CrsMatrix type to return
+/// \tparam DimType the dimension type
+/// \tparam RowViewType The row array view type
+/// \tparam ColViewType The column array view type
+/// \tparam MapViewType A rank 1 view of signed integers in the memory space of CrsType
+/// \param m the number of rows
+/// \param n the number of columns
+/// \param row the array of row ids
+/// \param col the array of col ids
+/// \param map allocated here, with one CRS entry index per tuple
+/// \return A KokkosSparse::CrsMatrix.
+// clang-format on
+template <class CrsType, class DimType, class RowViewType, class ColViewType, class MapViewType>
+CrsType coo2crs_symbolic(DimType m, DimType n, RowViewType row, ColViewType col, MapViewType &map) {
+  static_assert(std::is_integral<typename RowViewType::value_type>::value,
+                "RowViewType::value_type must be an integral.");
+  static_assert(std::is_integral<typename ColViewType::value_type>::value,
+                "ColViewType::value_type must be an integral.");
+  static_assert(std::is_signed<typename MapViewType::value_type>::value,
+                "MapViewType::value_type must be a signed integral.");
+
+  if (row.extent(0) != col.extent(0)) Kokkos::abort("row.extent(0) = col.extent(0) required.");
+
+  if constexpr (std::is_signed_v<DimType>) {
+    if (m < 0 || n < 0) Kokkos::abort("m >= 0 and n >= 0 required.");
+  }
+
+  return Impl::coo2crs_symbolic_impl<CrsType>(m, n, row, col, map);
+}
+
+// clang-format off
+///
+/// \brief Symbolic phase of a two-phase conversion of a CooMatrix into a CrsMatrix.
+/// \tparam CrsType     The KokkosSparse::CrsMatrix type to return
+/// \param cooMatrix    The sparse matrix stored in coordinate ("Coo") format.
+/// \param map          allocated here, with one CRS entry index per tuple
+/// \return A KokkosSparse::CrsMatrix.
+// clang-format on
+template <class CrsType, typename ScalarType, typename OrdinalType, class DeviceType, class MemoryTraitsType,
+          typename SizeType, class MapViewType>
+CrsType coo2crs_symbolic(
+    KokkosSparse::CooMatrix<ScalarType, OrdinalType, DeviceType, MemoryTraitsType, SizeType> &cooMatrix,
+    MapViewType &map) {
+  return coo2crs_symbolic<CrsType>(cooMatrix.numRows(), cooMatrix.numCols(), cooMatrix.row(), cooMatrix.col(), map);
+}
+
+// clang-format off
+///
+/// \brief Numeric phase of a two-phase conversion of a CooMatrix into a CrsMatrix. Values are summed.
+/// Overwrites the values of crsMat with the sums of data through the map from coo2crs_symbolic,
+/// in one pass over the tuples with atomic adds.
+/// \tparam MapViewType The map view type
+/// \tparam DataViewType The data array view type
+/// \tparam CrsType The KokkosSparse::CrsMatrix type
+/// \param map the map computed by coo2crs_symbolic
+/// \param data the array of data, in the same order as the row and col arrays given to coo2crs_symbolic
+/// \param crsMat the matrix returned by coo2crs_symbolic
+// clang-format on
+template <class MapViewType, class DataViewType, class CrsType>
+void coo2crs_numeric(const MapViewType &map, DataViewType data, CrsType &crsMat) {
+  if (data.extent(0) != map.extent(0)) Kokkos::abort("data.extent(0) = map.extent(0) required.");
+  Impl::coo2crs_numeric_impl(map, data, crsMat);
+}
 }  // namespace KokkosSparse
 #endif  //  _KOKKOSSPARSE_COO2CRS_HPP
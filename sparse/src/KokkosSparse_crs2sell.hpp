@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _KOKKOSSPARSE_CRS2SELL_HPP
+#define _KOKKOSSPARSE_CRS2SELL_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+///
+/// \brief Blocking function that converts a CrsMatrix to a SellMatrix
+/// (sliced ELLPACK, SELL-C-sigma).
+///
+/// Rows are sorted by decreasing length inside windows of sigma rows, then
+/// split into chunks of C rows which are padded to their longest row.
+/// A larger sigma reduces padding but scatters the rows more, which makes
+/// accesses to y less regular. sigma = 1 keeps the original row order.
+/// sigma is rounded up to a multiple of C so that no chunk straddles two
+/// windows.
+///
+/// The row permutation and chunk layout are computed on the host (they only
+/// depend on the row lengths); entries and values are filled in parallel on
+/// the device of the CrsMatrix.
+///
+/// \tparam CrsMatrixType A KokkosSparse::CrsMatrix
+/// \param A         The matrix to convert.
+/// \param chunkSize The number of rows per chunk (C). For SIMD on host this
+///                  should be a multiple of the vector width (e.g. 8 for
+///                  double with AVX-512); on GPUs, the warp size works well.
+/// \param sigma     The size of the sorting window.
+/// \return A KokkosSparse::Experimental::SellMatrix with the same values,
+///   ordinal, size and device types as A.
+// clang-format on
+template <typename CrsMatrixType>
+auto crs2sell(const CrsMatrixType& A, typename CrsMatrixType::non_const_ordinal_type chunkSize,
+              typename CrsMatrixType::non_const_ordinal_type sigma = 1) {
+  static_assert(is_crs_matrix_v<CrsMatrixType>, "crs2sell: A must be a KokkosSparse::CrsMatrix");
+  using ordinal_type    = typename CrsMatrixType::non_const_ordinal_type;
+  using size_type       = typename CrsMatrixType::non_const_size_type;
+  using value_type      = typename CrsMatrixType::non_const_value_type;
+  using device_type     = typename CrsMatrixType::device_type;
+  using execution_space = typename CrsMatrixType::execution_space;
+  using sell_type       = SellMatrix<value_type, ordinal_type, device_type, void, size_type>;
+
+  if (chunkSize < 1 || sigma < 1) {
+    std::ostringstream os;
+    os << "crs2sell: chunk size (" << chunkSize << ") and sigma (" << sigma << ") must be positive";
+    throw std::invalid_argument(os.str());
+  }
+  sigma = ((sigma + chunkSize - 1) / chunkSize) * chunkSize;
+
+  const ordinal_type nrows   = A.numRows();
+  const ordinal_type nchunks = (nrows + chunkSize - 1) / chunkSize;
+
+  // Sort rows by decreasing length within each window, on host
+  auto h_rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  typename sell_type::row_perm_type perm(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::row_perm"),
+                                        nrows);
+  auto h_perm = Kokkos::create_mirror_view(perm);
+  auto rowLen = [&](ordinal_type i) { return h_rowmap(i + 1) - h_rowmap(i); };
+  std::iota(h_perm.data(), h_perm.data() + nrows, ordinal_type(0));
+  if (sigma > chunkSize) {
+    for (ordinal_type w = 0; w < nrows; w += sigma) {
+      ordinal_type wend = std::min(w + sigma, nrows);
+      std::stable_sort(h_perm.data() + w, h_perm.data() + wend,
+                       [&](ordinal_type a, ordinal_type b) { return rowLen(a) > rowLen(b); });
+    }
+  }
+
+  // Each chunk is padded to its longest row
+  typename sell_type::chunk_offsets_type offsets(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::chunk_offsets"), nchunks + 1);
+  auto h_offsets = Kokkos::create_mirror_view(offsets);
+  h_offsets(0)   = 0;
+  for (ordinal_type c = 0; c < nchunks; c++) {
+    size_type width    = 0;
+    ordinal_type slot0 = c * chunkSize;
+    ordinal_type slot1 = std::min(slot0 + chunkSize, nrows);
+    for (ordinal_type s = slot0; s < slot1; s++) width = std::max(width, size_type(rowLen(h_perm(s))));
+    h_offsets(c + 1) = h_offsets(c) + width * chunkSize;
+  }
+  Kokkos::deep_copy(perm, h_perm);
+  Kokkos::deep_copy(offsets, h_offsets);
+
+  const size_type nstored = h_offsets(nchunks);
+  typename sell_type::index_type entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::entries"),
+                                         nstored);
+  typename sell_type::values_type values(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::values"),
+                                         nstored);
+
+  auto rowmap     = A.graph.row_map;
+  auto crsEntries = A.graph.entries;
+  auto crsValues  = A.values;
+  Kokkos::parallel_for(
+      "KokkosSparse::crs2sell", Kokkos::RangePolicy<execution_space>(0, size_t(nchunks) * chunkSize),
+      KOKKOS_LAMBDA(const size_t slot) {
+        const ordinal_type c   = slot / chunkSize;
+        const ordinal_type r   = slot % chunkSize;
+        const size_type base   = offsets(c);
+        const size_type width  = (offsets(c + 1) - base) / chunkSize;
+        size_type rowBegin     = 0;
+        size_type rowLength    = 0;
+        ordinal_type padColumn = 0;
+        if (slot < size_t(nrows)) {
+          const ordinal_type row = perm(slot);
+          rowBegin               = rowmap(row);
+          rowLength              = rowmap(row + 1) - rowBegin;
+          // Pad with the last column of the row, which is already being loaded
+          if (rowLength) padColumn = crsEntries(rowBegin + rowLength - 1);
+        }
+        for (size_type j = 0; j < width; j++) {
+          const size_type k = base + j * chunkSize + r;
+          if (j < rowLength) {
+            entries(k) = crsEntries(rowBegin + j);
+            values(k)  = crsValues(rowBegin + j);
+          } else {
+            entries(k) = padColumn;
+            values(k)  = Kokkos::ArithTraits<value_type>::zero();
+          }
+        }
+      });
+
+  return sell_type("", nrows, A.numCols(), A.nnz(), chunkSize, sigma, offsets, perm, entries, values);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif  //  _KOKKOSSPARSE_CRS2SELL_HPP
@@ -38,6 +38,8 @@
 #include "KokkosKernels_Error.hpp"
 #include "KokkosSparse_gmres_spec.hpp"
 #include "KokkosSparse_Preconditioner.hpp"
+#include "KokkosSparse_spmv_matrix_free.hpp"
+#include "KokkosSparse_gmres_impl.hpp"
 
 namespace KokkosSparse {
 namespace Experimental {
@@ -157,6 +159,68 @@ void gmres(KernelHandle* handle, AMatrix& A, BType& B, XType& X, Preconditioner<
 
 }  // gmres
 
+/// @brief GMRES with a matrix-free stencil operator A (see
+/// KokkosSparse_spmv_matrix_free.hpp). The operator is applied with
+/// KokkosSparse::spmv, so A is never assembled; the solver options are those
+/// of the handle's gmres handle, as for CrsMatrix.
+/// @tparam KernelHandle
+/// @tparam Stencil
+/// @tparam OrdinalType
+/// @tparam Device
+/// @tparam BType
+/// @tparam XType
+/// @param handle
+/// @param A
+/// @param B
+/// @param X
+/// @param precond
+template <typename KernelHandle, typename Stencil, typename OrdinalType, typename Device, typename BType,
+          typename XType>
+void gmres(KernelHandle* handle, StencilOperator<Stencil, OrdinalType, Device>& A, BType& B, XType& X,
+           Preconditioner<StencilOperator<Stencil, OrdinalType, Device>>* precond = nullptr) {
+  using AMatrix     = StencilOperator<Stencil, OrdinalType, Device>;
+  using scalar_type = typename KernelHandle::nnz_scalar_t;
+
+  static_assert(KOKKOSKERNELS_GMRES_SAME_TYPE(typename BType::value_type, scalar_type),
+                "gmres: B scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_GMRES_SAME_TYPE(typename XType::value_type, scalar_type),
+                "gmres: X scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_GMRES_SAME_TYPE(typename AMatrix::value_type, scalar_type),
+                "gmres: A scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  static_assert(Kokkos::is_view<BType>::value, "gmres: B is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<XType>::value, "gmres: X is not a Kokkos::View.");
+
+  static_assert(BType::rank == 1, "gmres: B must have rank 1");
+  static_assert(XType::rank == 1, "gmres: X must have rank 1");
+
+  static_assert(std::is_same<typename XType::value_type, typename XType::non_const_value_type>::value,
+                "gmres: The output X must be nonconst.");
+
+  static_assert(std::is_same<typename XType::device_type, typename BType::device_type>::value,
+                "gmres: X and B have different device types.");
+
+  static_assert(std::is_same<typename AMatrix::device_type, typename BType::device_type>::value,
+                "gmres: A and B have different device types.");
+
+  if ((X.extent(0) != B.extent(0)) || (static_cast<size_t>(A.numPointCols()) != static_cast<size_t>(X.extent(0))) ||
+      (static_cast<size_t>(A.numPointRows()) != static_cast<size_t>(B.extent(0)))) {
+    std::ostringstream os;
+    os << "KokkosSparse::gmres: Dimensions do not match: "
+       << ", A: " << A.numRows() << " x " << A.numCols() << ", x: " << X.extent(0) << ", b: " << B.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  auto gmres_handle = handle->get_gmres_handle();
+  using Gmres       = KokkosSparse::Impl::Experimental::GmresWrap<std::remove_pointer_t<decltype(gmres_handle)>>;
+  Gmres::gmres(*gmres_handle, A, B, X, precond);
+}  // gmres
+
 }  // namespace Experimental
 }  // namespace KokkosSparse
 
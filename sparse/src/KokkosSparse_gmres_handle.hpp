@@ -95,6 +95,7 @@ class GMRESHandle {
   float_t tol;            /// Relative residual convergence tolerance
   size_type max_restart;  /// Maximum number of times to restart the solver
   Ortho ortho;            /// The orthogonalization type
+  size_type s_step;       /// Number of Krylov vectors built per block (1: classical GMRES)
   bool verbose;           /// Print extra info to stdout
 
   // Outputs
@@ -109,6 +110,7 @@ class GMRESHandle {
         tol(tol_),
         max_restart(max_restart_),
         ortho(CGS2),
+        s_step(1),
         verbose(false),
         num_iters(-1),
         end_rel_res(-1),
@@ -123,6 +125,7 @@ class GMRESHandle {
     set_tol(tol_);
     set_max_restart(max_restart_);
     set_ortho(CGS2);
+    set_s_step(1);
     set_verbose(false);
     num_iters     = -1;
     end_rel_res   = -1;
@@ -156,6 +159,24 @@ class GMRESHandle {
   KOKKOS_INLINE_FUNCTION
   void set_ortho(const Ortho ortho_) { this->ortho = ortho_; }
 
+  KOKKOS_INLINE_FUNCTION
+  size_type get_s_step() const { return s_step; }
+
+  /**
+   * With s > 1, GMRES runs the s-step (communication-avoiding) variant:
+   * each block of s basis vectors is built with s matrix-vector products
+   * in a Newton basis and then orthogonalized at once (block classical
+   * Gram-Schmidt twice, followed by CholQR2), so that a block needs four
+   * global reductions instead of about three per vector. The ortho setting
+   * is not used in that case.
+   */
+  void set_s_step(const size_type s_) {
+    if (s_ <= 0) {
+      throw std::invalid_argument("gmres: Please choose s greater than zero.");
+    }
+    this->s_step = s_;
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool get_verbose() const { return verbose; }
 
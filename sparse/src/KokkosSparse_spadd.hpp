@@ -22,6 +22,7 @@
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosSparse_spadd_numeric_spec.hpp"
 #include "KokkosSparse_spadd_symbolic_spec.hpp"
+#include "KokkosSparse_spadd_sum_impl.hpp"
 
 namespace KokkosSparse {
 namespace Experimental {
@@ -100,6 +101,12 @@ void spadd_symbolic(KernelHandle *handle, Args... args) {
   spadd_symbolic(typename KernelHandle::HandleExecSpace{}, handle, args...);
 }
 
+// Numeric: fill the column indices and values of C.
+// The first call after symbolic also keeps, in the handle, where each entry
+// of A and B goes in C. If set_reuse_c_pattern() was called on the spadd
+// handle, later calls only refresh the values of C through these positions and
+// do not write c_entries again; the patterns of A and B, and C itself, must
+// then be those of the first call.
 template <typename ExecSpace, typename KernelHandle, typename alno_row_view_t_, typename alno_nnz_view_t_,
           typename ascalar_t_, typename ascalar_nnz_view_t_, typename blno_row_view_t_, typename blno_nnz_view_t_,
           typename bscalar_t_, typename bscalar_nnz_view_t_, typename clno_row_view_t_, typename clno_nnz_view_t_,
@@ -270,6 +277,35 @@ void spadd_numeric(KernelHandle *handle, const AScalar alpha, const AMatrix &A,
   spadd_numeric(typename AMatrix::execution_space{}, handle, alpha, A, beta, B, C);
 }
 
+// Symbolic for the sum of several matrices, C = sum_i alpha_i * A_i: allocates
+// C with the union of the patterns of the A_i (sorted and merged, whether or
+// not the A_i are), and keeps the position of every entry of every A_i in C in
+// the handle.
+template <typename ExecSpace, typename KernelHandle, typename AMatrix, typename CMatrix>
+void spadd_symbolic(const ExecSpace &exec, KernelHandle *handle, const std::vector<AMatrix> &A, CMatrix &C) {
+  KokkosSparse::Impl::spadd_sum_symbolic_impl(exec, handle, A, C);
+}
+
+// Numeric for C = sum_i alpha_i * A_i: only scatters the values of the A_i
+// into C, so it may be called again whenever the values of the A_i change, as
+// long as their patterns do not.
+template <typename ExecSpace, typename KernelHandle, typename AScalar, typename AMatrix, typename CMatrix>
+void spadd_numeric(const ExecSpace &exec, KernelHandle *handle, const std::vector<AScalar> &alpha,
+                   const std::vector<AMatrix> &A, CMatrix &C) {
+  KokkosSparse::Impl::spadd_sum_numeric_impl(exec, handle, alpha, A, C);
+}
+
+template <typename KernelHandle, typename AMatrix, typename CMatrix>
+void spadd_symbolic(KernelHandle *handle, const std::vector<AMatrix> &A, CMatrix &C) {
+  spadd_symbolic(typename AMatrix::execution_space{}, handle, A, C);
+}
+
+template <typename KernelHandle, typename AScalar, typename AMatrix, typename CMatrix>
+void spadd_numeric(KernelHandle *handle, const std::vector<AScalar> &alpha, const std::vector<AMatrix> &A,
+                   CMatrix &C) {
+  spadd_numeric(typename AMatrix::execution_space{}, handle, alpha, A, C);
+}
+
 }  // namespace KokkosSparse
 
 #undef SAME_TYPE
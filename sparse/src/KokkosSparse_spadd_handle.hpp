@@ -17,6 +17,7 @@
 #include <Kokkos_Core.hpp>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #ifndef _SPADDHANDLE_HPP
 #define _SPADDHANDLE_HPP
@@ -73,13 +74,22 @@ class SPADDHandle {
   bool called_symbolic;
   bool called_numeric;
 
-  // a_pos and b_pos are used by the unsorted version of the kernel
+  // numeric calls after the first only refresh the values of C, set by the
+  // caller when the patterns of A, B and C have not changed
+  bool reuse_c_pattern;
+
+  // a_pos and b_pos are set by symbolic for unsorted input, and by the first
+  // numeric call for sorted input. If reuse_c_pattern is set, later numeric
+  // calls only scatter the values through them.
   // both have same length as a_entries and b_entries
   // each entry provides the index in C row where the corresponding entry is
   // added
   nnz_lno_view_t a_pos;
   nnz_lno_view_t b_pos;
 
+  // for C = sum_i alpha_i * A_i: sum_pos[i] is the equivalent of a_pos for A_i
+  std::vector<nnz_lno_view_t> sum_pos;
+
  public:
   /// \brief sets the result nnz size.
   /// \param a_pos_in The offset into a.
@@ -93,6 +103,12 @@ class SPADDHandle {
 
   nnz_lno_view_t get_b_pos() { return b_pos; }
 
+  /// \brief sets the positions in C of the entries of each A_i, for the sum of
+  /// several matrices.
+  void set_sum_pos(const std::vector<nnz_lno_view_t>& sum_pos_in) { sum_pos = sum_pos_in; }
+
+  const std::vector<nnz_lno_view_t>& get_sum_pos() { return sum_pos; }
+
   /// \brief sets the result nnz size.
   /// \param result_nnz_size_ size of the output matrix.
   void set_c_nnz(size_type result_nnz_size_) { this->result_nnz_size = result_nnz_size_; }
@@ -118,7 +134,8 @@ class SPADDHandle {
         input_merged(input_is_merged),
         result_nnz_size(0),
         called_symbolic(false),
-        called_numeric(false) {}
+        called_numeric(false),
+        reuse_c_pattern(false) {}
 
   virtual ~SPADDHandle(){};
 
@@ -128,6 +145,11 @@ class SPADDHandle {
   // setters
   void set_call_symbolic(bool call = true) { this->called_symbolic = call; }
   void set_call_numeric(bool call = true) { this->called_numeric = call; }
+  /// \brief lets numeric calls after the first skip the column indices of C
+  /// and only refresh its values. Only valid while A, B and C keep the
+  /// patterns (and C the entries) of the first numeric call after symbolic.
+  void set_reuse_c_pattern(bool reuse = true) { this->reuse_c_pattern = reuse; }
+  bool is_c_pattern_reused() { return this->reuse_c_pattern; }
 
   bool is_input_sorted() { return input_sorted; }
   bool is_input_merged() { return input_merged; }
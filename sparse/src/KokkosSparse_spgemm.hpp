@@ -20,6 +20,9 @@
 #include "KokkosSparse_spgemm_symbolic.hpp"
 #include "KokkosSparse_spgemm_jacobi.hpp"
 #include "KokkosSparse_spgemm_noreuse_spec.hpp"
+#include "KokkosSparse_spgemm_masked_impl.hpp"
+#include "KokkosSparse_spgemm_chunked_impl.hpp"
+#include "KokkosSparse_spgemm_rap_impl.hpp"
 
 namespace KokkosSparse {
 
@@ -219,6 +222,262 @@ CMatrix spgemm(const AMatrix& A, const bool Amode, const BMatrix& B, const bool
           A_internal, Amode, B_internal, Bmode));
 }
 
+///
+/// @brief Symbolic phase of the masked product C<M> = A*B
+///
+/// C gets the entries of A*B that are in the pattern of the mask graph M, or
+/// with complement, the entries of A*B that are not in M. The columns of C
+/// are sorted. Only the mask columns (plus, with complement, the columns of
+/// the product row) are held per row, so the full product is never formed.
+/// The spgemm handle of kh must have been created.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam MGraph A graph with row_map and entries, e.g. the graph of a CrsMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param kh
+/// @param A
+/// @param B
+/// @param M The mask, with as many rows as A
+/// @param complement Whether to keep the entries outside of M instead
+/// @param C Allocated here, with uninitialized values
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class BMatrix, class MGraph, class CMatrix>
+void spgemm_masked_symbolic(const ExecSpace& exec, KernelHandle& kh, const AMatrix& A, const BMatrix& B,
+                            const MGraph& M, const bool complement, CMatrix& C) {
+  KokkosSparse::Impl::spgemm_masked_symbolic_impl(exec, &kh, A, B, M, complement, C);
+}
+
+template <class KernelHandle, class AMatrix, class BMatrix, class MGraph, class CMatrix>
+void spgemm_masked_symbolic(KernelHandle& kh, const AMatrix& A, const BMatrix& B, const MGraph& M,
+                            const bool complement, CMatrix& C) {
+  spgemm_masked_symbolic(typename CMatrix::execution_space(), kh, A, B, M, complement, C);
+}
+
+///
+/// @brief Numeric phase of the masked product C<M> = A*B
+///
+/// Computes the values of A*B at the entries of C computed by
+/// spgemm_masked_symbolic. The mask is already encoded in the pattern of C, so
+/// it is not passed again. This can be called again with new values in A and B,
+/// as long as their patterns do not change, and also accepts any C with
+/// unique columns in each row (e.g. a fixed Galerkin pattern).
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param kh
+/// @param A
+/// @param B
+/// @param C
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
+void spgemm_masked_numeric(const ExecSpace& exec, KernelHandle& kh, const AMatrix& A, const BMatrix& B, CMatrix& C) {
+  KokkosSparse::Impl::spgemm_masked_numeric_impl(exec, &kh, A, B, C);
+}
+
+template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
+void spgemm_masked_numeric(KernelHandle& kh, const AMatrix& A, const BMatrix& B, CMatrix& C) {
+  spgemm_masked_numeric(typename CMatrix::execution_space(), kh, A, B, C);
+}
+
+///
+/// @brief C = A*B computed in row chunks that fit a memory budget
+///
+/// The rows of A are split into chunks so that an upper bound on the size of
+/// each chunk of C fits in kh.get_spgemm_handle()->get_chunk_memory_budget()
+/// bytes (0 for a single chunk). The entries of C are counted chunk by chunk
+/// first, and then each chunk is computed directly into its rows of C, so the
+/// work memory of spgemm never covers more than one chunk. The spgemm handle
+/// of kh must have been created; its algorithm is used for every chunk.
+///
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam CMatrix
+/// @param kh
+/// @param A
+/// @param B
+/// @param C Allocated here
+///
+template <class KernelHandle, class AMatrix, class BMatrix, class CMatrix>
+void spgemm_chunked(KernelHandle& kh, const AMatrix& A, const BMatrix& B, CMatrix& C) {
+  KokkosSparse::Impl::spgemm_chunked_impl(kh, A, B, C);
+}
+
+///
+/// @brief C = A*B computed in row chunks, handed out one chunk at a time
+///
+/// Same chunks as spgemm_chunked, but each chunk of C is passed to
+/// f(firstRow, Cchunk) as soon as it is computed and released afterwards, so
+/// C as a whole is never stored. Cchunk holds the rows [firstRow, firstRow +
+/// Cchunk.numRows()) of C, with all the columns of B.
+///
+/// @tparam CMatrix The type of the chunks of C
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam BMatrix
+/// @tparam ChunkFunctor
+/// @param kh
+/// @param A
+/// @param B
+/// @param f Called on the host with the first row of the chunk and the chunk
+///
+template <class CMatrix, class KernelHandle, class AMatrix, class BMatrix, class ChunkFunctor>
+void spgemm_chunked_for_each(KernelHandle& kh, const AMatrix& A, const BMatrix& B, ChunkFunctor&& f) {
+  KokkosSparse::Impl::spgemm_chunked_for_each_impl<CMatrix>(kh, A, B, std::forward<ChunkFunctor>(f));
+}
+
+namespace Experimental {
+
+///
+/// @brief Symbolic phase of the triple product Ac = R*A*P
+///
+/// Computes the pattern of Ac row by row, straight from the rows of R, A and
+/// P, without forming A*P. The columns of Ac are sorted. The spgemm handle of
+/// handle must have been created.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam RMatrix
+/// @tparam AMatrix
+/// @tparam PMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param handle
+/// @param R The restriction, with as many columns as A has rows
+/// @param A
+/// @param P The prolongation, with as many rows as A has columns
+/// @param Ac Allocated here, with uninitialized values
+///
+template <class ExecSpace, class KernelHandle, class RMatrix, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_symbolic(const ExecSpace& exec, KernelHandle* handle, const RMatrix& R, const AMatrix& A,
+                         const PMatrix& P, CMatrix& Ac) {
+  KokkosSparse::Impl::spgemm_rap_symbolic_impl(exec, handle, R, A, P, Ac);
+}
+
+template <class KernelHandle, class RMatrix, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_symbolic(KernelHandle* handle, const RMatrix& R, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_rap_symbolic(typename CMatrix::execution_space(), handle, R, A, P, Ac);
+}
+
+///
+/// @brief Numeric phase of the triple product Ac = R*A*P
+///
+/// Computes the values of R*A*P at the entries of Ac computed by
+/// spgemm_rap_symbolic, one row of Ac per thread. This can be called again
+/// with new values in R, A and P, as long as their patterns do not change.
+/// Each entry of Ac is summed by a single thread in a fixed order, so the
+/// results are the same from run to run.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam RMatrix
+/// @tparam AMatrix
+/// @tparam PMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param handle
+/// @param R
+/// @param A
+/// @param P
+/// @param Ac
+///
+template <class ExecSpace, class KernelHandle, class RMatrix, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_numeric(const ExecSpace& exec, KernelHandle* handle, const RMatrix& R, const AMatrix& A,
+                        const PMatrix& P, CMatrix& Ac) {
+  KokkosSparse::Impl::spgemm_rap_numeric_impl(exec, handle, R, A, P, Ac);
+}
+
+template <class KernelHandle, class RMatrix, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_numeric(KernelHandle* handle, const RMatrix& R, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_rap_numeric(typename CMatrix::execution_space(), handle, R, A, P, Ac);
+}
+
+template <class KernelHandle, class RMatrix, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap(KernelHandle* handle, const RMatrix& R, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_rap_symbolic(handle, R, A, P, Ac);
+  spgemm_rap_numeric(handle, R, A, P, Ac);
+}
+
+///
+/// @brief Symbolic phase of the Galerkin product Ac = P^T*A*P
+///
+/// Same as spgemm_rap_symbolic with R = P^T. Only the graph of P^T is formed,
+/// and it is freed on return.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix A square matrix
+/// @tparam PMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param handle
+/// @param A
+/// @param P
+/// @param Ac Allocated here, with uninitialized values
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_ptap_symbolic(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const PMatrix& P,
+                          CMatrix& Ac) {
+  KokkosSparse::Impl::spgemm_ptap_symbolic_impl(exec, handle, A, P, Ac);
+}
+
+template <class KernelHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_ptap_symbolic(KernelHandle* handle, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_ptap_symbolic(typename CMatrix::execution_space(), handle, A, P, Ac);
+}
+
+///
+/// @brief Numeric phase of the Galerkin product Ac = P^T*A*P
+///
+/// Goes over the rows j of A: row j of A*P is accumulated in thread scratch
+/// and added, scaled by P(j, i), to each row i of Ac with atomics. Neither
+/// P^T nor A*P is stored. The columns of each row of Ac must be sorted, as
+/// they are after spgemm_ptap_symbolic.
+///
+/// Since the contributions of the rows of A to an entry of Ac are added with
+/// atomics, in no fixed order, the rounding of Ac may differ from run to run.
+/// When bitwise reproducible results are needed, form R = P^T with
+/// KokkosSparse::Impl::transpose_matrix and call spgemm_rap_symbolic and
+/// spgemm_rap_numeric instead.
+///
+/// @tparam ExecSpace
+/// @tparam KernelHandle
+/// @tparam AMatrix
+/// @tparam PMatrix
+/// @tparam CMatrix
+/// @param exec
+/// @param handle
+/// @param A
+/// @param P
+/// @param Ac
+///
+template <class ExecSpace, class KernelHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_ptap_numeric(const ExecSpace& exec, KernelHandle* handle, const AMatrix& A, const PMatrix& P,
+                         CMatrix& Ac) {
+  KokkosSparse::Impl::spgemm_ptap_numeric_impl(exec, handle, A, P, Ac);
+}
+
+template <class KernelHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_ptap_numeric(KernelHandle* handle, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_ptap_numeric(typename CMatrix::execution_space(), handle, A, P, Ac);
+}
+
+template <class KernelHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_ptap(KernelHandle* handle, const AMatrix& A, const PMatrix& P, CMatrix& Ac) {
+  spgemm_ptap_symbolic(handle, A, P, Ac);
+  spgemm_ptap_numeric(handle, A, P, Ac);
+}
+
+}  // namespace Experimental
+
 }  // namespace KokkosSparse
 
 #endif
@@ -278,6 +278,10 @@ class SPGEMMHandle {
   int mkl_sort_option;
   bool calculate_read_write_cost;
 
+  size_t chunk_memory_budget;  // bytes per row chunk of C in spgemm_chunked, 0 for no limit
+  nnz_lno_t num_chunks;        // number of row chunks used by the last spgemm_chunked
+  int max_live_chunk_handles;  // most chunk handles alive at once in the last spgemm_chunked
+
  public:
   std::string coloring_input_file;
   std::string coloring_output_file;
@@ -303,6 +307,12 @@ class SPGEMMHandle {
   int get_min_hash_size_scale() { return min_hash_size_scale; }
   void set_read_write_cost_calc(bool read_write_cost_cal) { this->calculate_read_write_cost = read_write_cost_cal; }
   int get_read_write_cost_calc() { return this->calculate_read_write_cost; }
+  void set_chunk_memory_budget(size_t bytes) { this->chunk_memory_budget = bytes; }
+  size_t get_chunk_memory_budget() const { return this->chunk_memory_budget; }
+  void set_num_chunks(nnz_lno_t num_chunks_) { this->num_chunks = num_chunks_; }
+  nnz_lno_t get_num_chunks() const { return this->num_chunks; }
+  void set_max_live_chunk_handles(int handles) { this->max_live_chunk_handles = handles; }
+  int get_max_live_chunk_handles() const { return this->max_live_chunk_handles; }
 
   typename Kokkos::View<int *, HandlePersistentMemorySpace> persistent_c_xadj, persistent_a_xadj, persistent_b_xadj,
       persistent_a_adj, persistent_b_adj;
@@ -465,6 +475,9 @@ class SPGEMMHandle {
         multi_color_scale(1),
         mkl_sort_option(7),
         calculate_read_write_cost(false),
+        chunk_memory_budget(0),
+        num_chunks(0),
+        max_live_chunk_handles(0),
         coloring_input_file(""),
         coloring_output_file(""),
         min_hash_size_scale(1),
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <string>
 #include <KokkosKernels_HashmapAccumulator.hpp>
+#include <KokkosKernels_ExecSpaceUtils.hpp>
 
 #ifndef _SPILUKHANDLE_HPP
 #define _SPILUKHANDLE_HPP
@@ -28,8 +29,11 @@ namespace KokkosSparse {
 namespace Experimental {
 
 // TP2 algorithm has issues with some offset-ordinal combo to be addressed
+// SEQLVLSCHD_TP1CHAIN: like SEQLVLSCHD_TP1, but consecutive levels with at
+// most chain_threshold rows are factorized by a single team in one launch
 enum class SPILUKAlgorithm {
-  SEQLVLSCHD_TP1 /*, SEQLVLSCHED_TP2*/
+  SEQLVLSCHD_TP1 /*, SEQLVLSCHED_TP2*/,
+  SEQLVLSCHD_TP1CHAIN
 };
 
 template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace, class TemporaryMemorySpace,
@@ -82,6 +86,7 @@ class SPILUKHandle {
   nnz_lno_view_host_t level_nchunks;        // number of chunks of rows at each level
   nnz_lno_view_host_t level_nrowsperchunk;  // maximum number of rows among chunks at each level
   work_view_t iw;                           // working view for mapping dense indices to sparse indices
+  nnz_lno_view_host_t h_chain_ptr;          // the starting level of each chain of levels
 
   size_type nrows;
   size_type nlevels;
@@ -90,6 +95,9 @@ class SPILUKHandle {
   size_type block_size;
   size_type level_maxrows;          // max. number of rows among levels
   size_type level_maxrowsperchunk;  // max.number of rows among chunks among levels
+  size_type num_chain_entries;      // number of chains of levels
+  nnz_lno_t chain_threshold;        // max. number of rows of a level in a multi-level chain
+  nnz_lno_t rows_per_team;          // number of rows of a level factorized by each team
 
   bool symbolic_complete;
 
@@ -108,6 +116,7 @@ class SPILUKHandle {
         level_nchunks(),
         level_nrowsperchunk(),
         iw(),
+        h_chain_ptr(),
         nrows(nrows_),
         nlevels(0),
         nnzL(nnzL_),
@@ -115,6 +124,9 @@ class SPILUKHandle {
         block_size(block_size_),
         level_maxrows(0),
         level_maxrowsperchunk(0),
+        num_chain_entries(0),
+        chain_threshold(-1),
+        rows_per_team(1),
         symbolic_complete(symbolic_complete_),
         algm(choice),
         team_size(-1),
@@ -133,6 +145,7 @@ class SPILUKHandle {
     }
     set_level_maxrows(0);
     set_level_maxrowsperchunk(0);
+    set_num_chain_entries(0);
     level_list          = nnz_row_view_t("level_list", nrows_);
     level_idx           = nnz_lno_view_t("level_idx", nrows_);
     level_ptr           = nnz_lno_view_t("level_ptr", nrows_ + 1);
@@ -140,6 +153,7 @@ class SPILUKHandle {
     level_nchunks       = nnz_lno_view_host_t();
     level_nrowsperchunk = nnz_lno_view_host_t();
     iw                  = work_view_t();
+    h_chain_ptr         = nnz_lno_view_host_t();
     reset_symbolic_complete();
   }
 
@@ -180,6 +194,34 @@ class SPILUKHandle {
     Kokkos::deep_copy(iw, nnz_lno_t(-1));
   }
 
+  inline nnz_lno_view_host_t get_host_chain_ptr() const { return h_chain_ptr; }
+
+  void alloc_host_chain_ptr(const size_type nlevels_) {
+    h_chain_ptr = nnz_lno_view_host_t("h_chain_ptr", nlevels_ + 1);
+  }
+
+  size_type get_num_chain_entries() const { return num_chain_entries; }
+  void set_num_chain_entries(const size_type num_chain_entries_) { this->num_chain_entries = num_chain_entries_; }
+
+  // Levels with at most this many rows are chained with their neighbors by
+  // SEQLVLSCHD_TP1CHAIN. Must be set before the symbolic phase. The default
+  // (-1) chains single-row levels on GPUs, where a team works through the
+  // chain one row at a time, and levels of up to 32 rows on host backends,
+  // where a kernel launch costs more than factorizing a few short rows.
+  void set_chain_threshold(const nnz_lno_t chain_threshold_) { this->chain_threshold = chain_threshold_; }
+  nnz_lno_t get_chain_threshold() const {
+    if (chain_threshold != -1) return chain_threshold;
+    return KokkosKernels::Impl::is_gpu_exec_space_v<execution_space> ? 1 : 32;
+  }
+
+  // Each team factorizes rows_per_team consecutive rows of a level. Values
+  // larger than 1 cut the number of teams on long levels, which mostly helps
+  // host backends with few threads and many rows per level.
+  void set_rows_per_team(const nnz_lno_t rows_per_team_) {
+    this->rows_per_team = rows_per_team_ > 0 ? rows_per_team_ : 1;
+  }
+  nnz_lno_t get_rows_per_team() const { return rows_per_team; }
+
   KOKKOS_INLINE_FUNCTION
   size_type get_nrows() const { return nrows; }
 
@@ -236,6 +278,7 @@ class SPILUKHandle {
 
   void print_algorithm() {
     if (algm == SPILUKAlgorithm::SEQLVLSCHD_TP1) std::cout << "SEQLVLSCHD_TP1" << std::endl;
+    if (algm == SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN) std::cout << "SEQLVLSCHD_TP1CHAIN" << std::endl;
 
     /*if ( algm == SPILUKAlgorithm::SEQLVLSCHED_TP2 ) {
       std::cout << "SEQLVLSCHED_TP2" << std::endl;;
@@ -26,9 +26,13 @@
 #include "KokkosSparse_spmv_spec.hpp"
 #include "KokkosSparse_spmv_struct_spec.hpp"
 #include "KokkosSparse_spmv_bsrmatrix_spec.hpp"
+#include "KokkosSparse_spmv_sell_impl.hpp"
+#include "KokkosSparse_spmv_multi_values_impl.hpp"
+#include "KokkosSparse_spmv_compressed_impl.hpp"
 #include <type_traits>
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosKernels_Utils.hpp"
 #include "KokkosKernels_Error.hpp"
@@ -219,6 +223,80 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[], const
   XVector_Internal x_i(x);
   YVector_Internal y_i(y);
 
+  // SPMV_AUTOTUNE: time each candidate algorithm on the first non-transposed
+  // calls, then lock in the fastest. Other modes just use the current choice.
+  if (handle->get_impl()->autotune_in_progress() && mode[0] == NoTranspose[0]) {
+    auto* handle_impl = handle->get_impl();
+    auto& tuning      = handle_impl->autotune;
+    if (tuning.candidates.empty()) {
+      // Note: the raw OpenMP kernel is part of SPMV_NATIVE (it is used
+      // whenever A's graph has row_block_offsets), so it needs no entry here.
+      std::vector<SPMVAlgorithm> candidates{SPMV_NATIVE};
+      bool tplAvail;
+      if constexpr (!isBSR) {
+        candidates.push_back(SPMV_NATIVE_MERGE_PATH);
+        if constexpr (XVector::rank() == 1)
+          tplAvail = Impl::spmv_tpl_spec_avail<ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal,
+                                               YVector_Internal>::value;
+        else
+          tplAvail = Impl::spmv_mv_tpl_spec_avail<ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal,
+                                                  YVector_Internal>::value;
+      } else {
+        candidates.push_back(SPMV_BSR_V41);
+        candidates.push_back(SPMV_BSR_V42);
+        if constexpr (XVector::rank() == 1)
+          tplAvail = Impl::spmv_bsrmatrix_tpl_spec_avail<ExecutionSpace, HandleImpl, AMatrix_Internal,
+                                                         XVector_Internal, YVector_Internal>::value;
+        else
+          tplAvail = Impl::spmv_mv_bsrmatrix_tpl_spec_avail<ExecutionSpace, HandleImpl, AMatrix_Internal,
+                                                            XVector_Internal, YVector_Internal>::value;
+      }
+      if (tplAvail) {
+        candidates.push_back(SPMV_DEFAULT);
+        if constexpr (!isBSR) candidates.push_back(SPMV_MERGE_PATH);
+      }
+      tuning.init(candidates);
+    }
+    bool ranTrial = false;
+    if (!tuning.finished) {
+      handle_impl->switch_algorithm(tuning.next_candidate());
+      tuning.in_trial = true;
+      space.fence();
+      Kokkos::Timer timer;
+      spmv(space, handle_impl, mode, alpha, A, x, beta, y);
+      space.fence();
+      tuning.in_trial = false;
+      tuning.record(timer.seconds());
+      ranTrial = true;
+    }
+    if (tuning.finished) handle_impl->switch_algorithm(tuning.best());
+    if (ranTrial) return;
+  }
+
+  // SPMV_COMPRESSED_FP32/FP16: read the reduced precision copy of A (built on
+  // the first call). For real values Op(A) = A in modes N and C; the transposed
+  // modes fall through to the full precision native kernel.
+  if constexpr (!isBSR && Impl::spmv_compressed_supported_v<typename AMatrix::non_const_value_type>) {
+    const SPMVAlgorithm algo = handle->get_algorithm();
+    if ((algo == SPMV_COMPRESSED_FP32 || algo == SPMV_COMPRESSED_FP16) &&
+        (mode[0] == NoTranspose[0] || mode[0] == Conjugate[0])) {
+      using y_scalar_type = typename YVector::non_const_value_type;
+      Kokkos::Profiling::pushRegion(std::string("KokkosSparse::spmv[") + get_spmv_algorithm_name(algo) + "," +
+                                    Kokkos::ArithTraits<typename AMatrix_Internal::non_const_value_type>::name() + "]");
+      if constexpr (XVector::rank() == 1) {
+        Impl::spmv_compressed(space, handle->get_impl(), y_scalar_type(alpha), A_i, x_i, y_scalar_type(beta), y_i);
+      } else {
+        for (size_t j = 0; j < x_i.extent(1); j++) {
+          auto x_j = Kokkos::subview(x_i, Kokkos::ALL(), j);
+          auto y_j = Kokkos::subview(y_i, Kokkos::ALL(), j);
+          Impl::spmv_compressed(space, handle->get_impl(), y_scalar_type(alpha), A_i, x_j, y_scalar_type(beta), y_j);
+        }
+      }
+      Kokkos::Profiling::popRegion();
+      return;
+    }
+  }
+
   bool useNative = is_spmv_algorithm_native(handle->get_algorithm());
 
   // Now call the proper implementation depending on isBSR and the rank of X/Y
@@ -374,6 +452,90 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[], const
   }
 }
 
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply for a sliced ELLPACK matrix.
+/// Computes y := alpha*Op(A)*x + beta*y, where Op(A) is
+/// controlled by mode (see below).
+///
+/// This overload is selected when A is a KokkosSparse::Experimental::SellMatrix
+/// (see crs2sell). The handle must be a SPMVHandle for the same SellMatrix
+/// type, created with SPMV_DEFAULT, SPMV_FAST_SETUP or SPMV_NATIVE. On host
+/// execution spaces the kernel processes a whole chunk of C rows at a time,
+/// with contiguous (SIMD) loads of the chunk's values and column indices.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param handle [in/out] a pointer to a KokkosSparse::SPMVHandle.
+/// \param mode [in] Select A's operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] A rank-1 or rank-2 vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector, with the same rank as x.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class ScalarType, class OrdinalType, class Device,
+          class MemoryTraits, class SizeType, class XVector, class BetaType, class YVector>
+void spmv(const ExecutionSpace& space, Handle* handle, const char mode[], const AlphaType& alpha,
+          const Experimental::SellMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType>& A, const XVector& x,
+          const BetaType& beta, const YVector& y) {
+  using AMatrix = Experimental::SellMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType>;
+  static_assert(Kokkos::is_view<XVector>::value, "KokkosSparse::spmv: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "KokkosSparse::spmv: YVector must be a Kokkos::View.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename AMatrix::memory_space>::accessible,
+                "KokkosSparse::spmv: AMatrix must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible,
+                "KokkosSparse::spmv: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename YVector::memory_space>::accessible,
+                "KokkosSparse::spmv: YVector must be accessible from ExecutionSpace");
+  static_assert(XVector::rank() == YVector::rank(), "KokkosSparse::spmv: Vector ranks do not match.");
+  static_assert(XVector::rank() == size_t(1) || XVector::rank() == size_t(2),
+                "KokkosSparse::spmv: Both Vector inputs must have rank 1 or 2");
+  static_assert(!std::is_const_v<typename YVector::value_type>, "KokkosSparse::spmv: Output Vector must be non-const.");
+  if constexpr (KokkosSparse::Impl::is_spmv_handle_v<Handle>) {
+    static_assert(std::is_same_v<AMatrix, typename Handle::AMatrixType>,
+                  "KokkosSparse::spmv: AMatrix must be identical to Handle::AMatrixType");
+    static_assert(std::is_same_v<XVector, typename Handle::XVectorType>,
+                  "KokkosSparse::spmv: XVector must be identical to Handle::XVectorType");
+    static_assert(std::is_same_v<YVector, typename Handle::YVectorType>,
+                  "KokkosSparse::spmv: YVector must be identical to Handle::YVectorType");
+  }
+  (void)handle;
+
+  const size_t m = A.numRows();
+  const size_t n = A.numCols();
+  const bool noTrans = (mode[0] == NoTranspose[0]) || (mode[0] == Conjugate[0]);
+  if ((x.extent(1) != y.extent(1)) || ((noTrans ? n : m) != x.extent(0)) || ((noTrans ? m : n) != y.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv (SellMatrix): Dimensions do not match: "
+       << ", A: " << m << " x " << n << " (mode " << mode << "), x: " << x.extent(0) << " x " << x.extent(1)
+       << ", y: " << y.extent(0) << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero() || m == 0 || n == 0 || A.nnz() == 0) {
+    if (beta == Kokkos::ArithTraits<BetaType>::zero())
+      Kokkos::deep_copy(space, y, Kokkos::ArithTraits<BetaType>::zero());
+    else
+      KokkosBlas::scal(space, y, beta, y);
+    return;
+  }
+
+  using y_scalar_type = typename YVector::non_const_value_type;
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv[NATIVE,SELL," +
+                                Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() + "]");
+  if constexpr (XVector::rank() == 1) {
+    Impl::spmv_sell(space, mode, y_scalar_type(alpha), A, x, y_scalar_type(beta), y);
+  } else {
+    for (size_t j = 0; j < x.extent(1); j++) {
+      auto x_j = Kokkos::subview(x, Kokkos::ALL(), j);
+      auto y_j = Kokkos::subview(y, Kokkos::ALL(), j);
+      Impl::spmv_sell(space, mode, y_scalar_type(alpha), A, x_j, y_scalar_type(beta), y_j);
+    }
+  }
+  Kokkos::Profiling::popRegion();
+}
+
 // clang-format off
 /// \brief Kokkos sparse matrix-vector multiply.
 ///   Computes y := alpha*Op(A)*x + beta*y, where Op(A) is controlled by mode
@@ -473,6 +635,109 @@ void spmv(const char mode[], const AlphaType& alpha, const AMatrix& A, const XVe
   spmv(typename AMatrix::execution_space(), &handle, mode, alpha, A, x, beta, y);
 }
 
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply for N matrices that share one
+///   graph. Computes Y(:,l) := alpha*Op(A_l)*X(:,l) + beta*Y(:,l) for
+///   l = 0, ..., N-1, where Op(A_l) is controlled by mode (see below).
+///
+/// Entry k of the graph has the value values(k, l) in A_l. All N products are
+/// computed in one sweep over the graph, so rowmap and entries are read once
+/// instead of N times; this is the usual situation for ensembles (e.g.
+/// parameter samples) on a single mesh. values, X and Y are best LayoutRight,
+/// so that the N values of an entry (and of a row of X and Y) are contiguous.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of graph, values, x, and y.
+/// \tparam AlphaType Type of coefficient alpha. Must be convertible to
+///   YVector::value_type.
+/// \tparam ValuesType Type of the values, a rank-2 Kokkos::View (nnz x N)
+/// \tparam XVector Type of x, a rank-2 Kokkos::View (one column per matrix)
+/// \tparam BetaType Type of coefficient beta. Must be convertible to YVector::value_type.
+/// \tparam YVector Type of y, a rank-2 Kokkos::View (one column per matrix)
+///
+/// \param space [in] The execution space instance on which to run the kernel.
+/// \param mode [in] Select the operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrices.
+/// \param graph [in] The graph shared by all matrices, e.g. CrsMatrix::graph.
+/// \param values [in] The values of the N matrices, one column per matrix.
+/// \param x [in] The N vectors to multiply on the left by the matrices.
+/// \param beta [in] Scalar multiplier for the vectors y.
+/// \param y [in/out] The N result vectors.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class OrdinalType, class Layout, class Device, class MemoryTraits,
+          class SizeType, class ValuesType, class XVector, class BetaType, class YVector,
+          typename = std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv(const ExecutionSpace& space, const char mode[], const AlphaType& alpha,
+          const Kokkos::StaticCrsGraph<OrdinalType, Layout, Device, MemoryTraits, SizeType>& graph,
+          const ValuesType& values, const XVector& x, const BetaType& beta, const YVector& y) {
+  static_assert(Kokkos::is_view<ValuesType>::value, "KokkosSparse::spmv: ValuesType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<XVector>::value, "KokkosSparse::spmv: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "KokkosSparse::spmv: YVector must be a Kokkos::View.");
+  static_assert(ValuesType::rank() == 2 && XVector::rank() == 2 && YVector::rank() == 2,
+                "KokkosSparse::spmv: values, x and y must have rank 2 (one column per matrix)");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename Device::memory_space>::accessible,
+                "KokkosSparse::spmv: graph must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename ValuesType::memory_space>::accessible,
+                "KokkosSparse::spmv: values must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible,
+                "KokkosSparse::spmv: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename YVector::memory_space>::accessible,
+                "KokkosSparse::spmv: YVector must be accessible from ExecutionSpace");
+  static_assert(!std::is_const_v<typename YVector::value_type>, "KokkosSparse::spmv: Output Vector must be non-const.");
+
+  const size_t m       = graph.numRows();
+  const size_t nnz     = graph.entries.extent(0);
+  const bool noTrans   = (mode[0] == NoTranspose[0]) || (mode[0] == Conjugate[0]);
+  const size_t xLength = noTrans ? x.extent(0) : m;
+  const size_t yLength = noTrans ? m : y.extent(0);
+  if (values.extent(0) != nnz || values.extent(1) != x.extent(1) || x.extent(1) != y.extent(1) ||
+      xLength != x.extent(0) || yLength != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv (shared graph): Dimensions do not match: graph: " << m << " rows, " << nnz
+       << " entries (mode " << mode << "), values: " << values.extent(0) << " x " << values.extent(1)
+       << ", x: " << x.extent(0) << " x " << x.extent(1) << ", y: " << y.extent(0) << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero() || m == 0 || nnz == 0 || values.extent(1) == 0) {
+    if (beta == Kokkos::ArithTraits<BetaType>::zero())
+      Kokkos::deep_copy(space, y, Kokkos::ArithTraits<BetaType>::zero());
+    else
+      KokkosBlas::scal(space, y, beta, y);
+    return;
+  }
+
+  using y_scalar_type = typename YVector::non_const_value_type;
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv[NATIVE,MultiValues," +
+                                Kokkos::ArithTraits<typename ValuesType::non_const_value_type>::name() + "]");
+  Impl::spmv_multi_values(space, mode, y_scalar_type(alpha), graph.row_map, graph.entries, values, x,
+                          y_scalar_type(beta), y);
+  Kokkos::Profiling::popRegion();
+}
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply for N matrices that share one
+///   graph, on the default instance of the graph's execution space.
+///   Computes Y(:,l) := alpha*Op(A_l)*X(:,l) + beta*Y(:,l) for l = 0, ..., N-1.
+///
+/// \param mode [in] Select the operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrices.
+/// \param graph [in] The graph shared by all matrices, e.g. CrsMatrix::graph.
+/// \param values [in] The values of the N matrices, one column per matrix.
+/// \param x [in] The N vectors to multiply on the left by the matrices.
+/// \param beta [in] Scalar multiplier for the vectors y.
+/// \param y [in/out] The N result vectors.
+// clang-format on
+template <class AlphaType, class OrdinalType, class Layout, class Device, class MemoryTraits, class SizeType,
+          class ValuesType, class XVector, class BetaType, class YVector>
+void spmv(const char mode[], const AlphaType& alpha,
+          const Kokkos::StaticCrsGraph<OrdinalType, Layout, Device, MemoryTraits, SizeType>& graph,
+          const ValuesType& values, const XVector& x, const BetaType& beta, const YVector& y) {
+  spmv(typename Device::execution_space(), mode, alpha, graph, values, x, beta, y);
+}
+
 namespace Experimental {
 
 template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector, class BetaType, class YVector>
@@ -0,0 +1,176 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file
+/// \brief Sparse matrix-vector multiply fused with the vector operations that
+///   typically follow it in a Krylov iteration
+///
+/// Calling KokkosSparse::spmv and then KokkosBlas::dot or KokkosBlas::axpby
+/// reads y (and x) again after the spmv has written it. The kernels here do
+/// the vector operation on each entry of y as soon as it is computed.
+
+#ifndef KOKKOSSPARSE_SPMV_FUSED_HPP_
+#define KOKKOSSPARSE_SPMV_FUSED_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+namespace Impl {
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+void check_spmv_fused_args(const char name[], const char mode[], const AMatrix& A, const XVector& x,
+                           const YVector& y) {
+  static_assert(KokkosSparse::is_crs_matrix_v<AMatrix>, "KokkosSparse::spmv_fused: A must be a CrsMatrix.");
+  static_assert(Kokkos::is_view<XVector>::value, "KokkosSparse::spmv_fused: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "KokkosSparse::spmv_fused: YVector must be a Kokkos::View.");
+  static_assert(XVector::rank() == 1 && YVector::rank() == 1, "KokkosSparse::spmv_fused: x and y must have rank 1.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename AMatrix::memory_space>::accessible,
+                "KokkosSparse::spmv_fused: AMatrix must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible,
+                "KokkosSparse::spmv_fused: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename YVector::memory_space>::accessible,
+                "KokkosSparse::spmv_fused: YVector must be accessible from ExecutionSpace");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv_fused: Output Vector must be non-const.");
+
+  if (mode[0] != NoTranspose[0] && mode[0] != Conjugate[0]) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": Invalid mode " << mode << " (only \"N\" and \"C\" are supported)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (static_cast<size_t>(A.numCols()) != x.extent(0) || static_cast<size_t>(A.numRows()) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": Dimensions do not match: "
+       << ", A: " << A.numRows() << " x " << A.numCols() << ", x: " << x.extent(0) << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+
+// clang-format off
+/// \brief Sparse matrix-vector multiply fused with two inner products:
+///   y := alpha*Op(A)*x, dots(0) := <x, y>, dots(1) := <y, y>
+///   where <a, b> = sum_i conj(a_i)*b_i as in KokkosBlas::dot.
+///
+/// The inner products are computed in the same reduction as y, so x and y are
+/// not read again. When dots is not host accessible, the call returns without
+/// waiting for the result, as for Kokkos::parallel_reduce into a View.
+///
+/// \tparam ExecutionSpace A Kokkos execution space
+/// \tparam AMatrix A KokkosSparse::CrsMatrix, square
+/// \tparam XVector Type of x, a rank-1 Kokkos::View
+/// \tparam YVector Type of y, a nonconst rank-1 Kokkos::View
+/// \tparam DotsView Type of dots, a rank-1 Kokkos::View of length 2
+///
+/// \param space [in] The execution space instance on which to run the kernel.
+/// \param mode [in] "N" for normal or "C" for conjugate.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix.
+/// \param x [in] The vector to multiply on the left by A.
+/// \param y [out] Result vector.
+/// \param dots [out] <x, y> and <y, y>.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector, class YVector, class DotsView,
+          typename = std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv_dot(const ExecutionSpace& space, const char mode[], const AlphaType& alpha, const AMatrix& A,
+              const XVector& x, const YVector& y, const DotsView& dots) {
+  Impl::check_spmv_fused_args<ExecutionSpace>("spmv_dot", mode, A, x, y);
+  static_assert(Kokkos::is_view<DotsView>::value && DotsView::rank() == 1,
+                "KokkosSparse::spmv_dot: dots must be a rank-1 Kokkos::View.");
+  static_assert(std::is_same_v<typename DotsView::value_type, typename YVector::non_const_value_type>,
+                "KokkosSparse::spmv_dot: dots must have the (nonconst) value type of y.");
+  if (A.numRows() != A.numCols() || dots.extent(0) != 2) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_dot: A must be square and dots must have length 2: "
+       << ", A: " << A.numRows() << " x " << A.numCols() << ", dots: " << dots.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using y_scalar_type = typename YVector::non_const_value_type;
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv_dot[NATIVE]");
+  KokkosSparse::Impl::spmv_dot(space, mode, y_scalar_type(alpha), A, x, y, dots);
+  Kokkos::Profiling::popRegion();
+}
+
+/// \brief Same as above, on the default instance of the execution space of A.
+template <class AlphaType, class AMatrix, class XVector, class YVector, class DotsView>
+void spmv_dot(const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x, const YVector& y,
+              const DotsView& dots) {
+  spmv_dot(typename AMatrix::execution_space(), mode, alpha, A, x, y, dots);
+}
+
+// clang-format off
+/// \brief Sparse matrix-vector multiply fused with an update of another vector:
+///   y := alpha*Op(A)*x, z := b*z + a*y
+///
+/// As in KokkosBlas::axpby, b == 0 overwrites z, even if it contains NaN.
+///
+/// \tparam ExecutionSpace A Kokkos execution space
+/// \tparam AMatrix A KokkosSparse::CrsMatrix
+/// \tparam XVector Type of x, a rank-1 Kokkos::View
+/// \tparam YVector Type of y, a nonconst rank-1 Kokkos::View
+/// \tparam ZVector Type of z, a nonconst rank-1 Kokkos::View
+///
+/// \param space [in] The execution space instance on which to run the kernel.
+/// \param mode [in] "N" for normal or "C" for conjugate.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix.
+/// \param x [in] The vector to multiply on the left by A.
+/// \param y [out] Result vector.
+/// \param a [in] Scalar multiplier for y.
+/// \param b [in] Scalar multiplier for z.
+/// \param z [in/out] The updated vector, with the length of y.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector, class YVector, class AType, class BType,
+          class ZVector, typename = std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv_axpby(const ExecutionSpace& space, const char mode[], const AlphaType& alpha, const AMatrix& A,
+                const XVector& x, const YVector& y, const AType& a, const BType& b, const ZVector& z) {
+  Impl::check_spmv_fused_args<ExecutionSpace>("spmv_axpby", mode, A, x, y);
+  static_assert(Kokkos::is_view<ZVector>::value && ZVector::rank() == 1,
+                "KokkosSparse::spmv_axpby: z must be a rank-1 Kokkos::View.");
+  static_assert(!std::is_const_v<typename ZVector::value_type>, "KokkosSparse::spmv_axpby: z must be non-const.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename ZVector::memory_space>::accessible,
+                "KokkosSparse::spmv_axpby: ZVector must be accessible from ExecutionSpace");
+  if (z.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_axpby: Dimensions do not match: y: " << y.extent(0) << ", z: " << z.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using y_scalar_type = typename YVector::non_const_value_type;
+  using z_scalar_type = typename ZVector::non_const_value_type;
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv_axpby[NATIVE]");
+  KokkosSparse::Impl::spmv_axpby(space, mode, y_scalar_type(alpha), A, x, y, z_scalar_type(a), z_scalar_type(b), z);
+  Kokkos::Profiling::popRegion();
+}
+
+/// \brief Same as above, on the default instance of the execution space of A.
+template <class AlphaType, class AMatrix, class XVector, class YVector, class AType, class BType, class ZVector>
+void spmv_axpby(const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x, const YVector& y,
+                const AType& a, const BType& b, const ZVector& z) {
+  spmv_axpby(typename AMatrix::execution_space(), mode, alpha, A, x, y, a, b, z);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_FUSED_HPP_
@@ -17,9 +17,13 @@
 #ifndef KOKKOSSPARSE_SPMV_HANDLE_HPP_
 #define KOKKOSSPARSE_SPMV_HANDLE_HPP_
 
+#include <limits>
+#include <vector>
 #include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
 // Use TPL utilities for safely finalizing matrix descriptors, etc.
 #include "KokkosSparse_Utils_cusparse.hpp"
 #include "KokkosSparse_Utils_rocsparse.hpp"
@@ -43,7 +47,13 @@ enum SPMVAlgorithm {
                            /// path. For CrsMatrix only.
   SPMV_BSR_V41,            /// Use experimental version 4.1 algorithm (for BsrMatrix only)
   SPMV_BSR_V42,            /// Use experimental version 4.2 algorithm (for BsrMatrix only)
-  SPMV_BSR_TC              /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_BSR_TC,             /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_AUTOTUNE,           /// Time the applicable algorithms on the first few calls,
+                           /// then keep using the fastest one.
+  SPMV_COMPRESSED_FP32,    /// Read a copy of A with float values and 16-bit column
+                           /// offsets, accumulating in double. For real CrsMatrix only.
+  SPMV_COMPRESSED_FP16     /// Same as SPMV_COMPRESSED_FP32, with half_t values if they
+                           /// fit in half_t's range, and float values otherwise.
 };
 
 namespace Experimental {
@@ -66,6 +76,9 @@ inline const char* get_spmv_algorithm_name(SPMVAlgorithm a) {
     case SPMV_BSR_V41: return "SPMV_BSR_V41";
     case SPMV_BSR_V42: return "SPMV_BSR_V42";
     case SPMV_BSR_TC: return "SPMV_BSR_TC";
+    case SPMV_AUTOTUNE: return "SPMV_AUTOTUNE";
+    case SPMV_COMPRESSED_FP32: return "SPMV_COMPRESSED_FP32";
+    case SPMV_COMPRESSED_FP16: return "SPMV_COMPRESSED_FP16";
   }
   throw std::invalid_argument("SPMVHandle::get_algorithm_name: unknown algorithm");
   return "<Unknown>";
@@ -79,8 +92,10 @@ inline bool is_spmv_algorithm_native(SPMVAlgorithm a) {
     case SPMV_NATIVE_MERGE_PATH:
     case SPMV_BSR_V41:
     case SPMV_BSR_V42:
-    case SPMV_BSR_TC: return true;
-    // DEFAULT, FAST_SETUP and MERGE_PATH may call TPLs
+    case SPMV_BSR_TC:
+    case SPMV_COMPRESSED_FP32:
+    case SPMV_COMPRESSED_FP16: return true;
+    // DEFAULT, FAST_SETUP, MERGE_PATH and AUTOTUNE may call TPLs
     default: return false;
   }
 }
@@ -214,6 +229,80 @@ struct OneMKL_SpMV_Data : public TPL_SpMV_Data<Kokkos::Experimental::SYCL> {
 #endif
 #endif
 
+/// State of the SPMV_AUTOTUNE mode. Each candidate algorithm is run
+/// trials_per_candidate times in a row and its fastest run is recorded, so a
+/// TPL's setup (done on the first call after switching algorithms) is only
+/// part of the first trial. After all trials have been made, the candidate
+/// with the lowest time wins.
+struct SPMVAutotuneData {
+  bool enabled  = false;
+  bool finished = false;
+  // True while a timed trial is being executed (prevents recursive tuning)
+  bool in_trial            = false;
+  int trials_per_candidate = 3;
+  int num_trials           = 0;
+  std::vector<SPMVAlgorithm> candidates;
+  // Best observed time (seconds) for each entry of candidates
+  std::vector<double> best_times;
+
+  /// Begin tuning with the given candidates. If there is only one candidate,
+  /// there is nothing to compare and tuning finishes immediately.
+  void init(const std::vector<SPMVAlgorithm>& candidates_) {
+    candidates = candidates_;
+    best_times.assign(candidates.size(), std::numeric_limits<double>::max());
+    num_trials = 0;
+    finished   = candidates.size() < size_t(2) || trials_per_candidate < 1;
+  }
+
+  /// Algorithm to time on the next call
+  SPMVAlgorithm next_candidate() const { return candidates[num_trials / trials_per_candidate]; }
+
+  /// Record the time of the trial started by the last next_candidate(), and
+  /// return the winning algorithm if this was the last trial.
+  void record(double seconds) {
+    size_t c = num_trials / trials_per_candidate;
+    if (seconds < best_times[c]) best_times[c] = seconds;
+    num_trials++;
+    if (num_trials >= trials_per_candidate * int(candidates.size())) finished = true;
+  }
+
+  /// The candidate with the lowest recorded time
+  SPMVAlgorithm best() const {
+    size_t b = 0;
+    for (size_t c = 1; c < candidates.size(); c++) {
+      if (best_times[c] < best_times[b]) b = c;
+    }
+    return candidates[b];
+  }
+};
+
+/// Whether SPMV_COMPRESSED_FP32/FP16 can be used with matrix entries of type
+/// Scalar: the values are rounded to a real floating point type.
+template <class Scalar>
+inline constexpr bool spmv_compressed_supported_v =
+    !Kokkos::ArithTraits<Scalar>::is_complex && !std::is_integral_v<Scalar>;
+
+/// Reduced precision copy of a CrsMatrix read by SPMV_COMPRESSED_FP32/FP16,
+/// built by the first spmv. The rows are split into blocks of block_rows
+/// rows; entry k of a block has column block_base(b) + col_offsets(k). The
+/// columns of a wide block (block_wide(b) == 1) span more than 2^16, so they
+/// are read from the matrix's own entries instead.
+template <class MemorySpace, class Ordinal>
+struct SPMVCompressedData {
+  static constexpr int block_rows = 16;
+
+  bool built = false;
+  // the values are in values_fp32: for SPMV_COMPRESSED_FP32, or for
+  // SPMV_COMPRESSED_FP16 when they are out of half_t's range
+  bool use_fp32 = false;
+  Kokkos::View<float*, MemorySpace> values_fp32;
+  Kokkos::View<Kokkos::Experimental::half_t*, MemorySpace> values_fp16;
+  Kokkos::View<uint16_t*, MemorySpace> col_offsets;
+  Kokkos::View<Ordinal*, MemorySpace> block_base;
+  Kokkos::View<uint8_t*, MemorySpace> block_wide;
+  Ordinal num_wide_blocks = 0;
+};
+
 template <class ExecutionSpace, class MemorySpace, class Scalar, class Offset, class Ordinal>
 struct SPMVHandleImpl {
   using ExecutionSpaceType = ExecutionSpace;
@@ -226,7 +315,9 @@ struct SPMVHandleImpl {
   static_assert(!std::is_const_v<Scalar>, "SPMVHandleImpl: Scalar must not be a const type");
   static_assert(!std::is_const_v<Offset>, "SPMVHandleImpl: Offset must not be a const type");
   static_assert(!std::is_const_v<Ordinal>, "SPMVHandleImpl: Ordinal must not be a const type");
-  SPMVHandleImpl(SPMVAlgorithm algo_) : algo(algo_) {}
+  SPMVHandleImpl(SPMVAlgorithm algo_) : algo(algo_ == SPMV_AUTOTUNE ? SPMV_NATIVE : algo_) {
+    autotune.enabled = algo_ == SPMV_AUTOTUNE;
+  }
   ~SPMVHandleImpl() {
     if (tpl_rank1) delete tpl_rank1;
     if (tpl_rank2) delete tpl_rank2;
@@ -237,7 +328,22 @@ struct SPMVHandleImpl {
   /// Get the SPMVAlgorithm used by this handle
   SPMVAlgorithm get_algorithm() const { return this->algo; }
 
-  const SPMVAlgorithm algo                 = SPMV_DEFAULT;
+  /// Switch the algorithm run by later calls (used by SPMV_AUTOTUNE). The TPL
+  /// data is created for one algorithm: the TPL's algorithm and its buffer are
+  /// chosen then. So it is freed here, and the next TPL call creates it again.
+  void switch_algorithm(SPMVAlgorithm new_algo) {
+    if (new_algo == algo) return;
+    if (tpl_rank1) delete tpl_rank1;
+    if (tpl_rank2) delete tpl_rank2;
+    tpl_rank1 = nullptr;
+    tpl_rank2 = nullptr;
+    algo      = new_algo;
+  }
+
+  /// Whether the next non-transposed spmv call should be a timed trial
+  bool autotune_in_progress() const { return autotune.enabled && !autotune.finished && !autotune.in_trial; }
+
+  SPMVAutotuneData autotune;
   TPL_SpMV_Data<ExecutionSpace>* tpl_rank1 = nullptr;
   TPL_SpMV_Data<ExecutionSpace>* tpl_rank2 = nullptr;
   // Expert tuning parameters for native SpMV
@@ -250,6 +356,13 @@ struct SPMVHandleImpl {
   bool force_dynamic_schedule = false;
   KokkosSparse::Experimental::Bsr_TC_Precision bsr_tc_precision =
       KokkosSparse::Experimental::Bsr_TC_Precision::Automatic;
+  SPMVCompressedData<MemorySpace, Ordinal> compressed;
+
+ private:
+  // The algorithm actually executed. This is only modified by SPMV_AUTOTUNE,
+  // through switch_algorithm, which switches between candidates and finally
+  // locks in the fastest one.
+  SPMVAlgorithm algo = SPMV_DEFAULT;
 };
 }  // namespace Impl
 
@@ -261,8 +374,8 @@ struct SPMVHandleImpl {
 /// \tparam DeviceType A Kokkos::Device or execution space where the spmv computation will be run.
 ///    Does not necessarily need to match AMatrix's device type, but its execution space needs to be able
 ///    to access the memory spaces of AMatrix, XVector and YVector.
-/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix or
-/// KokkosSparse::BsrMatrix.
+/// \tparam AMatrix A specialization of KokkosSparse::CrsMatrix,
+/// KokkosSparse::BsrMatrix or KokkosSparse::Experimental::SellMatrix.
 ///
 /// SPMVHandle's internal resources are lazily allocated and initialized by the first
 /// spmv call.
@@ -275,6 +388,20 @@ struct SPMVHandleImpl {
 ///
 /// \warning However, all calls to spmv with a given instance of SPMVHandle must use the
 /// same matrix.
+///
+/// If the handle is created with SPMV_AUTOTUNE, the first non-transposed spmv calls each run
+/// one of the algorithms applicable to AMatrix (the native kernel, native merge path and, if a
+/// TPL implementation is available, the TPL), timing it with a fence before and after. After
+/// get_autotune_trials() runs of every candidate, the fastest one is used for all later calls.
+///
+/// If the handle is created with SPMV_COMPRESSED_FP32 or SPMV_COMPRESSED_FP16, the first spmv
+/// stores a copy of A's values in float (or half_t) and its column indices as 16-bit offsets
+/// from a base column per block of rows. Non-transposed spmv calls then read about half the bytes
+/// per entry of the double precision matrix, and accumulate each row in double. The results are
+/// only as accurate as the rounded values; transposed modes use the full precision kernel. Call
+/// reset_compressed() after changing A's values. With SPMV_COMPRESSED_FP16, if a nonzero of A is
+/// larger than the largest half_t (65504) or would round to zero in half_t, the values are stored
+/// in float instead.
 // clang-format on
 
 template <class DeviceType, class AMatrix, class XVector, class YVector>
@@ -294,9 +421,10 @@ struct SPMVHandle
   // NOTE: we do not require that ExecutionSpace matches
   // AMatrix::execution_space. For example, if the matrix's device is <Cuda,
   // CudaHostPinnedSpace> it is allowed to run spmv on Serial.
-  static_assert(is_crs_matrix_v<AMatrix> || Experimental::is_bsr_matrix_v<AMatrix>,
-                "SPMVHandle: AMatrix must be a specialization of CrsMatrix or "
-                "BsrMatrix.");
+  static_assert(is_crs_matrix_v<AMatrix> || Experimental::is_bsr_matrix_v<AMatrix> ||
+                    Experimental::is_sell_matrix_v<AMatrix>,
+                "SPMVHandle: AMatrix must be a specialization of CrsMatrix, "
+                "BsrMatrix or SellMatrix.");
   static_assert(Kokkos::is_view<XVector>::value, "SPMVHandle: XVector must be a Kokkos::View.");
   static_assert(Kokkos::is_view<YVector>::value, "SPMVHandle: YVector must be a Kokkos::View.");
   static_assert(XVector::rank() == YVector::rank(), "SPMVHandle: ranks of XVector and YVector must match.");
@@ -323,12 +451,34 @@ struct SPMVHandle
         case SPMV_BSR_TC:
           throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(get_algorithm()) +
                                       " cannot be used if A is a CrsMatrix");
+        case SPMV_COMPRESSED_FP32:
+        case SPMV_COMPRESSED_FP16:
+          if (!Impl::spmv_compressed_supported_v<typename AMatrixType::non_const_value_type>)
+            throw std::invalid_argument(std::string("SPMVHandle: algorithm ") +
+                                        get_spmv_algorithm_name(get_algorithm()) +
+                                        " requires a CrsMatrix with real floating point values");
+          break;
         default:;
       }
+    } else if constexpr (Experimental::is_sell_matrix_v<AMatrixType>) {
+      // SellMatrix has a single (native) implementation, so there is nothing
+      // to tune
+      if (this->autotune.enabled)
+        throw std::invalid_argument("SPMVHandle: algorithm SPMV_AUTOTUNE cannot be used if A is a SellMatrix");
+      switch (get_algorithm()) {
+        case SPMV_DEFAULT:
+        case SPMV_FAST_SETUP:
+        case SPMV_NATIVE: break;
+        default:
+          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(get_algorithm()) +
+                                      " cannot be used if A is a SellMatrix");
+      }
     } else {
       switch (get_algorithm()) {
         case SPMV_MERGE_PATH:
         case SPMV_NATIVE_MERGE_PATH:
+        case SPMV_COMPRESSED_FP32:
+        case SPMV_COMPRESSED_FP16:
           throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(get_algorithm()) +
                                       " cannot be used if A is a BsrMatrix");
         default:;
@@ -336,14 +486,46 @@ struct SPMVHandle
     }
   }
 
-  /// Get the SPMVAlgorithm used by this handle
+  /// Get the SPMVAlgorithm used by this handle. If the handle was created with
+  /// SPMV_AUTOTUNE, this is the algorithm selected so far (the winner once
+  /// is_autotune_finished() returns true).
   SPMVAlgorithm get_algorithm() const {
     // Note: get_algorithm is also a method of parent ImplType, but for
     // documentation purposes it should appear directly in the public interface
     // of SPMVHandle
-    return this->algo;
+    return ImplType::get_algorithm();
   }
 
+  /// Whether this handle was created with SPMV_AUTOTUNE
+  bool is_autotuned() const { return this->autotune.enabled; }
+
+  /// Whether autotuning has selected its final algorithm
+  bool is_autotune_finished() const { return this->autotune.enabled && this->autotune.finished; }
+
+  /// Set the number of timed runs per candidate algorithm (default 3). The
+  /// fastest run of each candidate is compared, so at least 2 trials are
+  /// needed to exclude one-time setup costs (e.g. TPL analysis) from the
+  /// timings. Must be called before the first spmv with this handle.
+  void set_autotune_trials(int trials) {
+    if (!this->autotune.candidates.empty())
+      throw std::runtime_error("SPMVHandle::set_autotune_trials: autotuning has already started");
+    this->autotune.trials_per_candidate = trials;
+  }
+
+  /// Get the number of timed runs per candidate algorithm
+  int get_autotune_trials() const { return this->autotune.trials_per_candidate; }
+
+  /// Get the algorithms considered by autotuning (empty until the first spmv)
+  const std::vector<SPMVAlgorithm>& get_autotune_candidates() const { return this->autotune.candidates; }
+
+  /// Get the best time in seconds measured for each of get_autotune_candidates()
+  const std::vector<double>& get_autotune_timings() const { return this->autotune.best_times; }
+
+  /// With SPMV_COMPRESSED_FP32 or SPMV_COMPRESSED_FP16, rebuild the reduced
+  /// precision copy of A on the next spmv. The copy is made by the first spmv
+  /// with this handle, so this must be called after A's values change.
+  void reset_compressed() { this->compressed.built = false; }
+
   /// Get pointer to this as the impl type
   ImplType* get_impl() { return static_cast<ImplType*>(this); }
 };
@@ -0,0 +1,236 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_matrix_free.hpp
+/// \brief Sparse matrix-vector multiply with a stencil operator whose
+///   coefficients are computed on the fly
+///
+/// For a stencil on a structured grid, the column indices of a row follow
+/// from the grid coordinates of the row, and the coefficients are often a
+/// cheap function of the coordinates (or constant). Storing them in a
+/// CrsMatrix makes spmv read about 12 to 16 bytes per nonzero that the
+/// kernel could compute instead; with a StencilOperator spmv only streams x
+/// and y.
+
+#ifndef KOKKOSSPARSE_SPMV_MATRIX_FREE_HPP_
+#define KOKKOSSPARSE_SPMV_MATRIX_FREE_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_matrix_free_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class StencilOperator
+/// \brief Matrix-free operator of a stencil on a structured grid, usable in
+///   place of a CrsMatrix with KokkosSparse::spmv and
+///   KokkosSparse::Experimental::gmres.
+///
+/// \tparam Stencil A copyable functor describing the stencil. It must provide
+///   - <tt>value_type</tt>, the type of the coefficients,
+///   - <tt>static constexpr int num_entries</tt>, the number of points of the
+///     stencil,
+///   - <tt>KOKKOS_INLINE_FUNCTION void offset(int e, int& di, int& dj, int& dk)
+///     const</tt>, the offset of point e from the center, and
+///   - <tt>KOKKOS_INLINE_FUNCTION value_type coefficient(OrdinalType i,
+///     OrdinalType j, OrdinalType k, int e) const</tt>, the coefficient of
+///     point e in the row of grid point (i, j, k).
+/// \tparam OrdinalType The type of the grid coordinates.
+/// \tparam Device The Kokkos Device type.
+///
+/// Grid point (i, j, k) is row <tt>i + ni*(j + nj*k)</tt>, the same
+/// numbering as spmv_struct. Points of the stencil that fall outside of the
+/// grid are dropped, i.e. the grid has homogeneous Dirichlet boundaries. As
+/// in spmv_struct, the interior points run without bounds checks, and only
+/// the points within the halo of the boundary check their neighbors.
+template <class Stencil, class OrdinalType, class Device>
+class StencilOperator {
+ public:
+  using stencil_type           = Stencil;
+  using value_type             = typename Stencil::value_type;
+  using non_const_value_type   = std::remove_const_t<value_type>;
+  using const_value_type       = const non_const_value_type;
+  using ordinal_type           = OrdinalType;
+  using non_const_ordinal_type = std::remove_const_t<OrdinalType>;
+  using const_ordinal_type     = const non_const_ordinal_type;
+  using device_type            = Device;
+  using execution_space        = typename Device::execution_space;
+  using memory_space           = typename Device::memory_space;
+  using size_type              = typename Kokkos::View<OrdinalType*, Device>::size_type;
+
+  /// \brief Operator on a grid of structure(0) x structure(1) x
+  ///   structure(2) points; structure has 1 to 3 entries, and the missing
+  ///   dimensions are 1.
+  StencilOperator(const Kokkos::View<OrdinalType*, Kokkos::HostSpace>& structure, const Stencil& stencil_)
+      : stencil(stencil_) {
+    const size_t dim = structure.extent(0);
+    if (dim < 1 || dim > 3) {
+      std::ostringstream os;
+      os << "KokkosSparse::StencilOperator: structure must have 1 to 3 entries, got " << dim;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    init(structure(0), dim > 1 ? structure(1) : 1, dim > 2 ? structure(2) : 1);
+  }
+
+  /// \brief Operator on a grid of ni x nj x nk points
+  StencilOperator(const OrdinalType ni_, const OrdinalType nj_, const OrdinalType nk_, const Stencil& stencil_)
+      : stencil(stencil_) {
+    init(ni_, nj_, nk_);
+  }
+
+  //! The number of rows (grid points).
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return ni * nj * nk; }
+  //! The number of columns, equal to the number of rows.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numRows(); }
+  //! The number of rows; a stencil operator has 1 x 1 blocks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numRows(); }
+  //! The number of columns; a stencil operator has 1 x 1 blocks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numCols(); }
+
+  //! The stencil functor.
+  KOKKOS_INLINE_FUNCTION const Stencil& getStencil() const { return stencil; }
+
+  //! The grid dimensions
+  OrdinalType ni, nj, nk;
+  //! The largest stencil offsets in each dimension
+  OrdinalType hi, hj, hk;
+
+ private:
+  Stencil stencil;
+
+  void init(const OrdinalType ni_, const OrdinalType nj_, const OrdinalType nk_) {
+    if (ni_ < 0 || nj_ < 0 || nk_ < 0) {
+      std::ostringstream os;
+      os << "KokkosSparse::StencilOperator: invalid grid " << ni_ << " x " << nj_ << " x " << nk_;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    ni = ni_;
+    nj = nj_;
+    nk = nk_;
+    hi = hj = hk = 0;
+    for (int e = 0; e < Stencil::num_entries; e++) {
+      int di = 0, dj = 0, dk = 0;
+      stencil.offset(e, di, dj, dk);
+      hi = Kokkos::max(hi, OrdinalType(Kokkos::abs(di)));
+      hj = Kokkos::max(hj, OrdinalType(Kokkos::abs(dj)));
+      hk = Kokkos::max(hk, OrdinalType(Kokkos::abs(dk)));
+    }
+  }
+};
+
+template <typename>
+struct is_stencil_operator : public std::false_type {};
+template <typename... P>
+struct is_stencil_operator<StencilOperator<P...>> : public std::true_type {};
+template <typename... P>
+struct is_stencil_operator<const StencilOperator<P...>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_stencil_operator_v = is_stencil_operator<T>::value;
+
+}  // namespace Experimental
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply with a stencil operator.
+///   Computes y := alpha*A*x + beta*y.
+///
+/// The coefficients of A are computed by the stencil functor while the rows
+/// are processed, so only x and y are read from memory. The operator is not
+/// stored, so only mode "N" is supported; for a symmetric stencil it is also
+/// the transpose.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param mode [in] Must be "N".
+/// \param alpha [in] Scalar multiplier for the operator A.
+/// \param A [in] The stencil operator A.
+/// \param x [in] A rank-1 or rank-2 vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector, with the same rank as x.
+// clang-format on
+template <class ExecutionSpace, class AlphaType, class Stencil, class OrdinalType, class Device, class XVector,
+          class BetaType, class YVector,
+          typename = std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>>
+void spmv(const ExecutionSpace& space, const char mode[], const AlphaType& alpha,
+          const Experimental::StencilOperator<Stencil, OrdinalType, Device>& A, const XVector& x,
+          const BetaType& beta, const YVector& y) {
+  using AMatrix = Experimental::StencilOperator<Stencil, OrdinalType, Device>;
+  static_assert(Kokkos::is_view<XVector>::value, "KokkosSparse::spmv: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "KokkosSparse::spmv: YVector must be a Kokkos::View.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename AMatrix::memory_space>::accessible,
+                "KokkosSparse::spmv: AMatrix must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible,
+                "KokkosSparse::spmv: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename YVector::memory_space>::accessible,
+                "KokkosSparse::spmv: YVector must be accessible from ExecutionSpace");
+  static_assert(XVector::rank() == YVector::rank(), "KokkosSparse::spmv: Vector ranks do not match.");
+  static_assert(XVector::rank() == size_t(1) || XVector::rank() == size_t(2),
+                "KokkosSparse::spmv: Both Vector inputs must have rank 1 or 2");
+  static_assert(!std::is_const_v<typename YVector::value_type>, "KokkosSparse::spmv: Output Vector must be non-const.");
+
+  if (mode[0] != NoTranspose[0]) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv (StencilOperator): Invalid mode " << mode << " (only \"N\" is supported)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  const size_t m = A.numRows();
+  if ((x.extent(1) != y.extent(1)) || (m != x.extent(0)) || (m != y.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv (StencilOperator): Dimensions do not match: "
+       << ", A: " << m << " x " << m << ", x: " << x.extent(0) << " x " << x.extent(1) << ", y: " << y.extent(0)
+       << " x " << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (m == 0) return;
+
+  using y_scalar_type = typename YVector::non_const_value_type;
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv[NATIVE,STENCIL," +
+                                Kokkos::ArithTraits<typename AMatrix::non_const_value_type>::name() + "]");
+  if constexpr (XVector::rank() == 1) {
+    Impl::spmv_matrix_free(space, y_scalar_type(alpha), A.getStencil(), A.ni, A.nj, A.nk, A.hi, A.hj, A.hk, x,
+                           y_scalar_type(beta), y);
+  } else {
+    for (size_t j = 0; j < x.extent(1); j++) {
+      auto x_j = Kokkos::subview(x, Kokkos::ALL(), j);
+      auto y_j = Kokkos::subview(y, Kokkos::ALL(), j);
+      Impl::spmv_matrix_free(space, y_scalar_type(alpha), A.getStencil(), A.ni, A.nj, A.nk, A.hi, A.hj, A.hk, x_j,
+                             y_scalar_type(beta), y_j);
+    }
+  }
+  Kokkos::Profiling::popRegion();
+}
+
+// clang-format off
+/// \brief Kokkos sparse matrix-vector multiply with a stencil operator, on
+///   the default instance of the operator's execution space.
+///   Computes y := alpha*A*x + beta*y.
+// clang-format on
+template <class AlphaType, class Stencil, class OrdinalType, class Device, class XVector, class BetaType,
+          class YVector>
+void spmv(const char mode[], const AlphaType& alpha,
+          const Experimental::StencilOperator<Stencil, OrdinalType, Device>& A, const XVector& x,
+          const BetaType& beta, const YVector& y) {
+  spmv(typename Device::execution_space(), mode, alpha, A, x, beta, y);
+}
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_MATRIX_FREE_HPP_
@@ -0,0 +1,33 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSPARSE_CG_TPL_SPEC_AVAIL_HPP_
+#define KOKKOSPARSE_CG_TPL_SPEC_AVAIL_HPP_
+
+namespace KokkosSparse {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class KernelHandle, class AT, class AO, class AD, class AM, class AS, class BType, class XType>
+struct cg_tpl_spec_avail {
+  enum : bool { value = false };
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
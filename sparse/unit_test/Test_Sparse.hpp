@@ -32,10 +32,15 @@
 #include "Test_Sparse_SortCrs.hpp"
 #include "Test_Sparse_spiluk.hpp"
 #include "Test_Sparse_spmv.hpp"
+#include "Test_Sparse_spmv_sell.hpp"
+#include "Test_Sparse_spmv_multi_values.hpp"
+#include "Test_Sparse_spmv_fused.hpp"
+#include "Test_Sparse_spmv_matrix_free.hpp"
 #include "Test_Sparse_sptrsv.hpp"
 #include "Test_Sparse_trsv.hpp"
 #include "Test_Sparse_par_ilut.hpp"
 #include "Test_Sparse_gmres.hpp"
+#include "Test_Sparse_cg.hpp"
 #include "Test_Sparse_Transpose.hpp"
 #include "Test_Sparse_TestUtils_RandCsMat.hpp"
 #include "Test_Sparse_IOUtils.hpp"
@@ -162,6 +162,109 @@ struct TestIOUtils {
     }
   }
 
+  static void binary_test(const std::vector<std::vector<scalar_t>>& fixture, const std::string& filename_root) {
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    compress_matrix(row_map, entries, values, fixture);
+    sp_matrix_type A("A", row_map.size() - 1, row_map.size() - 1, values.extent(0), values, row_map, entries);
+    std::string kkb_file = filename_root + ".kkb";
+    std::string mtx_file = filename_root + ".mtx";
+
+    // Round trip through the binary format
+    KokkosSparse::Impl::write_kokkos_crst_matrix(A, kkb_file.c_str());
+    auto Akkb = KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>(kkb_file.c_str());
+    EXPECT_EQ(Akkb.numCols(), A.numCols());
+    compare_matrices(Akkb, A);
+
+    // Zero-copy access
+    {
+      KokkosSparse::Impl::CrsBinaryMapping<lno_t, size_type, scalar_t> mapping(kkb_file);
+      ASSERT_EQ(mapping.numRows(), A.numRows());
+      ASSERT_EQ(mapping.nnz(), A.nnz());
+      for (size_type i = 0; i < row_map.size(); ++i) EXPECT_EQ(mapping.row_map()(i), row_map(i));
+      for (size_type i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(mapping.entries()(i), entries(i));
+        EXPECT_EQ(mapping.values()(i), values(i));
+      }
+      // Requesting other types is an error
+      using other_mapping = KokkosSparse::Impl::CrsBinaryMapping<lno_t, size_type, float>;
+      EXPECT_THROW({ other_mapping other(kkb_file); }, std::runtime_error);
+    }
+
+    // A corrupted file is detected
+    {
+      std::fstream f(kkb_file, std::ios::in | std::ios::out | std::ios::binary);
+      f.seekp(-1, std::ios::end);
+      f.put(42);
+    }
+    EXPECT_THROW(KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>(kkb_file.c_str()), std::runtime_error);
+
+    // Cached reading: the first read converts, the second uses the cache
+    write_as_mtx(row_map, entries, values, mtx_file, 'U');
+    std::string cache_file = KokkosSparse::Impl::binary_cache_filename<sp_matrix_type>(mtx_file);
+    std::remove(cache_file.c_str());
+    auto Acached1 = KokkosSparse::Impl::read_kokkos_crst_matrix_cached<sp_matrix_type>(mtx_file.c_str());
+    EXPECT_GT(KokkosKernels::Impl::kk_get_file_size(cache_file.c_str()), size_t(0));
+    auto Acached2 = KokkosSparse::Impl::read_kokkos_crst_matrix_cached<sp_matrix_type>(mtx_file.c_str());
+    compare_matrices(Acached1, A);
+    compare_matrices(Acached2, A);
+    std::remove(cache_file.c_str());
+  }
+
+  // Compare the parallel and serial MatrixMarket readers on a file
+  static void compare_mtx_readers(const std::string& filename, bool symmetrize, bool remove_diagonal,
+                                  bool transpose) {
+    lno_t nr[2], nc[2];
+    size_type ne[2];
+    size_type* xadj[2];
+    lno_t* adj[2];
+    scalar_t* ew[2];
+    for (int parallel = 0; parallel < 2; parallel++) {
+      KokkosSparse::Impl::read_mtx<lno_t, size_type, scalar_t>(filename.c_str(), &nr[parallel], &nc[parallel],
+                                                               &ne[parallel], &xadj[parallel], &adj[parallel],
+                                                               &ew[parallel], symmetrize, remove_diagonal, transpose,
+                                                               parallel == 1);
+    }
+    EXPECT_EQ(nr[0], nr[1]);
+    EXPECT_EQ(nc[0], nc[1]);
+    ASSERT_EQ(ne[0], ne[1]);
+    for (lno_t i = 0; i <= nr[0]; i++) EXPECT_EQ(xadj[0][i], xadj[1][i]);
+    for (size_type i = 0; i < ne[0]; i++) {
+      EXPECT_EQ(adj[0][i], adj[1][i]);
+      // When symmetrizing, which duplicate the serial reader keeps is unspecified
+      if (!symmetrize) EXPECT_EQ(ew[0][i], ew[1][i]);
+    }
+    for (int parallel = 0; parallel < 2; parallel++) {
+      delete[] xadj[parallel];
+      delete[] adj[parallel];
+      delete[] ew[parallel];
+    }
+  }
+
+  static void parallel_parse_test(const std::string& filename_root) {
+    // A random matrix, large enough to be split in several chunks
+    size_type nnz      = 40000;
+    sp_matrix_type A   = KokkosSparse::Impl::kk_generate_sparse_matrix<sp_matrix_type>(5000, 5000, nnz, 5, 500);
+    std::string random = filename_root + "_random.mtx";
+    KokkosSparse::Impl::write_kokkos_crst_matrix(A, random.c_str());
+    for (bool symmetrize : {false, true})
+      for (bool remove_diagonal : {false, true})
+        for (bool transpose : {false, true}) compare_mtx_readers(random, symmetrize, remove_diagonal, transpose);
+
+    // Number formats that need the slow path, comments and CRLF line endings
+    std::string formats = filename_root + "_formats.mtx";
+    {
+      std::ofstream out(formats);
+      out << "%%MatrixMarket matrix coordinate real symmetric\n% comment\n4 4 8\r\n";
+      out << "1 1 1.5e+00\r\n2 1 .5\n3 1 -2.\n  4 1   1e-300\n";
+      out << "2 2 123456789012345678901234\n3 3 0.1000000000000000055511151231257827\n";
+      out << "4 3 +7E2\n4 4 -0\n";
+    }
+    for (bool remove_diagonal : {false, true}) compare_mtx_readers(formats, false, remove_diagonal, false);
+    compare_mtx_readers(formats, true, false, false);
+  }
+
   static void test() {
     const std::string filename_root = "test_sparse_ioutils";
     auto sym_fix                    = get_sym_fixture();
@@ -170,6 +273,8 @@ struct TestIOUtils {
     full_test(sym_fix, filename_root + "_sym", 'S');
     full_test(sym_fix, filename_root + "_herm", 'H');
     full_test(sym_fix, filename_root + "_skew", 'Z');
+    binary_test(asym_fix, filename_root + "_binary");
+    parallel_parse_test(filename_root + "_parallel");
   }
 };
 
@@ -132,6 +132,73 @@ void testSortCRS(KokkosKernels::default_lno_t numRows, KokkosKernels::default_ln
   }
 }
 
+// Rows of very different lengths, as with power-law graphs, sorted with the
+// public interface (which may pick the bulk radix sort) and explicitly with
+// the bulk radix sort.
+template <typename device_t>
+void testSortCRSSkewed(bool doValues) {
+  using scalar_t      = KokkosKernels::default_scalar;
+  using lno_t         = KokkosKernels::default_lno_t;
+  using size_type     = KokkosKernels::default_size_type;
+  using exec_space    = typename device_t::execution_space;
+  using rowmap_t      = Kokkos::View<size_type*, device_t>;
+  using entries_t     = Kokkos::View<lno_t*, device_t>;
+  using values_t      = Kokkos::View<scalar_t*, device_t>;
+  const lno_t numRows = 3000;
+  const lno_t numCols = 70000;
+  Kokkos::View<size_type*, Kokkos::HostSpace> rowmapHost("rowmap host", numRows + 1);
+  std::srand(12);
+  for (lno_t i = 0; i < numRows; i++) {
+    lno_t rowLen      = (i % 1000 == 7) ? 20000 + std::rand() % 20000 : std::rand() % 8;
+    rowmapHost(i + 1) = rowmapHost(i) + rowLen;
+  }
+  const size_type nnz = rowmapHost(numRows);
+  Kokkos::View<lno_t*, Kokkos::HostSpace> entriesHost("entries host", nnz);
+  Kokkos::View<scalar_t*, Kokkos::HostSpace> valuesHost("values host", nnz);
+  for (size_type j = 0; j < nnz; j++) {
+    entriesHost(j) = std::rand() % numCols;
+    valuesHost(j)  = scalar_t(entriesHost(j)) + scalar_t(1);
+  }
+  // reference: sort each row on host
+  Kokkos::View<lno_t*, Kokkos::HostSpace> sortedHost("sorted entries host", nnz);
+  Kokkos::deep_copy(sortedHost, entriesHost);
+  for (lno_t i = 0; i < numRows; i++)
+    std::sort(sortedHost.data() + rowmapHost(i), sortedHost.data() + rowmapHost(i + 1));
+  for (int method = 0; method < 2; method++) {
+    rowmap_t rowmap("rowmap", numRows + 1);
+    entries_t entries("entries", nnz);
+    values_t values("values", nnz);
+    Kokkos::deep_copy(rowmap, rowmapHost);
+    Kokkos::deep_copy(entries, entriesHost);
+    Kokkos::deep_copy(values, valuesHost);
+    if (method == 0) {
+      if (doValues)
+        KokkosSparse::sort_crs_matrix(exec_space(), rowmap, entries, values);
+      else
+        KokkosSparse::sort_crs_graph(exec_space(), rowmap, entries);
+    } else {
+      if (doValues) {
+        auto permutation = KokkosSparse::Impl::computeEntryPermutationRadix(exec_space(), rowmap, entries, numCols);
+        entries_t origEntries("orig entries", nnz);
+        values_t origValues("orig values", nnz);
+        Kokkos::deep_copy(origEntries, entries);
+        Kokkos::deep_copy(origValues, values);
+        KokkosSparse::Impl::applyPermutation(exec_space(), permutation, origEntries, entries);
+        KokkosSparse::Impl::applyPermutation(exec_space(), permutation, origValues, values);
+      } else {
+        KokkosSparse::Impl::bulkRadixSortGraph(exec_space(), rowmap, entries, numCols);
+      }
+    }
+    auto entriesOut = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+    auto valuesOut  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+    for (size_type j = 0; j < nnz; j++) {
+      ASSERT_EQ(sortedHost(j), entriesOut(j)) << "Sorted column indices are wrong, method " << method;
+      // each value was made from its column
+      if (doValues) ASSERT_EQ(valuesOut(j), scalar_t(entriesOut(j)) + scalar_t(1)) << "Sorted values are wrong";
+    }
+  }
+}
+
 template <typename device_t>
 void testSortCRSUnmanaged(bool doValues, bool doStructInterface) {
   // This test is about bug #960.
@@ -467,6 +534,11 @@ TEST_F(TestCategory, common_sort_crs_longrows) {
   testSortCRS<TestDevice>(1, 50000, 10000, true, false, SortCrsTest::ImplicitType);
 }
 
+TEST_F(TestCategory, common_sort_crs_skewed) {
+  testSortCRSSkewed<TestDevice>(false);
+  testSortCRSSkewed<TestDevice>(true);
+}
+
 TEST_F(TestCategory, common_sort_merge_crsmatrix) {
   for (int testCase = 0; testCase < 5; testCase++) {
     for (int doStructInterface = 0; doStructInterface < 2; doStructInterface++) {
@@ -0,0 +1,183 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <string>
+#include <stdexcept>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_cg.hpp"
+#include "KokkosSparse_MatrixPrec.hpp"
+
+namespace Test {
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+struct CgTest {
+  using exe_space = typename device::execution_space;
+  using mem_space = typename device::memory_space;
+
+  using Crs = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using Bsr = KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, device, void, size_type>;
+
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+  using float_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  // 5-point Laplacian on an nx x nx grid with Dirichlet boundaries
+  // (symmetric positive definite)
+  static Crs get_laplacian(const lno_t nx) {
+    const lno_t n = nx * nx;
+    typename Crs::row_map_type::non_const_type rowmap("rowmap", n + 1);
+    auto h_rowmap = Kokkos::create_mirror_view(rowmap);
+    for (lno_t j = 0; j < nx; j++)
+      for (lno_t i = 0; i < nx; i++)
+        h_rowmap(j * nx + i + 1) = h_rowmap(j * nx + i) + 1 + (i > 0) + (i < nx - 1) + (j > 0) + (j < nx - 1);
+    typename Crs::index_type::non_const_type entries("entries", h_rowmap(n));
+    typename Crs::values_type::non_const_type values("values", h_rowmap(n));
+    auto h_entries = Kokkos::create_mirror_view(entries);
+    auto h_values  = Kokkos::create_mirror_view(values);
+    for (lno_t j = 0; j < nx; j++) {
+      for (lno_t i = 0; i < nx; i++) {
+        const lno_t row = j * nx + i;
+        size_type k     = h_rowmap(row);
+        for (lno_t col : {row - nx, row - 1, row, row + 1, row + nx}) {
+          if ((col == row - nx && j == 0) || (col == row - 1 && i == 0) || (col == row + 1 && i == nx - 1) ||
+              (col == row + nx && j == nx - 1))
+            continue;
+          h_entries(k)  = col;
+          h_values(k++) = col == row ? scalar_t(4) : scalar_t(-1);
+        }
+      }
+    }
+    Kokkos::deep_copy(rowmap, h_rowmap);
+    Kokkos::deep_copy(entries, h_entries);
+    Kokkos::deep_copy(values, h_values);
+    return Crs("Laplacian", n, n, h_rowmap(n), values, rowmap, entries);
+  }
+
+  // Jacobi preconditioner, as the matrix diag(A)^{-1}
+  static Crs get_jacobi(const Crs& A) {
+    const lno_t n = A.numRows();
+    auto rowmap   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+    auto entries  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+    auto values   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+    typename Crs::row_map_type::non_const_type d_rowmap("rowmap", n + 1);
+    typename Crs::index_type::non_const_type d_entries("entries", n);
+    typename Crs::values_type::non_const_type d_values("values", n);
+    auto h_rowmap  = Kokkos::create_mirror_view(d_rowmap);
+    auto h_entries = Kokkos::create_mirror_view(d_entries);
+    auto h_values  = Kokkos::create_mirror_view(d_values);
+    for (lno_t i = 0; i < n; i++) {
+      h_rowmap(i + 1) = i + 1;
+      h_entries(i)    = i;
+      for (size_type k = rowmap(i); k < rowmap(i + 1); k++)
+        if (entries(k) == i) h_values(i) = Kokkos::ArithTraits<scalar_t>::one() / values(k);
+    }
+    Kokkos::deep_copy(d_rowmap, h_rowmap);
+    Kokkos::deep_copy(d_entries, h_entries);
+    Kokkos::deep_copy(d_values, h_values);
+    return Crs("Jacobi", n, n, n, d_values, d_rowmap, d_entries);
+  }
+
+  template <class AMatrix, class ViewVectorType>
+  static float_t solve_and_check(KernelHandle& kh, AMatrix& A, ViewVectorType& B, ViewVectorType& X,
+                                 KokkosSparse::Experimental::Preconditioner<AMatrix>* precond) {
+    auto cg_handle = kh.get_cg_handle();
+    Kokkos::deep_copy(X, 0.0);
+    KokkosSparse::Experimental::cg(&kh, A, B, X, precond);
+
+    // Double check residuals at end of solve:
+    ViewVectorType R("R", B.extent(0));
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -1.0, A, X, 1.0, R);  // r = b-Ax
+    float_t endRes = KokkosBlas::nrm2(R) / KokkosBlas::nrm2(B);
+
+    EXPECT_LT(endRes, cg_handle->get_tol());
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), KernelHandle::CGHandleType::Flag::Conv);
+    EXPECT_GT(cg_handle->get_num_iters(), 0);
+    return endRes;
+  }
+
+  template <bool UseBlocks>
+  static void run_test_cg() {
+    using CGHandle       = typename KernelHandle::CGHandleType;
+    using ViewVectorType = typename CGHandle::nnz_value_view_t;
+
+    constexpr lno_t nx       = 40;
+    constexpr auto tol       = std::is_same<float_t, float>::value ? float_t(1e-5) : float_t(1e-8);
+    constexpr auto maxIters  = 1000;
+    constexpr bool verbose   = false;
+    constexpr auto blockSize = 2;
+
+    Crs A         = get_laplacian(nx);
+    const lno_t n = A.numRows();
+
+    KernelHandle kh;
+    kh.create_cg_handle(maxIters, tol);
+    auto cg_handle = kh.get_cg_handle();
+
+    ViewVectorType X("X", n);
+    ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+    // Make rhs ones so that results are repeatable:
+    Kokkos::deep_copy(B, 1.0);
+
+    for (auto algo : {CGHandle::CLASSICAL, CGHandle::CHRONOPOULOS_GEAR, CGHandle::PIPELINED}) {
+      cg_handle->reset_handle(maxIters, tol);
+      cg_handle->set_algorithm(algo);
+      cg_handle->set_verbose(verbose);
+
+      if constexpr (UseBlocks) {
+        Bsr Ab(A, blockSize);
+        solve_and_check<Bsr>(kh, Ab, B, X, nullptr);
+      } else {
+        solve_and_check<Crs>(kh, A, B, X, nullptr);
+
+        // With a preconditioner
+        KokkosSparse::Experimental::MatrixPrec<Crs> jacobi(get_jacobi(A));
+        solve_and_check<Crs>(kh, A, B, X, &jacobi);
+
+        // Initial guess that is already the solution
+        KokkosSparse::Experimental::cg(&kh, A, B, X, &jacobi);
+        EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+        EXPECT_EQ(cg_handle->get_num_iters(), 0);
+      }
+    }
+  }
+};
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_cg() {
+  using TestStruct = Test::CgTest<scalar_t, lno_t, size_type, device>;
+  TestStruct::template run_test_cg<false>();
+  TestStruct::template run_test_cg<true>();
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                  \
+  TEST_F(TestCategory, sparse##_##cg##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_cg<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -213,6 +213,44 @@ void doAllCoo2Crs(size_t m, size_t n) {
   doAllLayoutsCoo2Crs<ExeSpaceType>(m, n, min, max);
 }
 
+// Two-phase conversion: the pattern and map are built once, then the numeric
+// phase is called with two different data arrays for the same tuples
+template <class ScalarType, class LayoutType, class Device>
+void doCoo2CrsTwoPhase(size_t m, size_t n, ScalarType min_val, ScalarType max_val) {
+  using CrsType = KokkosSparse::CrsMatrix<ScalarType, int64_t, Device, void, int64_t>;
+  using MapType = Kokkos::View<int64_t *, Device>;
+  RandCooMat<ScalarType, LayoutType, Device> cooMat(m, n, m * n, min_val, max_val);
+  auto randRow  = cooMat.get_row();
+  auto randCol  = cooMat.get_col();
+  auto randData = cooMat.get_data();
+
+  std::string failure_info = "\nBegin arguments for above failure...\n" + cooMat.info +
+                             "scalar: " + std::string(typeid(ScalarType).name()) + "\n" +
+                             "layout: " + std::string(typeid(LayoutType).name()) + "\n" + "m: " + std::to_string(m) +
+                             ", n: " + std::to_string(n) + "\n...end arguments for above failure.\n";
+
+  MapType map;
+  auto crsMat = KokkosSparse::coo2crs_symbolic<CrsType>(m, n, randRow, randCol, map);
+  ASSERT_EQ(map.extent(0), randRow.extent(0));
+  auto row_map_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crsMat.graph.row_map);
+  auto col_ids_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crsMat.graph.entries);
+  for (size_t i = 0; i < m; i++) {
+    for (auto j = row_map_h(i) + 1; j < row_map_h(i + 1); j++)
+      ASSERT_LT(col_ids_h(j - 1), col_ids_h(j)) << "row " << i << " is not sorted" << failure_info;
+  }
+
+  KokkosSparse::coo2crs_numeric(map, randData, crsMat);
+  check_crs_matrix(crsMat, randRow, randCol, randData, failure_info);
+
+  // new data for the same tuples
+  auto data_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), randData);
+  for (size_t i = 0; i < data_h.extent(0); i++) data_h(i) = ScalarType(2) * data_h(i) + ScalarType(1);
+  decltype(randData) newData("new data", data_h.extent(0));
+  Kokkos::deep_copy(newData, data_h);
+  KokkosSparse::coo2crs_numeric(map, newData, crsMat);
+  check_crs_matrix(crsMat, randRow, randCol, newData, failure_info);
+}
+
 TEST_F(TestCategory, sparse_coo2crs) {
 #if defined(KOKKOS_ENABLE_SYCL)
   if constexpr (std::is_same_v<typename TestDevice::execution_space, Kokkos::Experimental::SYCL>) {
@@ -310,4 +348,24 @@ TEST_F(TestCategory, sparse_coo2crs_staticMatrix_edgeCases) {
   auto crsMatFsTs1 = KokkosSparse::coo2crs(m, n, row, col, data);
   check_crs_matrix(crsMatFsTs1, row_h, col_h, data);
 }
+
+TEST_F(TestCategory, sparse_coo2crs_two_phase) {
+#if defined(KOKKOS_ENABLE_SYCL)
+  if constexpr (std::is_same_v<typename TestDevice::execution_space, Kokkos::Experimental::SYCL>) {
+    std::cout << "Not running coo2csr on SYCL execution space" << std::endl;
+    return;
+  }
+#endif
+
+  uint64_t ticks = std::chrono::high_resolution_clock::now().time_since_epoch().count() % UINT32_MAX;
+  std::srand(ticks);
+
+  doCoo2CrsTwoPhase<double, Kokkos::LayoutRight, TestDevice>(0, 0, 1, 10);
+  for (size_t i = 1; i < 256; i *= 4) {
+    size_t m = (std::rand() % 511) + 1;
+    size_t n = (std::rand() % 511) + 1;
+    doCoo2CrsTwoPhase<double, Kokkos::LayoutRight, TestDevice>(m, n, 1, 10);
+    doCoo2CrsTwoPhase<Kokkos::complex<float>, Kokkos::LayoutLeft, TestDevice>(m, n, 1, 10);
+  }
+}
 }  // namespace Test
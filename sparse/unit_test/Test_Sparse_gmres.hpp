@@ -163,6 +163,54 @@ struct GmresTest {
       EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
     }
 
+    // Test s-step, with a restart length that is not a multiple of s
+    for (int s_step : {2, 4}) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_s_step(s_step);
+      gmres_handle->set_verbose(verbose);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
+
+    // Test s-step with simple preconditioner
+    {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_s_step(3);
+      gmres_handle->set_verbose(verbose);
+
+      KokkosSparse::Experimental::MatrixPrec<sp_matrix_type> myPrec(A);
+
+      // reset X for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+
+      gmres(&kh, A, B, X, &myPrec);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
+
     // Test GSS2 with simple preconditioner
     {
       gmres_handle->reset_handle(m, tol);
@@ -20,6 +20,7 @@
 
 #include <KokkosSparse_CrsMatrix.hpp>
 #include <KokkosSparse_spadd.hpp>
+#include <KokkosBlas1_scal.hpp>
 #include <KokkosKernels_TestUtils.hpp>
 #include <KokkosKernels_IOUtils.hpp>
 #include <KokkosKernels_Utils.hpp>
@@ -187,6 +188,146 @@ void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ
   }
 }
 
+// Numeric phase called again on the same handle: with a fresh C, which must get
+// its column indices written again, and then with set_reuse_c_pattern() and new
+// coefficients, which only refreshes the values of the kept C.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spadd_reuse(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ) {
+  using crsMat_t     = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using KAT          = Kokkos::ArithTraits<scalar_t>;
+  using row_map_type = typename crsMat_t::row_map_type::non_const_type;
+  using entries_type = typename crsMat_t::index_type::non_const_type;
+  using values_type  = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle = typename KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename Device::execution_space, typename Device::memory_space,
+      typename Device::memory_space>;
+
+  srand((numRows << 3) ^ numCols);
+  KernelHandle handle;
+  handle.create_spadd_handle(true, static_cast<lno_t>(maxNNZ) <= numCols);
+  crsMat_t A = randomMatrix<crsMat_t, lno_t>(numRows, numCols, minNNZ, maxNNZ, true);
+  crsMat_t B = randomMatrix<crsMat_t, lno_t>(numRows, numCols, minNNZ, maxNNZ, true);
+  row_map_type c_row_map("C row map", numRows + 1);
+  KokkosSparse::Experimental::spadd_symbolic(&handle, numRows, numCols, A.graph.row_map, A.graph.entries,
+                                             B.graph.row_map, B.graph.entries, c_row_map);
+  const size_type c_nnz = handle.get_spadd_handle()->get_c_nnz();
+  entries_type c_entries("C entries", c_nnz);
+  values_type c_values("C values", c_nnz);
+  KokkosSparse::Experimental::spadd_numeric(&handle, numRows, numCols, A.graph.row_map, A.graph.entries, A.values,
+                                            KAT::one(), B.graph.row_map, B.graph.entries, B.values, KAT::one(),
+                                            c_row_map, c_entries, c_values);
+
+  // a fresh C without reuse gets the same column indices
+  entries_type c_entries2("C entries", c_nnz);
+  values_type c_values2("C values", c_nnz);
+  Kokkos::deep_copy(c_entries2, (lno_t)5);
+  KokkosSparse::Experimental::spadd_numeric(&handle, numRows, numCols, A.graph.row_map, A.graph.entries, A.values,
+                                            KAT::one(), B.graph.row_map, B.graph.entries, B.values, KAT::one(),
+                                            c_row_map, c_entries2, c_values2);
+  auto Centries  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c_entries);
+  auto Centries2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c_entries2);
+  for (size_type i = 0; i < c_nnz; i++) {
+    ASSERT_EQ(Centries(i), Centries2(i)) << "C entry " << i;
+  }
+
+  // values only, with new coefficients
+  const scalar_t alpha = scalar_t(2), beta = scalar_t(-0.5);
+  handle.get_spadd_handle()->set_reuse_c_pattern();
+  Kokkos::deep_copy(c_values, scalar_t(7));
+  KokkosSparse::Experimental::spadd_numeric(&handle, numRows, numCols, A.graph.row_map, A.graph.entries, A.values,
+                                            alpha, B.graph.row_map, B.graph.entries, B.values, beta, c_row_map,
+                                            c_entries, c_values);
+  handle.destroy_spadd_handle();
+  auto Avalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto Arowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto Aentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto Bvalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+  auto Browmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.row_map);
+  auto Bentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.entries);
+  auto Cvalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c_values);
+  auto Crowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c_row_map);
+  for (lno_t row = 0; row < numRows; row++) {
+    std::vector<scalar_t> correct(numCols, KAT::zero());
+    for (size_type i = Arowmap(row); i < Arowmap(row + 1); i++) correct[Aentries(i)] += alpha * Avalues(i);
+    for (size_type i = Browmap(row); i < Browmap(row + 1); i++) correct[Bentries(i)] += beta * Bvalues(i);
+    for (size_type i = Crowmap(row); i < Crowmap(row + 1); i++) {
+      const lno_t col = Centries(i);
+      // 2 * A - B / 2 may round differently in the kernel
+      EXPECT_LE(KAT::abs(correct[col] - Cvalues(i)), 4 * KAT::abs(KAT::epsilon()) * (KAT::abs(correct[col]) + 1))
+          << "C row " << row << ", column " << col;
+    }
+  }
+}
+
+// C = sum_i alpha_i * A_i, for matrices with different, unsorted patterns.
+// The numeric phase is called again after the values of one matrix change.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spadd_sum(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ, int numMatrices) {
+  using crsMat_t     = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using KAT          = Kokkos::ArithTraits<scalar_t>;
+  using KernelHandle = typename KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename Device::execution_space, typename Device::memory_space,
+      typename Device::memory_space>;
+
+  srand((numRows << 2) ^ numCols);
+  std::vector<crsMat_t> A;
+  std::vector<scalar_t> alpha;
+  for (int m = 0; m < numMatrices; m++) {
+    A.push_back(randomMatrix<crsMat_t, lno_t>(numRows, numCols, minNNZ, maxNNZ, false));
+    alpha.push_back(scalar_t(m + 1));
+  }
+  KernelHandle kh;
+  kh.create_spadd_handle(false);
+  crsMat_t C;
+  KokkosSparse::spadd_symbolic(&kh, A, C);
+  ASSERT_EQ(numRows, C.numRows());
+  ASSERT_EQ(numCols, C.numCols());
+
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      // new values, same patterns
+      KokkosBlas::scal(A[0].values, scalar_t(-3), A[0].values);
+      alpha.back() = scalar_t(0.5);
+    }
+    Kokkos::deep_copy(C.values, scalar_t(7));
+    KokkosSparse::spadd_numeric(&kh, alpha, A, C);
+
+    auto Crowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.row_map);
+    auto Centries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.entries);
+    auto Cvalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+    std::vector<std::vector<scalar_t>> correct(numRows, std::vector<scalar_t>(numCols, KAT::zero()));
+    std::vector<std::vector<bool>> nonzeros(numRows, std::vector<bool>(numCols, false));
+    for (int m = 0; m < numMatrices; m++) {
+      auto Arowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A[m].graph.row_map);
+      auto Aentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A[m].graph.entries);
+      auto Avalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A[m].values);
+      for (lno_t row = 0; row < numRows; row++) {
+        for (size_type i = Arowmap(row); i < Arowmap(row + 1); i++) {
+          correct[row][Aentries(i)] += alpha[m] * Avalues(i);
+          nonzeros[row][Aentries(i)] = true;
+        }
+      }
+    }
+    for (lno_t row = 0; row < numRows; row++) {
+      size_type nz = 0;
+      for (lno_t i = 0; i < numCols; i++) nz += nonzeros[row][i];
+      ASSERT_EQ(Crowmap(row + 1) - Crowmap(row), nz) << "row " << row;
+      for (size_type i = Crowmap(row); i < Crowmap(row + 1); i++) {
+        if (i > Crowmap(row)) ASSERT_LT(Centries(i - 1), Centries(i)) << "C row " << row << " is not sorted";
+        const lno_t col = Centries(i);
+        ASSERT_TRUE(nonzeros[row][col]);
+        EXPECT_LE(KAT::abs(correct[row][col] - Cvalues(i)),
+                  16 * KAT::epsilon() * (KAT::abs(correct[row][col]) + numMatrices * maxNNZ))
+            << "C row " << row << ", column " << col << " pass " << pass;
+      }
+    }
+  }
+
+  // the coefficients must match the matrices of symbolic
+  alpha.push_back(KAT::one());
+  EXPECT_THROW(KokkosSparse::spadd_numeric(&kh, alpha, A, C), std::runtime_error);
+}
+
 // Test spadd simplified interface: make sure C's dimensions match A and B, even
 // when there are empty rows/cols
 template <typename scalar_t, typename lno_t, typename size_type, class Device>
@@ -239,6 +380,14 @@ void test_spadd_known_columns() {
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50, 75, 100, true);                                \
     test_spadd_known_columns<SCALAR, ORDINAL, OFFSET, DEVICE>();                                       \
   }                                                                                                    \
+  TEST_F(TestCategory, sparse##_##spadd_reuse##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {          \
+    test_spadd_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 2);                                   \
+    test_spadd_reuse<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 10, 40);                               \
+  }                                                                                                    \
+  TEST_F(TestCategory, sparse##_##spadd_sum##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {            \
+    test_spadd_sum<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 3, 3);                                  \
+    test_spadd_sum<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 80, 10, 120, 4);                              \
+  }                                                                                                    \
   TEST_F(TestCategory, sparse##_##spadd_unsorted_input##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 0, false);                                  \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 2, false);                                  \
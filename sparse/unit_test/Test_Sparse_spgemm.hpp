@@ -482,6 +482,186 @@ void test_issue1738() {
 #endif
 }
 
+// Masked product C<M> = A*B against a host reference. The numeric phase is
+// called a second time with new values in A.
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_masked(lno_t m, lno_t k, lno_t n, size_type nnz, lno_t bandwidth, lno_t row_size_variance,
+                        bool complement) {
+  using namespace Test;
+  using crsMat_t = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                                                       typename device::memory_space, typename device::memory_space>;
+  using KAT = Kokkos::ArithTraits<scalar_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(k, n, nnz, row_size_variance, bandwidth);
+  crsMat_t M = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m, n, nnz, row_size_variance, bandwidth);
+  randomize_matrix_values(A.values);
+  randomize_matrix_values(B.values);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  crsMat_t C;
+  KokkosSparse::spgemm_masked_symbolic(kh, A, B, M.graph, complement, C);
+  EXPECT_TRUE(kh.get_spgemm_handle()->is_symbolic_called());
+  ASSERT_EQ(C.numRows(), m);
+  ASSERT_EQ(C.numCols(), n);
+
+  auto Mrowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M.graph.row_map);
+  auto Mentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M.graph.entries);
+  auto Browmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.row_map);
+  auto Bentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.entries);
+  auto Bvalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+  auto Arowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto Aentries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) randomize_matrix_values(A.values);
+    KokkosSparse::spgemm_masked_numeric(kh, A, B, C);
+    EXPECT_TRUE(kh.get_spgemm_handle()->is_numeric_called());
+    auto Avalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+    auto Crowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.row_map);
+    auto Centries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.entries);
+    auto Cvalues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+    std::vector<scalar_t> correct(n);
+    std::vector<typename KAT::mag_type> bound(n);
+    std::vector<char> inProduct(n), inMask(n);
+    for (lno_t i = 0; i < m; i++) {
+      std::fill(correct.begin(), correct.end(), KAT::zero());
+      std::fill(bound.begin(), bound.end(), 0);
+      std::fill(inProduct.begin(), inProduct.end(), 0);
+      std::fill(inMask.begin(), inMask.end(), 0);
+      for (size_type j = Mrowmap(i); j < Mrowmap(i + 1); j++) inMask[Mentries(j)] = 1;
+      for (size_type ka = Arowmap(i); ka < Arowmap(i + 1); ka++) {
+        const lno_t kk = Aentries(ka);
+        for (size_type kb = Browmap(kk); kb < Browmap(kk + 1); kb++) {
+          correct[Bentries(kb)] += Avalues(ka) * Bvalues(kb);
+          bound[Bentries(kb)] += KAT::abs(Avalues(ka) * Bvalues(kb));
+          inProduct[Bentries(kb)] = 1;
+        }
+      }
+      lno_t expectedCount = 0;
+      for (lno_t j = 0; j < n; j++) expectedCount += inProduct[j] && (complement ? !inMask[j] : inMask[j]);
+      ASSERT_EQ(lno_t(Crowmap(i + 1) - Crowmap(i)), expectedCount) << "C<M> row " << i;
+      for (size_type j = Crowmap(i); j < Crowmap(i + 1); j++) {
+        const lno_t col = Centries(j);
+        if (j > Crowmap(i)) ASSERT_LT(Centries(j - 1), col) << "C<M> row " << i << " is not sorted";
+        ASSERT_TRUE(inProduct[col] && (complement ? !inMask[col] : inMask[col]))
+            << "C<M> has entry (" << i << ", " << col << ") outside of the masked product";
+        EXPECT_LE(KAT::abs(Cvalues(j) - correct[col]), 10 * KAT::epsilon() * bound[col])
+            << "C<M> entry (" << i << ", " << col << ") pass " << pass;
+      }
+    }
+  }
+
+  // the mask must have as many rows as A
+  crsMat_t C2;
+  crsMat_t M2 = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m + 1, n, nnz, row_size_variance, bandwidth);
+  EXPECT_THROW(KokkosSparse::spgemm_masked_symbolic(kh, A, B, M2.graph, complement, C2), std::runtime_error);
+  kh.destroy_spgemm_handle();
+}
+
+// Chunked SpGEMM against the unchunked product, with a memory budget that
+// splits the rows of A into several chunks
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_chunked(lno_t m, lno_t k, lno_t n, size_type nnz, lno_t bandwidth, lno_t row_size_variance,
+                         size_t budget) {
+  using namespace Test;
+  using crsMat_t = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                                                       typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m, k, nnz, row_size_variance, bandwidth);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(k, n, nnz, row_size_variance, bandwidth);
+  randomize_matrix_values(A.values);
+  randomize_matrix_values(B.values);
+  crsMat_t Cref = KokkosSparse::spgemm<crsMat_t>(A, false, B, false);
+  KokkosSparse::sort_crs_matrix(Cref);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  kh.get_spgemm_handle()->set_chunk_memory_budget(budget);
+  crsMat_t C;
+  KokkosSparse::spgemm_chunked(kh, A, B, C);
+  KokkosSparse::sort_crs_matrix(C);
+  EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, Cref))) << "Chunked SpGEMM with budget " << budget;
+  const lno_t numChunks = kh.get_spgemm_handle()->get_num_chunks();
+  if (budget && m > 1 && Cref.nnz() * (sizeof(lno_t) + sizeof(scalar_t)) > 2 * budget) EXPECT_GT(numChunks, 1);
+  // only one chunk handle, and so one chunk of spgemm work memory, is alive at a time
+  EXPECT_EQ(kh.get_spgemm_handle()->get_max_live_chunk_handles(), std::min<lno_t>(numChunks, 1));
+
+  // the chunks cover the rows of C in order, with the same entries
+  auto CrefRowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Cref.graph.row_map);
+  lno_t nextRow   = 0;
+  lno_t chunks    = 0;
+  KokkosSparse::spgemm_chunked_for_each<crsMat_t>(kh, A, B, [&](lno_t firstRow, const crsMat_t& Cchunk) {
+    EXPECT_EQ(firstRow, nextRow);
+    EXPECT_EQ(Cchunk.numCols(), n);
+    auto rowmap = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Cchunk.graph.row_map);
+    for (lno_t i = 0; i < Cchunk.numRows(); i++) {
+      EXPECT_EQ(rowmap(i + 1) - rowmap(i), CrefRowmap(firstRow + i + 1) - CrefRowmap(firstRow + i));
+    }
+    nextRow += Cchunk.numRows();
+    chunks++;
+  });
+  EXPECT_EQ(nextRow, m);
+  EXPECT_EQ(chunks, numChunks);
+  kh.destroy_spgemm_handle();
+}
+
+// Fused triple products R*A*P and P^T*A*P against two plain products. The
+// numeric phases are called a second time with new values in A.
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_rap(lno_t nFine, lno_t nCoarse, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using namespace Test;
+  using crsMat_t = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                                                       typename device::memory_space, typename device::memory_space>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(nFine, nFine, nnz, row_size_variance, bandwidth);
+  crsMat_t P =
+      KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(nFine, nCoarse, nnz / 4, row_size_variance, bandwidth);
+  crsMat_t R =
+      KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(nCoarse, nFine, nnz / 4, row_size_variance, bandwidth);
+  randomize_matrix_values(A.values);
+  randomize_matrix_values(P.values);
+  randomize_matrix_values(R.values);
+  crsMat_t Pt = KokkosSparse::Impl::transpose_matrix(P);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle();
+  crsMat_t Ac, PtAP;
+  KokkosSparse::Experimental::spgemm_rap_symbolic(&kh, R, A, P, Ac);
+  EXPECT_TRUE(kh.get_spgemm_handle()->is_symbolic_called());
+  EXPECT_EQ(size_t(kh.get_spgemm_handle()->get_c_nnz()), size_t(Ac.nnz()));
+  KokkosSparse::Experimental::spgemm_ptap_symbolic(&kh, A, P, PtAP);
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) randomize_matrix_values(A.values);
+    KokkosSparse::Experimental::spgemm_rap_numeric(&kh, R, A, P, Ac);
+    EXPECT_TRUE(kh.get_spgemm_handle()->is_numeric_called());
+    KokkosSparse::Experimental::spgemm_ptap_numeric(&kh, A, P, PtAP);
+    crsMat_t AP    = KokkosSparse::spgemm<crsMat_t>(A, false, P, false);
+    crsMat_t RAP   = KokkosSparse::spgemm<crsMat_t>(R, false, AP, false);
+    crsMat_t PtAPr = KokkosSparse::spgemm<crsMat_t>(Pt, false, AP, false);
+    KokkosSparse::sort_crs_matrix(RAP);
+    KokkosSparse::sort_crs_matrix(PtAPr);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(Ac, RAP))) << "R*A*P pass " << pass;
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(PtAP, PtAPr))) << "P^T*A*P pass " << pass;
+  }
+
+  // one call, and dimensions that do not match
+  crsMat_t Ac2;
+  KokkosSparse::Experimental::spgemm_rap(&kh, R, A, P, Ac2);
+  EXPECT_EQ(Ac2.nnz(), Ac.nnz());
+  if (nFine != nCoarse) {
+    EXPECT_THROW(KokkosSparse::Experimental::spgemm_rap(&kh, P, A, P, Ac2), std::runtime_error);
+    EXPECT_THROW(KokkosSparse::Experimental::spgemm_ptap(&kh, R, P, Ac2), std::runtime_error);
+  }
+  kh.destroy_spgemm_handle();
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                                   \
   TEST_F(TestCategory, sparse##_##spgemm##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {                              \
     test_spgemm<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 8000, 6000, 8000 * 20, 500, 10, ::Test::spgemm_reuse_matrix); \
@@ -510,6 +690,23 @@ void test_issue1738() {
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(false, false);                                              \
     test_issue402<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                                 \
     test_issue1738<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                                \
+  }                                                                                                                   \
+  TEST_F(TestCategory, sparse##_##spgemm_masked##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {                       \
+    test_spgemm_masked<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 500, 1600, 1000 * 20, 500, 10, false);                  \
+    test_spgemm_masked<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 500, 1600, 1000 * 20, 500, 10, true);                   \
+    test_spgemm_masked<SCALAR, ORDINAL, OFFSET, DEVICE>(0, 12, 5, 0, 10, 0, false);                                   \
+    test_spgemm_masked<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 10, 0, 0, 0, true);                                   \
+  }                                                                                                                   \
+  TEST_F(TestCategory, sparse##_##spgemm_chunked##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {                      \
+    test_spgemm_chunked<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 500, 1600, 1000 * 20, 500, 10, 0);                     \
+    test_spgemm_chunked<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 500, 1600, 1000 * 20, 500, 10, 1 << 16);               \
+    test_spgemm_chunked<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 50, 160, 100 * 20, 50, 10, 1);                          \
+    test_spgemm_chunked<SCALAR, ORDINAL, OFFSET, DEVICE>(0, 12, 5, 0, 10, 0, 1 << 16);                                \
+  }                                                                                                                   \
+  TEST_F(TestCategory, sparse##_##spgemm_rap##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {                          \
+    test_spgemm_rap<SCALAR, ORDINAL, OFFSET, DEVICE>(1000, 300, 1000 * 10, 100, 5);                                   \
+    test_spgemm_rap<SCALAR, ORDINAL, OFFSET, DEVICE>(200, 200, 200 * 20, 200, 10);                                    \
+    test_spgemm_rap<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 3, 0, 0, 0);                                                 \
   }
 
 // test_spgemm<SCALAR,ORDINAL,OFFSET,DEVICE>(50000, 50000 * 30, 100, 10);
@@ -24,6 +24,7 @@
 #include "KokkosSparse_CrsMatrix.hpp"
 #include <KokkosKernels_IOUtils.hpp>
 #include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_scal.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_spiluk.hpp"
 #include "KokkosSparse_crs_to_bsr_impl.hpp"
@@ -638,6 +639,122 @@ struct SpilukTest {
     }
   }
 
+  // Tridiagonal matrix: every level of its L has a single row
+  static Crs get_tridiagonal(const lno_t nrows) {
+    RowMapType row_map("row_map", nrows + 1);
+    EntriesType entries("entries", 3 * nrows - 2);
+    ValuesType values("values", 3 * nrows - 2);
+    auto h_row_map = Kokkos::create_mirror_view(row_map);
+    auto h_entries = Kokkos::create_mirror_view(entries);
+    auto h_values  = Kokkos::create_mirror_view(values);
+    size_type nnz  = 0;
+    for (lno_t row = 0; row < nrows; ++row) {
+      for (lno_t col = row - 1; col <= row + 1; ++col) {
+        if (col < 0 || col >= nrows) continue;
+        h_entries(nnz) = col;
+        h_values(nnz)  = col == row ? scalar_t(4) : scalar_t(-1);
+        nnz++;
+      }
+      h_row_map(row + 1) = nnz;
+    }
+    Kokkos::deep_copy(row_map, h_row_map);
+    Kokkos::deep_copy(entries, h_entries);
+    Kokkos::deep_copy(values, h_values);
+    return Crs("tridiagonal", nrows, nrows, nnz, values, row_map, entries);
+  }
+
+  // SEQLVLSCHD_TP1CHAIN and row-blocked levels must give the factors of
+  // SEQLVLSCHD_TP1, also when the numeric phase is repeated on new values
+  template <bool UseBlocks>
+  static void run_test_spiluk_chain() {
+    using sp_matrix_type = std::conditional_t<UseBlocks, Bsr, Crs>;
+
+    constexpr auto nrows         = 2000;
+    constexpr auto diagDominance = 2;
+    const lno_t fill_lev         = 1;
+
+    size_type nnz = 10 * nrows;
+    Crs A_random  = KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<Crs>(
+        nrows, nrows, nnz, 0, lno_t(0.01 * nrows), diagDominance);
+    KokkosSparse::sort_crs_matrix(A_random);
+
+    // algorithm, chain_threshold, rows_per_team
+    const std::vector<std::tuple<SPILUKAlgorithm, lno_t, lno_t>> variants = {
+        {SPILUKAlgorithm::SEQLVLSCHD_TP1, -1, 4},
+        {SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN, -1, 1},
+        {SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN, 8, 3},
+        {SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN, nrows, 1}};
+    const std::vector<size_type> block_sizes = UseBlocks ? std::vector<size_type>{1, 2} : std::vector<size_type>{1};
+
+    for (const Crs& A_unblocked : {get_tridiagonal(nrows), A_random}) {
+      for (auto block_size : block_sizes) {
+        auto A = get_A<sp_matrix_type>(A_unblocked, block_size);
+
+        RowMapType row_map("row_map", A.graph.row_map.extent(0));
+        EntriesType entries("entries", A.graph.entries.extent(0));
+        ValuesType values("values", A.values.extent(0));
+        Kokkos::deep_copy(row_map, A.graph.row_map);
+        Kokkos::deep_copy(entries, A.graph.entries);
+        Kokkos::deep_copy(values, A.values);
+        const size_type nbrows      = row_map.extent(0) - 1;
+        const size_type block_items = block_size * block_size;
+
+        KernelHandle kh;
+        const auto [L_row_map_ref, L_entries_ref, L_values_ref, U_row_map_ref, U_entries_ref, U_values_ref] =
+            run_and_check_spiluk<UseBlocks>(kh, row_map, entries, values, SPILUKAlgorithm::SEQLVLSCHD_TP1, fill_lev,
+                                            block_size);
+
+        // Scaling A by 2 leaves L unchanged and doubles U
+        ValuesType values2("values2", values.extent(0));
+        KokkosBlas::scal(values2, scalar_t(2), values);
+        ValuesType U_values2_ref("U_values2_ref", U_values_ref.extent(0));
+        KokkosBlas::scal(U_values2_ref, scalar_t(2), U_values_ref);
+
+        for (const auto& [alg, chain_threshold, rows_per_team] : variants) {
+          kh.create_spiluk_handle(alg, nbrows, 40 * nbrows, 40 * nbrows, UseBlocks ? block_size : 0);
+          auto spiluk_handle = kh.get_spiluk_handle();
+          spiluk_handle->set_chain_threshold(chain_threshold);
+          spiluk_handle->set_rows_per_team(rows_per_team);
+
+          RowMapType L_row_map("L_row_map", nbrows + 1);
+          EntriesType L_entries("L_entries", spiluk_handle->get_nnzL());
+          RowMapType U_row_map("U_row_map", nbrows + 1);
+          EntriesType U_entries("U_entries", spiluk_handle->get_nnzU());
+
+          spiluk_symbolic(&kh, fill_lev, row_map, entries, L_row_map, L_entries, U_row_map, U_entries);
+
+          Kokkos::resize(L_entries, spiluk_handle->get_nnzL());
+          Kokkos::resize(U_entries, spiluk_handle->get_nnzU());
+          ValuesType L_values("L_values", spiluk_handle->get_nnzL() * static_cast<size_t>(block_items));
+          ValuesType U_values("U_values", spiluk_handle->get_nnzU() * static_cast<size_t>(block_items));
+
+          if (alg == SPILUKAlgorithm::SEQLVLSCHD_TP1CHAIN) {
+            EXPECT_LE(spiluk_handle->get_num_chain_entries(), spiluk_handle->get_num_levels());
+          }
+
+          spiluk_numeric(&kh, fill_lev, row_map, entries, values, L_row_map, L_entries, L_values, U_row_map, U_entries,
+                         U_values);
+
+          EXPECT_NEAR_KK_1DVIEW(L_row_map, L_row_map_ref, EPS);
+          EXPECT_NEAR_KK_1DVIEW(L_entries, L_entries_ref, EPS);
+          EXPECT_NEAR_KK_REL_1DVIEW(L_values, L_values_ref, EPS);
+          EXPECT_NEAR_KK_1DVIEW(U_row_map, U_row_map_ref, EPS);
+          EXPECT_NEAR_KK_1DVIEW(U_entries, U_entries_ref, EPS);
+          EXPECT_NEAR_KK_REL_1DVIEW(U_values, U_values_ref, EPS);
+
+          // Refactor without a new symbolic phase
+          spiluk_numeric(&kh, fill_lev, row_map, entries, values2, L_row_map, L_entries, L_values, U_row_map,
+                         U_entries, U_values);
+
+          EXPECT_NEAR_KK_REL_1DVIEW(L_values, L_values_ref, EPS);
+          EXPECT_NEAR_KK_REL_1DVIEW(U_values, U_values2_ref, EPS);
+
+          kh.destroy_spiluk_handle();
+        }
+      }
+    }
+  }
+
   template <bool UseBlocks>
   static void run_test_spiluk_precond() {
     // Test using spiluk as a preconditioner
@@ -779,6 +896,8 @@ void test_spiluk() {
   TestStruct::run_test_spiluk_blocks();
   TestStruct::run_test_spiluk_scale();
   TestStruct::run_test_spiluk_scale_blocks();
+  TestStruct::template run_test_spiluk_chain<false>();
+  TestStruct::template run_test_spiluk_chain<true>();
   TestStruct::template run_test_spiluk_precond<false>();
   TestStruct::template run_test_spiluk_precond<true>();
 }
@@ -13,6 +13,7 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Random.hpp>
@@ -457,11 +458,148 @@ void test_spmv_algorithms(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t r
   // Here, SPMV_MERGE_PATH will test a TPL's algorithm for imbalanced matrices
   // if available (like cuSPARSE ALG2). SPMV_NATIVE_MERGE_PATH will always call
   // the KokkosKernels implmentation of merge path.
-  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NATIVE_MERGE_PATH}) {
+  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NATIVE_MERGE_PATH, SPMV_AUTOTUNE}) {
     test_spmv<scalar_t, lno_t, size_type, Device>(algo, numRows, nnz, bandwidth, row_size_variance, heavy);
   }
 }
 
+// Run enough spmvs with an SPMV_AUTOTUNE handle for tuning to finish, checking
+// the result of every call (both timed trials and calls after tuning).
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_autotune(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using crsMat_t      = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using handle_t      = KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numRows, nnz, row_size_variance,
+                                                                         bandwidth);
+  scalar_view_t x("x", numRows);
+  scalar_view_t y("y", numRows);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+
+  handle_t handle(KokkosSparse::SPMV_AUTOTUNE);
+  handle.set_autotune_trials(2);
+  EXPECT_TRUE(handle.is_autotuned());
+  EXPECT_FALSE(handle.is_autotune_finished());
+
+  const mag_t max_error = static_cast<mag_t>(numRows ? (nnz / numRows + row_size_variance) : 0);
+  // There are at most 4 candidates (native, native merge path and the TPL's
+  // default and merge path algorithms). Switching to the TPL's merge path
+  // rebuilds the TPL data made for its default algorithm.
+  for (int i = 0; i < 4 * handle.get_autotune_trials() + 2; i++) {
+    Test::check_spmv(&handle, A, x, y, 1.0, 0.0, "N", max_error);
+  }
+  EXPECT_TRUE(handle.is_autotune_finished());
+  const auto &candidates = handle.get_autotune_candidates();
+  const auto &timings    = handle.get_autotune_timings();
+  ASSERT_FALSE(candidates.empty());
+  EXPECT_EQ(candidates.size(), timings.size());
+  EXPECT_NE(handle.get_algorithm(), KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_NE(std::find(candidates.begin(), candidates.end(), handle.get_algorithm()), candidates.end());
+  // Once tuning has finished, the number of trials can no longer be changed
+  EXPECT_THROW(handle.set_autotune_trials(5), std::runtime_error);
+}
+
+// SPMV_COMPRESSED_FP32/FP16 round A's values, so compare against the exact
+// product with a tolerance for that rounding. With a bandwidth over 2^16 most
+// row blocks are too wide for 16-bit column offsets.
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_compressed(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using crsMat_t      = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mv_t          = Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Device>;
+  using handle_t      = KokkosSparse::SPMVHandle<Device, crsMat_t, scalar_view_t, scalar_view_t>;
+  using handle_mv_t   = KokkosSparse::SPMVHandle<Device, crsMat_t, mv_t, mv_t>;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using AT            = Kokkos::ArithTraits<scalar_t>;
+
+  if constexpr (!KokkosSparse::Impl::spmv_compressed_supported_v<scalar_t>) {
+    EXPECT_THROW(handle_t(KokkosSparse::SPMV_COMPRESSED_FP32), std::invalid_argument);
+  } else {
+    crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numRows, nnz, row_size_variance,
+                                                                           bandwidth);
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    mv_t x("x", numRows, 2), y("y", numRows, 2), y_ref("y_ref", numRows, 2);
+    Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(1));
+    Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(1));
+    const lno_t max_nnz_per_row = numRows ? (nnz / numRows + row_size_variance) : 0;
+    const scalar_t alpha(1.5), beta(0.5);
+
+    for (auto algo : {KokkosSparse::SPMV_COMPRESSED_FP32, KokkosSparse::SPMV_COMPRESSED_FP16}) {
+      // Unit roundoff of float or half, on entries and x bounded by 1
+      const mag_t unit = algo == KokkosSparse::SPMV_COMPRESSED_FP32 ? mag_t(6e-8) : mag_t(4.9e-4);
+      const mag_t tol  = 2 * AT::abs(alpha) * unit * max_nnz_per_row + 100 * AT::eps();
+      handle_t handle(algo);
+      handle_mv_t handle_mv(algo);
+      auto x0 = Kokkos::subview(x, Kokkos::ALL(), 0);
+      auto y0 = Kokkos::subview(y, Kokkos::ALL(), 0);
+
+      // Scaling A's values after reset_compressed() must be seen by the next call
+      for (const mag_t scale : {mag_t(1), mag_t(2)}) {
+        if (scale != mag_t(1)) {
+          KokkosBlas::scal(A.values, scalar_t(scale), A.values);
+          handle.reset_compressed();
+          handle_mv.reset_compressed();
+        }
+        for (const char *mode : {"N", "T"}) {
+          Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(1));
+          Kokkos::deep_copy(y_ref, y);
+          for (int j = 0; j < 2; j++)
+            sequential_spmv(A, Kokkos::subview(x, Kokkos::ALL(), j), Kokkos::subview(y_ref, Kokkos::ALL(), j), alpha,
+                            beta, mode);
+          // Column 0 as a rank-1 vector, then both columns with a rank-2 handle
+          // applied to a copy of the original y
+          mv_t y_mv("y_mv", numRows, 2);
+          Kokkos::deep_copy(y_mv, y);
+          scalar_view_t y0_copy("y0_copy", numRows);
+          Kokkos::deep_copy(y0_copy, y0);
+          scalar_view_t x0_copy("x0_copy", numRows);
+          Kokkos::deep_copy(x0_copy, x0);
+          KokkosSparse::spmv(&handle, mode, alpha, A, x0_copy, beta, y0_copy);
+          KokkosSparse::spmv(&handle_mv, mode, alpha, A, x, beta, y_mv);
+
+          auto h_y0      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y0_copy);
+          auto h_y_mv    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_mv);
+          auto h_y_ref   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+          int num_errors = 0;
+          for (lno_t i = 0; i < numRows; i++) {
+            if (AT::abs(h_y0(i) - h_y_ref(i, 0)) > scale * tol) num_errors++;
+            for (int j = 0; j < 2; j++)
+              if (AT::abs(h_y_mv(i, j) - h_y_ref(i, j)) > scale * tol) num_errors++;
+          }
+          EXPECT_EQ(num_errors, 0) << KokkosSparse::get_spmv_algorithm_name(algo) << " mode " << mode << " scale "
+                                   << scale;
+        }
+      }
+    }
+
+    // A value above the range of half_t: SPMV_COMPRESSED_FP16 must store the
+    // values in float rather than overflow to infinity
+    if (A.nnz() && numRows) {
+      const scalar_t big(1.0e5);
+      Kokkos::deep_copy(Kokkos::subview(A.values, 0), big);
+      scalar_view_t x0("x0", numRows), y0("y0", numRows), y0_ref("y0_ref", numRows);
+      Kokkos::deep_copy(x0, Kokkos::subview(x, Kokkos::ALL(), 0));
+      sequential_spmv(A, x0, y0_ref, scalar_t(1), scalar_t(0), "N");
+      handle_t handle(KokkosSparse::SPMV_COMPRESSED_FP16);
+      KokkosSparse::spmv(&handle, "N", scalar_t(1), A, x0, scalar_t(0), y0);
+      EXPECT_TRUE(handle.get_impl()->compressed.use_fp32);
+      auto h_y0     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y0);
+      auto h_y0_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y0_ref);
+      // float rounding, relative to the largest entry
+      const mag_t tol = mag_t(6e-8) * AT::abs(big) * (max_nnz_per_row + 1) + 100 * AT::eps();
+      int num_errors  = 0;
+      for (lno_t i = 0; i < numRows; i++) {
+        if (!(AT::abs(h_y0(i) - h_y0_ref(i)) <= tol)) num_errors++;
+      }
+      EXPECT_EQ(num_errors, 0) << "SPMV_COMPRESSED_FP16 with a value above the range of half_t";
+    }
+  }
+}
+
 template <typename scalar_t, typename lno_t, typename size_type, typename layout, class Device>
 void test_spmv_mv(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance, bool heavy, int numMV) {
   using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
@@ -1065,6 +1203,9 @@ void test_spmv_all_interfaces_light() {
     test_spmv_algorithms<SCALAR, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 3, 20, 10, false);  \
     test_spmv_algorithms<SCALAR, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 3, 100, 10, false); \
     test_spmv_algorithms<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 10000 * 2, 100, 5, false);  \
+    test_spmv_autotune<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 10000 * 5, 100, 5);           \
+    test_spmv_compressed<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 10000 * 5, 100, 5);         \
+    test_spmv_compressed<SCALAR, ORDINAL, OFFSET, DEVICE>(100000, 100000 * 3, 100000, 2);    \
   }
 
 #define EXECUTE_TEST_INTERFACES(SCALAR, ORDINAL, OFFSET, LAYOUT, DEVICE)                               \
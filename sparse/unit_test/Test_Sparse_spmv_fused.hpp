@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_fused.hpp"
+#include "KokkosBlas1_dot.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+
+namespace Test {
+
+// Compare the fused kernels against spmv followed by KokkosBlas::dot and
+// KokkosBlas::axpby
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_fused(lno_t numRows, size_type nnz, lno_t row_size_variance) {
+  using crsMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using v_t      = Kokkos::View<scalar_t *, Device>;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numRows, nnz, row_size_variance,
+                                                                         numRows);
+
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+  v_t x("x", numRows), y("y", numRows), y_ref("y_ref", numRows), z("z", numRows), z_ref("z_ref", numRows);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+  Kokkos::fill_random(z_ref, rand_pool, scalar_t(1));
+  const mag_t tol = 10 * KAT::eps() * (nnz / (numRows ? numRows : 1) + row_size_variance + 2);
+
+  for (const char *mode : {"N", "C"}) {
+    const scalar_t alpha(1.5), a(-0.5), b(2);
+    KokkosSparse::spmv(mode, alpha, A, x, scalar_t(0), y_ref);
+
+    // spmv_dot, with the result on device and on host
+    {
+      const scalar_t xy = KokkosBlas::dot(x, y_ref);
+      const scalar_t yy = KokkosBlas::dot(y_ref, y_ref);
+      Kokkos::deep_copy(y, KAT::nan());
+      v_t dots("dots", 2);
+      KokkosSparse::Experimental::spmv_dot(mode, alpha, A, x, y, dots);
+      auto h_dots = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dots);
+      Kokkos::View<scalar_t *, Kokkos::HostSpace> h_dots2("h_dots2", 2);
+      KokkosSparse::Experimental::spmv_dot(typename Device::execution_space(), mode, alpha, A, x, y, h_dots2);
+
+      const mag_t dotTol = tol * (KAT::abs(yy) + 1) * numRows;
+      EXPECT_LE(KAT::abs(h_dots(0) - xy), dotTol) << "mode " << mode;
+      EXPECT_LE(KAT::abs(h_dots(1) - yy), dotTol) << "mode " << mode;
+      EXPECT_LE(KAT::abs(h_dots2(0) - xy), dotTol) << "mode " << mode;
+      EXPECT_LE(KAT::abs(h_dots2(1) - yy), dotTol) << "mode " << mode;
+
+      auto h_y     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+      auto h_y_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+      for (lno_t i = 0; i < numRows; i++) EXPECT_LE(KAT::abs(h_y(i) - h_y_ref(i)), tol) << "mode " << mode;
+    }
+
+    // spmv_axpby, with b = 0 on a z containing NaN
+    for (const scalar_t bb : {b, scalar_t(0)}) {
+      if (bb == scalar_t(0))
+        Kokkos::deep_copy(z, KAT::nan());
+      else
+        Kokkos::deep_copy(z, z_ref);
+      v_t z_expected("z_expected", numRows);
+      Kokkos::deep_copy(z_expected, z_ref);
+      KokkosBlas::axpby(a, y_ref, bb, z_expected);
+      Kokkos::deep_copy(y, KAT::nan());
+      KokkosSparse::Experimental::spmv_axpby(mode, alpha, A, x, y, a, bb, z);
+
+      auto h_y     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+      auto h_y_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+      auto h_z     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), z);
+      auto h_z_exp = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), z_expected);
+      for (lno_t i = 0; i < numRows; i++) {
+        EXPECT_LE(KAT::abs(h_y(i) - h_y_ref(i)), tol) << "mode " << mode;
+        EXPECT_LE(KAT::abs(h_z(i) - h_z_exp(i)), 4 * tol) << "mode " << mode << " b " << bb;
+      }
+    }
+  }
+
+  // Transpose modes and mismatched dimensions are reported
+  v_t dots("dots", 2), x_bad("x_bad", numRows + 1);
+  EXPECT_THROW(KokkosSparse::Experimental::spmv_dot("T", scalar_t(1), A, x, y, dots), std::runtime_error);
+  EXPECT_THROW(KokkosSparse::Experimental::spmv_axpby("N", scalar_t(1), A, x_bad, y, scalar_t(1), scalar_t(1), z),
+               std::runtime_error);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_fused_all() {
+  Test::test_spmv_fused<scalar_t, lno_t, size_type, Device>(1000, 1000 * 5, 4);
+  Test::test_spmv_fused<scalar_t, lno_t, size_type, Device>(2717, 2717 * 30, 50);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                          \
+  TEST_F(TestCategory, sparse##_##spmv_fused##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_fused_all<SCALAR, ORDINAL, OFFSET, DEVICE>();                                  \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,207 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_matrix_free.hpp"
+#include "KokkosSparse_gmres.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosKernels_Handle.hpp"
+
+namespace Test {
+
+// Variable coefficient stencils: 7 points in 3D (Shape 0), the 9 point box
+// in 2D (Shape 1) and 5 points of width 2 in 1D (Shape 2). The center
+// coefficient dominates the row.
+template <typename scalar_t, typename lno_t, int Shape>
+struct MatrixFreeTestStencil {
+  using value_type                 = scalar_t;
+  static constexpr int num_entries = Shape == 0 ? 7 : (Shape == 1 ? 9 : 5);
+
+  KOKKOS_INLINE_FUNCTION void offset(const int e, int& di, int& dj, int& dk) const {
+    di = dj = dk = 0;
+    if constexpr (Shape == 0) {
+      if (e > 0) {
+        const int sign = (e - 1) % 2 ? 1 : -1;
+        if ((e - 1) / 2 == 0)
+          di = sign;
+        else if ((e - 1) / 2 == 1)
+          dj = sign;
+        else
+          dk = sign;
+      }
+    } else if constexpr (Shape == 1) {
+      di = e % 3 - 1;
+      dj = e / 3 - 1;
+    } else {
+      di = e - 2;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION value_type coefficient(const lno_t i, const lno_t j, const lno_t k, const int e) const {
+    int di, dj, dk;
+    offset(e, di, dj, dk);
+    if (di == 0 && dj == 0 && dk == 0) return value_type(num_entries + 0.5 + 0.1 * ((i + 2 * j + 3 * k) % 7));
+    return value_type(-1.0 - 0.05 * ((i + j + k + e) % 3));
+  }
+};
+
+// Assemble the stencil operator into a CrsMatrix on host, dropping the
+// points outside of the grid
+template <typename crsMat_t, typename Stencil, typename lno_t>
+crsMat_t assemble_stencil(const Stencil& stencil, const lno_t ni, const lno_t nj, const lno_t nk) {
+  using size_type = typename crsMat_t::non_const_size_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  const lno_t n   = ni * nj * nk;
+  Kokkos::View<size_type*, Kokkos::HostSpace> rowmap("rowmap", n + 1);
+  Kokkos::View<lno_t*, Kokkos::HostSpace> entries("entries", size_t(n) * Stencil::num_entries);
+  Kokkos::View<scalar_t*, Kokkos::HostSpace> values("values", size_t(n) * Stencil::num_entries);
+  size_type nnz = 0;
+  for (lno_t k = 0; k < nk; k++) {
+    for (lno_t j = 0; j < nj; j++) {
+      for (lno_t i = 0; i < ni; i++) {
+        for (int e = 0; e < Stencil::num_entries; e++) {
+          int di, dj, dk;
+          stencil.offset(e, di, dj, dk);
+          if (i + di < 0 || i + di >= ni || j + dj < 0 || j + dj >= nj || k + dk < 0 || k + dk >= nk) continue;
+          entries(nnz)  = (i + di) + ni * ((j + dj) + nj * (k + dk));
+          values(nnz++) = stencil.coefficient(i, j, k, e);
+        }
+        rowmap(i + ni * (j + nj * k) + 1) = nnz;
+      }
+    }
+  }
+  typename crsMat_t::row_map_type::non_const_type d_rowmap("rowmap", n + 1);
+  typename crsMat_t::index_type::non_const_type d_entries("entries", nnz);
+  typename crsMat_t::values_type::non_const_type d_values("values", nnz);
+  Kokkos::deep_copy(d_rowmap, rowmap);
+  Kokkos::deep_copy(d_entries, Kokkos::subview(entries, Kokkos::make_pair(size_type(0), nnz)));
+  Kokkos::deep_copy(d_values, Kokkos::subview(values, Kokkos::make_pair(size_type(0), nnz)));
+  return crsMat_t("A", n, n, nnz, d_values, d_rowmap, d_entries);
+}
+
+// Compare spmv with the stencil operator against spmv with the assembled
+// CrsMatrix, for rank-1 and rank-2 vectors
+template <typename scalar_t, typename lno_t, typename size_type, typename Device, int Shape>
+void test_spmv_matrix_free(const lno_t ni, const lno_t nj, const lno_t nk) {
+  using crsMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using stencil  = MatrixFreeTestStencil<scalar_t, lno_t, Shape>;
+  using op_t     = KokkosSparse::Experimental::StencilOperator<stencil, lno_t, Device>;
+  using v_t      = Kokkos::View<scalar_t*, Device>;
+  using mv_t     = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, Device>;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  const op_t A(ni, nj, nk, stencil());
+  const crsMat_t Acrs = assemble_stencil<crsMat_t>(stencil(), ni, nj, nk);
+  const lno_t n       = A.numRows();
+  ASSERT_EQ(n, Acrs.numRows());
+
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+  mv_t x("x", n, 2), y("y", n, 2), y_ref("y_ref", n, 2);
+  Kokkos::fill_random(x, rand_pool, scalar_t(1));
+  const mag_t tol = 10 * KAT::eps() * 4 * stencil::num_entries;
+
+  for (const scalar_t beta : {scalar_t(0), scalar_t(0.5)}) {
+    const scalar_t alpha(-1.5);
+    Kokkos::fill_random(y_ref, rand_pool, scalar_t(1));
+    if (beta == scalar_t(0))
+      Kokkos::deep_copy(y, KAT::nan());
+    else
+      Kokkos::deep_copy(y, y_ref);
+    // rank 1 in column 0, rank 2 in both columns
+    v_t x0 = Kokkos::subview(x, Kokkos::ALL(), 0), y0 = Kokkos::subview(y, Kokkos::ALL(), 0);
+    KokkosSparse::spmv("N", alpha, A, x0, beta, y0);
+    KokkosSparse::spmv("N", alpha, Acrs, x0, beta, Kokkos::subview(y_ref, Kokkos::ALL(), 0));
+    auto y1 = Kokkos::subview(y, Kokkos::ALL(), Kokkos::make_pair(1, 2));
+    auto x1 = Kokkos::subview(x, Kokkos::ALL(), Kokkos::make_pair(1, 2));
+    KokkosSparse::spmv(typename Device::execution_space(), "N", alpha, A, x1, beta, y1);
+    KokkosSparse::spmv("N", alpha, Acrs, x1, beta, Kokkos::subview(y_ref, Kokkos::ALL(), Kokkos::make_pair(1, 2)));
+
+    auto h_y     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto h_y_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+    for (lno_t i = 0; i < n; i++) {
+      for (int c = 0; c < 2; c++) {
+        EXPECT_LE(KAT::abs(h_y(i, c) - h_y_ref(i, c)), tol * (1 + KAT::abs(h_y_ref(i, c))))
+            << "row " << i << " column " << c << " beta " << beta;
+      }
+    }
+  }
+
+  // The operator is not stored, so transposes are reported
+  v_t x0 = Kokkos::subview(x, Kokkos::ALL(), 0), y0 = Kokkos::subview(y, Kokkos::ALL(), 0);
+  EXPECT_THROW(KokkosSparse::spmv("T", scalar_t(1), A, x0, scalar_t(0), y0), std::runtime_error);
+}
+
+// Solve with GMRES, applying the operator only through the stencil
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_gmres_matrix_free(const lno_t ni, const lno_t nj, const lno_t nk) {
+  using exe_space = typename Device::execution_space;
+  using mem_space = typename Device::memory_space;
+  using stencil   = MatrixFreeTestStencil<scalar_t, lno_t, 0>;
+  using op_t      = KokkosSparse::Experimental::StencilOperator<stencil, lno_t, Device>;
+  using v_t       = Kokkos::View<scalar_t*, Device>;
+  using mag_t     = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  op_t A(ni, nj, nk, stencil());
+  const lno_t n = A.numRows();
+  const mag_t tol(std::is_same_v<mag_t, float> ? 1e-5 : 1e-8);
+
+  KernelHandle kh;
+  kh.create_gmres_handle(20, tol);
+  auto gmres_handle = kh.get_gmres_handle();
+  using GMRESHandle = typename std::remove_reference<decltype(*gmres_handle)>::type;
+  v_t X("X", n), B("B", n), R("R", n);
+  Kokkos::deep_copy(B, scalar_t(1));
+
+  KokkosSparse::Experimental::gmres(&kh, A, B, X);
+
+  const mag_t nrmB = KokkosBlas::nrm2(B);
+  Kokkos::deep_copy(R, B);
+  KokkosSparse::spmv("N", scalar_t(-1), A, X, scalar_t(1), R);
+  EXPECT_LT(KokkosBlas::nrm2(R) / nrmB, 10 * tol);
+  EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_matrix_free_all() {
+  // Grids with an interior, and grids too thin to have one
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 0>(17, 13, 11);
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 0>(9, 2, 5);
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 1>(40, 33, 1);
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 1>(1, 12, 1);
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 2>(1000, 1, 1);
+  Test::test_spmv_matrix_free<scalar_t, lno_t, size_type, Device, 2>(3, 1, 1);
+  Test::test_gmres_matrix_free<scalar_t, lno_t, size_type, Device>(12, 10, 9);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                \
+  TEST_F(TestCategory, sparse##_##spmv_matrix_free##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_matrix_free_all<SCALAR, ORDINAL, OFFSET, DEVICE>();                                  \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_NaN.hpp"
+
+namespace Test {
+
+// N matrices sharing the graph of a random CrsMatrix, applied with a single
+// spmv call and compared against a host reference
+template <typename scalar_t, typename lno_t, typename size_type, typename Device, typename Layout>
+void test_spmv_multi_values(lno_t numRows, lno_t numCols, size_type nnz, lno_t row_size_variance, int numMembers) {
+  using crsMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using mv_t     = Kokkos::View<scalar_t **, Layout, Device>;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT      = Kokkos::ArithTraits<scalar_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numCols, nnz, row_size_variance,
+                                                                         numCols);
+
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+  mv_t values("values", nnz, numMembers);
+  Kokkos::fill_random(values, rand_pool, scalar_t(1));
+  auto h_rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto h_values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+  const mag_t tol = 10 * KAT::eps() * (nnz / (numRows ? numRows : 1) + row_size_variance + 2);
+
+  for (const char *mode : {"N", "C", "T", "H"}) {
+    const bool trans = mode[0] == 'T' || mode[0] == 'H';
+    const bool conj  = mode[0] == 'C' || mode[0] == 'H';
+    const lno_t xlen = trans ? numRows : numCols;
+    const lno_t ylen = trans ? numCols : numRows;
+    mv_t x("x", xlen, numMembers);
+    mv_t y("y", ylen, numMembers);
+    Kokkos::fill_random(x, rand_pool, scalar_t(1));
+    Kokkos::fill_random(y, rand_pool, scalar_t(1));
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    auto h_y = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+    for (scalar_t beta : {scalar_t(0), scalar_t(-0.5)}) {
+      const scalar_t alpha(1.5);
+      // Reference result on host, one matrix at a time
+      Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Kokkos::HostSpace> ref("ref", ylen, numMembers);
+      for (lno_t i = 0; i < ylen; i++)
+        for (int l = 0; l < numMembers; l++) ref(i, l) = beta * h_y(i, l);
+      for (int l = 0; l < numMembers; l++) {
+        for (lno_t i = 0; i < numRows; i++) {
+          for (size_type k = h_rowmap(i); k < h_rowmap(i + 1); k++) {
+            const scalar_t val = conj ? KAT::conj(h_values(k, l)) : h_values(k, l);
+            const lno_t col    = h_entries(k);
+            if (trans)
+              ref(col, l) += alpha * val * h_x(i, l);
+            else
+              ref(i, l) += alpha * val * h_x(col, l);
+          }
+        }
+      }
+
+      // With beta = 0, y must be overwritten even if it contains NaN
+      mv_t y_copy("y_copy", ylen, numMembers);
+      if (beta == scalar_t(0))
+        Kokkos::deep_copy(y_copy, KokkosKernels::Impl::quiet_NaN<scalar_t>());
+      else
+        Kokkos::deep_copy(y_copy, y);
+      KokkosSparse::spmv(mode, alpha, A.graph, values, x, beta, y_copy);
+      auto h_result = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_copy);
+      for (lno_t i = 0; i < ylen; i++)
+        for (int l = 0; l < numMembers; l++)
+          EXPECT_LE(KAT::abs(h_result(i, l) - ref(i, l)), tol)
+              << "mode " << mode << " row " << i << " member " << l << " of " << numMembers;
+    }
+  }
+
+  // Mismatched dimensions are reported
+  mv_t x_bad("x_bad", numCols, numMembers + 1);
+  mv_t y_bad("y_bad", numRows, numMembers + 1);
+  EXPECT_THROW(KokkosSparse::spmv("N", scalar_t(1), A.graph, values, x_bad, scalar_t(0), y_bad), std::runtime_error);
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_multi_values_all() {
+  // Fewer members than the host block and GPU vector length, and more
+  for (int numMembers : {1, 5, 32, 41}) {
+    Test::test_spmv_multi_values<scalar_t, lno_t, size_type, Device, Kokkos::LayoutRight>(1000, 1000, 1000 * 5, 4,
+                                                                                          numMembers);
+    Test::test_spmv_multi_values<scalar_t, lno_t, size_type, Device, Kokkos::LayoutLeft>(517, 803, 517 * 10, 9,
+                                                                                         numMembers);
+  }
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                    \
+  TEST_F(TestCategory, sparse##_##spmv_multi_values##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_multi_values_all<SCALAR, ORDINAL, OFFSET, DEVICE>();                                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
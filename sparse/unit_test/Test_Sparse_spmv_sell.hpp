@@ -0,0 +1,172 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_crs2sell.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_NaN.hpp"
+
+namespace Test {
+
+// Check that the SellMatrix holds exactly the entries of the CrsMatrix
+template <typename crsMat_t, typename sellMat_t>
+void check_sell_structure(const crsMat_t &A, const sellMat_t &S) {
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using size_type = typename crsMat_t::non_const_size_type;
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+
+  auto rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto offsets = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.chunk_offsets);
+  auto perm    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.row_perm);
+  auto sCols   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.entries);
+  auto sVals   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), S.values);
+
+  const lno_t C = S.chunkSize();
+  ASSERT_EQ(S.numRows(), A.numRows());
+  ASSERT_EQ(S.numCols(), A.numCols());
+  ASSERT_EQ(S.nnz(), A.nnz());
+  ASSERT_EQ(perm.extent(0), size_t(A.numRows()));
+  std::vector<bool> seen(A.numRows(), false);
+  for (lno_t slot = 0; slot < A.numRows(); slot++) {
+    lno_t row = perm(slot);
+    ASSERT_TRUE(row >= 0 && row < A.numRows());
+    ASSERT_FALSE(seen[row]);
+    seen[row] = true;
+    // rows are only permuted within their sorting window
+    EXPECT_EQ(row / S.sigma(), slot / S.sigma());
+    lno_t chunk     = slot / C;
+    size_type width = (offsets(chunk + 1) - offsets(chunk)) / C;
+    size_type len   = rowmap(row + 1) - rowmap(row);
+    ASSERT_GE(width, len);
+    for (size_type j = 0; j < width; j++) {
+      size_type k = offsets(chunk) + j * C + slot % C;
+      if (j < len) {
+        EXPECT_EQ(sCols(k), entries(rowmap(row) + j));
+        EXPECT_EQ(sVals(k), values(rowmap(row) + j));
+      } else {
+        EXPECT_EQ(sVals(k), Kokkos::ArithTraits<scalar_t>::zero());
+        EXPECT_TRUE(sCols(k) >= 0 && sCols(k) < A.numCols());
+      }
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_sell(lno_t numRows, lno_t numCols, size_type nnz, lno_t row_size_variance, lno_t chunkSize,
+                    lno_t sigma) {
+  using crsMat_t  = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using sellMat_t = KokkosSparse::Experimental::SellMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using mv_t      = Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Device>;
+  using v_t       = Kokkos::View<scalar_t *, Device>;
+  using mag_t     = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using KAT       = Kokkos::ArithTraits<scalar_t>;
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numCols, nnz, row_size_variance,
+                                                                         numCols);
+  sellMat_t S = KokkosSparse::Experimental::crs2sell(A, chunkSize, sigma);
+  check_sell_structure(A, S);
+
+  const int numVecs = 3;
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+  auto h_rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto h_values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  const mag_t tol = 10 * KAT::eps() * (nnz / (numRows ? numRows : 1) + row_size_variance + 2);
+
+  for (const char *mode : {"N", "C", "T", "H"}) {
+    const bool trans = mode[0] == 'T' || mode[0] == 'H';
+    const bool conj  = mode[0] == 'C' || mode[0] == 'H';
+    const lno_t xlen = trans ? numRows : numCols;
+    const lno_t ylen = trans ? numCols : numRows;
+    mv_t x("x", xlen, numVecs);
+    mv_t y("y", ylen, numVecs);
+    Kokkos::fill_random(x, rand_pool, scalar_t(1));
+    Kokkos::fill_random(y, rand_pool, scalar_t(1));
+    auto h_x = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    auto h_y = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+
+    const scalar_t alpha(1.5), beta(-0.5);
+    // Reference result on host
+    Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Kokkos::HostSpace> ref("ref", ylen, numVecs);
+    for (lno_t i = 0; i < ylen; i++)
+      for (int v = 0; v < numVecs; v++) ref(i, v) = beta * h_y(i, v);
+    for (lno_t i = 0; i < numRows; i++) {
+      for (size_type k = h_rowmap(i); k < h_rowmap(i + 1); k++) {
+        const scalar_t val = conj ? KAT::conj(h_values(k)) : h_values(k);
+        const lno_t col    = h_entries(k);
+        for (int v = 0; v < numVecs; v++) {
+          if (trans)
+            ref(col, v) += alpha * val * h_x(i, v);
+          else
+            ref(i, v) += alpha * val * h_x(col, v);
+        }
+      }
+    }
+
+    // rank-2 interface, through a handle
+    KokkosSparse::SPMVHandle<Device, sellMat_t, mv_t, mv_t> handle;
+    KokkosSparse::spmv(&handle, mode, alpha, S, x, beta, y);
+    auto h_result = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    for (lno_t i = 0; i < ylen; i++)
+      for (int v = 0; v < numVecs; v++)
+        EXPECT_LE(KAT::abs(h_result(i, v) - ref(i, v)), tol) << "mode " << mode << " row " << i << " vec " << v;
+
+    // rank-1 interface (no handle), with beta = 0 on a y containing NaN
+    auto x1 = Kokkos::subview(x, Kokkos::ALL(), 0);
+    v_t y1("y1", ylen);
+    Kokkos::deep_copy(y1, KokkosKernels::Impl::quiet_NaN<scalar_t>());
+    KokkosSparse::spmv(mode, alpha, S, x1, scalar_t(0), y1);
+    auto h_y1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y1);
+    for (lno_t i = 0; i < ylen; i++) {
+      scalar_t expected = ref(i, 0) - beta * h_y(i, 0);
+      EXPECT_LE(KAT::abs(h_y1(i) - expected), tol) << "mode " << mode << " row " << i;
+    }
+  }
+}
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_sell_all() {
+  // Chunk sizes with compile-time kernels (8, 32) and without (3), with and
+  // without sorting, and with a partially filled last chunk
+  for (lno_t C : {1, 3, 8, 32}) {
+    for (lno_t sigma : {1, 64}) {
+      Test::test_spmv_sell<scalar_t, lno_t, size_type, Device>(1000, 1000, 1000 * 5, 4, C, sigma);
+      Test::test_spmv_sell<scalar_t, lno_t, size_type, Device>(517, 803, 517 * 10, 9, C, sigma);
+    }
+  }
+  // SellMatrix has a single algorithm, so there is nothing to autotune
+  using sellMat_t = KokkosSparse::Experimental::SellMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using mv_t      = Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Device>;
+  EXPECT_THROW((KokkosSparse::SPMVHandle<Device, sellMat_t, mv_t, mv_t>(KokkosSparse::SPMV_AUTOTUNE)),
+               std::invalid_argument);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                            \
+  TEST_F(TestCategory, sparse##_##spmv_sell##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spmv_sell_all<SCALAR, ORDINAL, OFFSET, DEVICE>();                                    \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST